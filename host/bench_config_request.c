@@ -0,0 +1,112 @@
+/*
+ * Benchmark of mesh_config_request.c
+ */
+#include "host.h"
+
+#define BENCH_ROUNDS        2000
+#define BENCH_BATCH         16      // Commands in one queue command, as many as fit in the transport buffer
+#define BENCH_NODES         96
+#define BENCH_REPLY_DELAY   100     // Round trip to the node in milliseconds
+#define BENCH_ITEM_LEN      (6 + HOST_EVENT_HDR_LEN)
+
+static void bench_queue(uint16_t first_dst, uint16_t num)
+{
+    uint8_t cmd[BENCH_BATCH * BENCH_ITEM_LEN];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    for (i = 0; i < num; i++)
+    {
+        UINT16_TO_STREAM(p, i);
+        UINT16_TO_STREAM(p, 2 + HOST_EVENT_HDR_LEN);
+        UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET);
+        memset(p, 0, HOST_EVENT_HDR_LEN);
+        p[0] = (uint8_t)(first_dst + i);
+        p[1] = (uint8_t)((first_dst + i) >> 8);
+        p += HOST_EVENT_HDR_LEN;
+    }
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, (uint32_t)(p - cmd));
+}
+
+static void bench_set(uint8_t window)
+{
+    uint8_t cmd[5] = { window, 1, (uint8_t)4000, (uint8_t)(4000 >> 8), 3 };
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET, cmd, sizeof(cmd));
+}
+
+/*
+ * Reply to the commands sent since the last call after the round trip delay
+ */
+static uint32_t bench_reply_sent(uint32_t first)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t status = { 5 };
+    uint32_t last = host_num_requests;
+    uint32_t i;
+
+    host_advance(BENCH_REPLY_DELAY);
+    for (i = first; i < last; i++)
+        host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, host_requests[i].dst, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+    return last;
+}
+
+/*
+ * Processing time of a request: queue, send, status and the result to the MCU
+ */
+static void bench_request_cost(void)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t status = { 5 };
+    uint64_t start;
+    uint32_t round;
+    uint16_t i;
+
+    bench_set(BENCH_BATCH);
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        host_reset();
+        bench_queue(0x100, BENCH_BATCH);
+        for (i = 0; i < BENCH_BATCH; i++)
+            host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x100 + i, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+    }
+    host_bench_report("request queued and completed", start, BENCH_ROUNDS * BENCH_BATCH);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), BENCH_BATCH);
+}
+
+/*
+ * Simulated time to get the status of all nodes with different windows
+ */
+static void bench_window(void)
+{
+    static const uint8_t windows[] = { 1, 8, 32 };
+    uint64_t start;
+    uint32_t first;
+    uint16_t dst;
+    uint8_t  w;
+
+    for (w = 0; w < sizeof(windows); w++)
+    {
+        bench_set(windows[w]);
+        host_reset();
+        start = host_now();
+        // MCU keeps the queue full
+        for (first = 0, dst = 0x200; host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE) < BENCH_NODES; )
+        {
+            while ((dst < 0x200 + BENCH_NODES) && (dst - 0x200 - host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE) <= BENCH_BATCH))
+            {
+                bench_queue(dst, BENCH_BATCH);
+                dst += BENCH_BATCH;
+            }
+            first = bench_reply_sent(first);
+        }
+        printf("  window %-2d %d nodes %31u ms\n", windows[w], BENCH_NODES, (uint32_t)(host_now() - start));
+    }
+    bench_set(8);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(bench_request_cost),
+    HOST_TEST(bench_window),
+    { NULL, NULL }
+};
@@ -0,0 +1,85 @@
+/*
+ * Benchmark of the payload decode of mesh_provision_client.c
+ */
+#include "host.h"
+
+#define BENCH_ROUNDS            1000000
+#define BENCH_PAYLOAD_LEN       33
+
+static const mesh_app_hci_field_t bench_publication_set_fields[] =
+{
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, element_addr, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, company_id, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, model_id, 2),
+    MESH_APP_HCI_ARRAY(wiced_bt_mesh_config_model_publication_set_data_t, publish_addr, 16),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, app_key_idx, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, credential_flag, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_ttl, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_period, 4),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_retransmit_count, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_retransmit_interval, 2),
+};
+static const mesh_app_hci_layout_t bench_publication_set_layout =
+    MESH_APP_HCI_LAYOUT(wiced_bt_mesh_config_model_publication_set_data_t, bench_publication_set_fields);
+
+static uint8_t bench_payload[BENCH_PAYLOAD_LEN];
+
+/*
+ * Decode as the handlers did before the layouts, with the length checked by the caller
+ */
+static void bench_decode_stream(uint8_t *p_data, wiced_bt_mesh_config_model_publication_set_data_t *p_set)
+{
+    STREAM_TO_UINT16(p_set->element_addr, p_data);
+    STREAM_TO_UINT16(p_set->company_id, p_data);
+    STREAM_TO_UINT16(p_set->model_id, p_data);
+    STREAM_TO_ARRAY(p_set->publish_addr, p_data, 16);
+    STREAM_TO_UINT16(p_set->app_key_idx, p_data);
+    STREAM_TO_UINT8(p_set->credential_flag, p_data);
+    STREAM_TO_UINT8(p_set->publish_ttl, p_data);
+    STREAM_TO_UINT32(p_set->publish_period, p_data);
+    STREAM_TO_UINT8(p_set->publish_retransmit_count, p_data);
+    STREAM_TO_UINT16(p_set->publish_retransmit_interval, p_data);
+}
+
+/*
+ * Time to decode the model publication set payload with the layout and with the STREAM macros
+ */
+static void bench_decode_publication_set(void)
+{
+    wiced_bt_mesh_config_model_publication_set_data_t set;
+    wiced_bt_mesh_config_model_publication_set_data_t ref;
+    volatile uint32_t sum = 0;
+    uint64_t start;
+    uint32_t round;
+    uint8_t  i;
+
+    for (i = 0; i < BENCH_PAYLOAD_LEN; i++)
+        bench_payload[i] = (uint8_t)(i * 7 + 1);
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        bench_payload[0] = (uint8_t)round;
+        mesh_app_hci_decode(&bench_publication_set_layout, bench_payload, BENCH_PAYLOAD_LEN, &set);
+        sum += set.element_addr;
+    }
+    host_bench_report("publication set decoded from layout", start, BENCH_ROUNDS);
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        bench_payload[0] = (uint8_t)round;
+        memset(&ref, 0, sizeof(ref));
+        bench_decode_stream(bench_payload, &ref);
+        sum += ref.element_addr;
+    }
+    host_bench_report("publication set decoded by STREAM macros", start, BENCH_ROUNDS);
+
+    HOST_CHECK(memcmp(&set, &ref, sizeof(set)) == 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(bench_decode_publication_set),
+    { NULL, NULL }
+};
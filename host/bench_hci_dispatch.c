@@ -0,0 +1,173 @@
+/*
+ * Benchmark of the command dispatch of mesh_provision_client.c
+ */
+#include "host.h"
+
+#define BENCH_ROUNDS        20000
+
+/*
+ * Model client front-ends in the order of the || chain which dispatched the commands before the index
+ */
+static const mesh_app_hci_cmd_handler_t *bench_chain[] =
+{
+    &mesh_default_transition_time_client_hci_cmd_handler,
+    &mesh_property_client_hci_cmd_handler,
+    &mesh_battery_client_hci_cmd_handler,
+    &mesh_light_lc_client_hci_cmd_handler,
+    &mesh_light_xyl_client_hci_cmd_handler,
+    &mesh_location_client_hci_cmd_handler,
+    &mesh_power_level_client_hci_cmd_handler,
+    &mesh_power_onoff_client_hci_cmd_handler,
+    &mesh_scheduler_client_hci_cmd_handler,
+    &mesh_time_client_hci_cmd_handler,
+    &mesh_onoff_client_hci_cmd_handler,
+    &mesh_level_client_hci_cmd_handler,
+    &mesh_light_lightness_client_hci_cmd_handler,
+    &mesh_light_hsl_client_hci_cmd_handler,
+    &mesh_light_ctl_client_hci_cmd_handler,
+    &mesh_sensor_client_hci_cmd_handler,
+    &mesh_scene_client_hci_cmd_handler,
+    &mesh_vendor_client_hci_cmd_handler,
+};
+
+/*
+ * Each front-end is asked in turn until one consumes the command, as the || chain did
+ */
+static uint32_t bench_chain_cmd(uint16_t opcode, const uint8_t *p_data, uint32_t length)
+{
+    uint8_t buffer[TRANSPORT_BUFFER_SIZE];
+    uint8_t i;
+
+    memcpy(buffer, p_data, length);
+    for (i = 0; i < sizeof(bench_chain) / sizeof(bench_chain[0]); i++)
+    {
+        if (bench_chain[i]->proc_rx_cmd(opcode, buffer, length))
+            return WICED_TRUE;
+    }
+    return WICED_FALSE;
+}
+
+/*
+ * Lookup of each command of the mesh group in the index
+ */
+static void bench_dispatch_lookup(void)
+{
+    uint64_t start;
+    uint32_t round;
+    uint32_t found = 0;
+    uint16_t i;
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (i = 0; i < 0x100; i++)
+            found += mesh_app_config_cmd_check((HCI_CONTROL_GROUP_MESH << 8) | i);
+    }
+    host_bench_report("opcode looked up", start, BENCH_ROUNDS * 0x100);
+    HOST_CHECK(found != 0);
+}
+
+/*
+ * Dispatch of a command from the MCU to its handler, including the command status
+ */
+static void bench_dispatch_cmd(void)
+{
+    uint64_t start;
+    uint32_t round;
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        host_cmd((HCI_CONTROL_GROUP_MESH << 8) | 0xDF, NULL, 0);
+    }
+    host_bench_report("unknown command rejected", start, BENCH_ROUNDS);
+
+    host_reset();
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, NULL, 0);
+    }
+    host_bench_report("local command dispatched", start, BENCH_ROUNDS);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+}
+
+/*
+ * Front-end found with the low byte of the opcode, as mesh_app_proc_rx_cmd does
+ */
+static uint8_t bench_index[0x100];
+
+static uint32_t bench_index_cmd(uint16_t opcode, const uint8_t *p_data, uint32_t length)
+{
+    uint8_t buffer[TRANSPORT_BUFFER_SIZE];
+    uint8_t index;
+
+    memcpy(buffer, p_data, length);
+    if ((opcode >> 8) != HCI_CONTROL_GROUP_MESH)
+        return WICED_FALSE;
+    index = bench_index[(uint8_t)opcode];
+    if (index == 0)
+        return WICED_FALSE;
+    return bench_chain[index - 1]->proc_rx_cmd(opcode, buffer, length);
+}
+
+/*
+ * Dispatch of a model client command, with the index and with the || chain. The scene client is
+ * the last model client of the chain.
+ */
+static void bench_dispatch_model(void)
+{
+    uint8_t data[HOST_EVENT_HDR_LEN + 2] = { 0x34, 0x12 };
+    uint64_t start;
+    uint32_t round;
+    uint32_t consumed = 0;
+    uint8_t i, j;
+
+    for (i = 0; i < sizeof(bench_chain) / sizeof(bench_chain[0]); i++)
+    {
+        for (j = 0; j < bench_chain[i]->num_opcodes; j++)
+            bench_index[(uint8_t)bench_chain[i]->p_opcodes[j]] = i + 1;
+    }
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        consumed += bench_index_cmd(HCI_CONTROL_MESH_COMMAND_SCENE_STORE, data, sizeof(data));
+    }
+    host_bench_report("model command dispatched by index", start, BENCH_ROUNDS);
+    HOST_CHECK_EQ(consumed, BENCH_ROUNDS);
+
+    consumed = 0;
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        consumed += bench_chain_cmd(HCI_CONTROL_MESH_COMMAND_SCENE_STORE, data, sizeof(data));
+    }
+    host_bench_report("model command dispatched by || chain", start, BENCH_ROUNDS);
+    HOST_CHECK_EQ(consumed, BENCH_ROUNDS);
+
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        consumed += bench_chain_cmd((HCI_CONTROL_GROUP_MESH << 8) | 0xDF, NULL, 0);
+    }
+    host_bench_report("unknown command rejected by || chain", start, BENCH_ROUNDS);
+    HOST_CHECK_EQ(consumed, BENCH_ROUNDS);
+
+    // Same command through mesh_app_proc_rx_cmd, including the transaction bookkeeping
+    start = host_clock_ns();
+    for (round = 0; round < BENCH_ROUNDS; round++)
+    {
+        consumed += host_cmd(HCI_CONTROL_MESH_COMMAND_SCENE_STORE, data, sizeof(data));
+    }
+    host_bench_report("model command through proc_rx_cmd", start, BENCH_ROUNDS);
+    HOST_CHECK_EQ(consumed, 2 * BENCH_ROUNDS);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(bench_dispatch_lookup),
+    HOST_TEST(bench_dispatch_cmd),
+    HOST_TEST(bench_dispatch_model),
+    { NULL, NULL }
+};
@@ -0,0 +1,156 @@
+/*
+ * Benchmark of mesh_provision_batch.c
+ */
+#include "host.h"
+
+#define BENCH_DEVICES           16
+#define BENCH_CONNECT_MS        600     // Link open and capabilities of the device
+#define BENCH_PROVISION_MS      4000    // Key exchange, authentication and provisioning data
+#define BENCH_ROUNDS            2000
+
+typedef struct
+{
+    uint16_t    server_addr;
+    uint16_t    event;                  // Reply the simulated device sends next, 0 if none
+    uint64_t    deadline;
+} bench_link_t;
+
+static const uint16_t bench_servers[] = { 0x0001, 0x0020, 0x0030, 0x0040 };
+
+static void bench_batch_cmd(uint8_t num_sessions)
+{
+    uint8_t data[TRANSPORT_BUFFER_SIZE];
+    uint8_t *p = data;
+    uint8_t i;
+
+    UINT16_TO_STREAM(p, bench_servers[0]);
+    UINT16_TO_STREAM(p, 0);             // net_key_idx
+    UINT16_TO_STREAM(p, 0x1000);        // start_addr
+    memset(p, 0, 7);                    // identify_duration, use_pb_gatt, algorithm, public_key_type, auth
+    p += 7;
+    UINT8_TO_STREAM(p, 0);              // oob_len
+    UINT8_TO_STREAM(p, BENCH_DEVICES);
+    for (i = 0; i < BENCH_DEVICES; i++)
+    {
+        memset(p, 0x40 + i, MESH_DEVICE_UUID_LEN);
+        p += MESH_DEVICE_UUID_LEN;
+    }
+    if (num_sessions > 1)
+    {
+        UINT8_TO_STREAM(p, num_sessions - 1);
+        for (i = 1; i < num_sessions; i++)
+            UINT16_TO_STREAM(p, bench_servers[i]);
+    }
+    host_cmd(HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH, data, (uint32_t)(p - data));
+}
+
+static void bench_reply(uint16_t event, uint16_t server_addr)
+{
+    wiced_bt_mesh_provision_device_capabilities_data_t caps;
+    wiced_bt_mesh_provision_status_data_t status;
+
+    if (event == WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES)
+    {
+        memset(&caps, 0, sizeof(caps));
+        caps.elements_num = 1;
+        host_reply(event, server_addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &caps);
+    }
+    else
+    {
+        memset(&status, 0, sizeof(status));
+        status.result = WICED_BT_MESH_PROVISION_RESULT_SUCCESS;
+        host_reply(event, server_addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+    }
+}
+
+/*
+ * Run the batch against simulated devices. Each request to a server is answered by the device
+ * after the time of the step. Returns the simulated time of the batch in milliseconds.
+ */
+static uint32_t bench_batch_run(uint8_t num_sessions)
+{
+    bench_link_t links[sizeof(bench_servers) / sizeof(bench_servers[0])];
+    host_request_t *p_req;
+    bench_link_t *p_next;
+    uint64_t start = host_now();
+    uint32_t handled = 0;
+    uint8_t  i;
+
+    memset(links, 0, sizeof(links));
+    for (i = 0; i < num_sessions; i++)
+        links[i].server_addr = bench_servers[i];
+
+    host_reset();
+    bench_batch_cmd(num_sessions);
+    while (host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT) < BENCH_DEVICES)
+    {
+        // Schedule the reply to the requests sent since the last reply
+        for (; handled < host_num_requests; handled++)
+        {
+            p_req = &host_requests[handled];
+            for (i = 0; (i < num_sessions) && (links[i].server_addr != p_req->dst); i++)
+                ;
+            if (i == num_sessions)
+                continue;
+            if (strcmp(p_req->name, "wiced_bt_mesh_provision_connect") == 0)
+            {
+                links[i].event    = WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES;
+                links[i].deadline = host_now() + BENCH_CONNECT_MS;
+            }
+            else if (strcmp(p_req->name, "wiced_bt_mesh_provision_start") == 0)
+            {
+                links[i].event    = WICED_BT_MESH_PROVISION_END;
+                links[i].deadline = host_now() + BENCH_PROVISION_MS;
+            }
+        }
+        for (p_next = NULL, i = 0; i < num_sessions; i++)
+        {
+            if ((links[i].event != 0) && ((p_next == NULL) || (links[i].deadline < p_next->deadline)))
+                p_next = &links[i];
+        }
+        if (p_next == NULL)
+            break;
+        host_advance((uint32_t)(p_next->deadline - host_now()));
+        i = (uint8_t)p_next->event;
+        p_next->event = 0;
+        bench_reply(i, p_next->server_addr);
+    }
+    return (uint32_t)(host_now() - start);
+}
+
+/*
+ * Simulated time to provision the devices with one to four provisioning servers
+ */
+static void bench_batch_sessions(void)
+{
+    uint32_t ms;
+    uint8_t  num_sessions;
+
+    for (num_sessions = 1; num_sessions <= sizeof(bench_servers) / sizeof(bench_servers[0]); num_sessions++)
+    {
+        ms = bench_batch_run(num_sessions);
+        HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), BENCH_DEVICES);
+        printf("  %d sessions %d devices %19u ms %6.1f devices/min\n", num_sessions, BENCH_DEVICES, ms,
+               BENCH_DEVICES * 60000.0 / ms);
+    }
+}
+
+/*
+ * Processing time of the batch for one device: connect, start and result to the MCU
+ */
+static void bench_batch_cost(void)
+{
+    uint64_t start = host_clock_ns();
+    uint32_t round;
+
+    for (round = 0; round < BENCH_ROUNDS; round++)
+        bench_batch_run(4);
+    host_bench_report("device provisioned by the batch", start, BENCH_ROUNDS * BENCH_DEVICES);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(bench_batch_sessions),
+    HOST_TEST(bench_batch_cost),
+    { NULL, NULL }
+};
@@ -0,0 +1,136 @@
+/*
+ * Simulated mesh core and transport for the host build of the application sources.
+ *
+ * Time only moves with host_advance(), which also expires the timers in deadline order. Events
+ * sent to the MCU are captured in host_sent, requests to the SDK models are captured in
+ * host_requests and release the event right away, as the SDK does once it is done with it.
+ */
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wiced_bt_types.h"
+#include "wiced_memory.h"
+#include "wiced_bt_mesh_core.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_models.h"
+#include "wiced_bt_mesh_provision.h"
+#include "wiced_bt_mesh_client.h"
+#include "wiced_transport.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+#define HOST_MAX_SENT               1024    // Events kept in host_sent, older ones are dropped
+#define HOST_MAX_REQUESTS           1024    // Requests kept in host_requests, older ones are dropped
+#define HOST_REQUEST_DATA_LEN       64      // Bytes of the request data kept in host_requests
+#define HOST_EVENT_HDR_LEN          11      // dst(2) app_key_idx(2) element_idx(1) reply(1) segmented(1) ttl(1) retrans_cnt(1) retrans_time(1) reply_timeout(1)
+
+/*
+ * Event sent to the MCU
+ */
+typedef struct
+{
+    uint16_t    opcode;
+    uint16_t    length;
+    uint8_t     data[TRANSPORT_BUFFER_SIZE];
+} host_sent_t;
+
+/*
+ * Request to the SDK. data holds the start of the structure passed with the request.
+ */
+typedef struct
+{
+    const char  *name;
+    uint16_t    dst;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint8_t     data[HOST_REQUEST_DATA_LEN];
+} host_request_t;
+
+extern host_sent_t      host_sent[HOST_MAX_SENT];
+extern uint32_t         host_num_sent;
+extern host_request_t   host_requests[HOST_MAX_REQUESTS];
+extern uint32_t         host_num_requests;
+extern wiced_bool_t     host_request_result;    // Value returned by the SDK requests, WICED_TRUE by default
+extern int              host_events_in_use;     // Mesh events created and not released
+extern int              host_buffers_in_use;    // Transport buffers allocated and not freed
+extern int              host_buffers_max;       // Allocation fails when that many buffers are in use
+
+/*
+ * Clear captured events and requests. Timers, time and the application state are kept.
+ */
+void host_reset(void);
+
+/*
+ * Initialize the application as the mesh application library does at startup
+ */
+void host_app_init(void);
+
+/*
+ * Move time forward, timers expiring in the meantime are executed in order
+ */
+void host_advance(uint32_t ms);
+uint64_t host_now(void);
+
+/*
+ * Send command to the application. Commands processed by the model front-ends are preceded by
+ * the event header, use host_cmd_to for those.
+ */
+uint32_t host_cmd(uint16_t opcode, const uint8_t *p_data, uint32_t length);
+uint32_t host_cmd_to(uint16_t opcode, uint16_t dst, const uint8_t *p_data, uint32_t length);
+
+/*
+ * Deliver message received from a peer to the configuration client callback
+ */
+void host_reply(uint16_t event, uint16_t src, uint16_t model_id, void *p_data);
+
+/*
+ * Build composition data status with the page 0 header and the element descriptions in p_elements.
+ * The returned buffer is released by the application.
+ */
+wiced_bt_mesh_config_composition_data_status_data_t *host_composition(uint16_t cid, uint16_t pid, uint16_t vid, const uint8_t *p_elements, uint16_t elements_len);
+
+/*
+ * Lookup of captured events and requests. index is the position among the matching entries,
+ * negative values count from the end. NULL when there is no such entry.
+ */
+host_sent_t *host_sent_find(uint16_t opcode, int index);
+uint32_t host_sent_count(uint16_t opcode);
+host_request_t *host_request_find(const char *name, int index);
+uint32_t host_request_count(const char *name);
+
+/*
+ * Status of the last command, the first byte of the last HCI_CONTROL_MESH_EVENT_COMMAND_STATUS
+ */
+int host_last_status(void);
+
+/*
+ * Benchmarks. host_clock_ns is the wall clock, host_bench_report prints the time per operation.
+ */
+uint64_t host_clock_ns(void);
+void host_bench_report(const char *name, uint64_t start_ns, uint32_t num_ops);
+
+/*
+ * Minimal test runner. Each test_*.c and bench_*.c defines host_tests[] terminated by { NULL, NULL }.
+ */
+typedef struct
+{
+    const char  *name;
+    void        (*p_test)(void);
+} host_test_t;
+
+extern int host_failures;
+
+#define HOST_CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); host_failures++; } } while (0)
+
+#define HOST_CHECK_EQ(a, b) \
+    do { long long _a = (long long)(a), _b = (long long)(b); \
+         if (_a != _b) { printf("%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #a, _a, _b); host_failures++; } } while (0)
+
+#define HOST_TEST(fn)   { #fn, fn }
+
+#endif
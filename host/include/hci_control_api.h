@@ -0,0 +1,279 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. The values follow the layout of
+ * the SDK header: the Mesh 1.0 commands and events first, in the order of the SDK, then the
+ * opcodes added with the later features. Only the opcodes compiled by the host build are defined;
+ * the optional features (directed forwarding, private beacons, SAR, firmware distribution, ...)
+ * are left out. All of them stay below 0xE0, the range of the commands and events defined by
+ * mesh_provision_client.h.
+ */
+#ifndef HCI_CONTROL_API_H
+#define HCI_CONTROL_API_H
+
+#define HCI_CONTROL_GROUP_MESH                                  0x16
+
+#define HCI_CONTROL_MESH_STATUS_SUCCESS                         0
+#define HCI_CONTROL_MESH_STATUS_ERROR                           1
+
+#define HCI_CONTROL_MESH_COMMAND_ONOFF_GET                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x04)
+#define HCI_CONTROL_MESH_COMMAND_ONOFF_SET                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x05)
+#define HCI_CONTROL_MESH_COMMAND_LEVEL_GET                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x06)
+#define HCI_CONTROL_MESH_COMMAND_LEVEL_SET                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x07)
+#define HCI_CONTROL_MESH_COMMAND_LEVEL_DELTA_SET                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x08)
+#define HCI_CONTROL_MESH_COMMAND_LEVEL_MOVE_SET                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x09)
+#define HCI_CONTROL_MESH_COMMAND_DEF_TRANS_TIME_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x0a)
+#define HCI_CONTROL_MESH_COMMAND_DEF_TRANS_TIME_SET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x0b)
+#define HCI_CONTROL_MESH_COMMAND_ONPOWERUP_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x0c)
+#define HCI_CONTROL_MESH_COMMAND_ONPOWERUP_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x0d)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_GET                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x0e)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_SET                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x0f)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_LAST_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x10)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_DEFAULT_GET                ((HCI_CONTROL_GROUP_MESH << 8) | 0x11)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_DEFAULT_SET                ((HCI_CONTROL_GROUP_MESH << 8) | 0x12)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_RANGE_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x13)
+#define HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_RANGE_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x14)
+#define HCI_CONTROL_MESH_COMMAND_LOCATION_GLOBAL_SET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x15)
+#define HCI_CONTROL_MESH_COMMAND_LOCATION_LOCAL_SET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x16)
+#define HCI_CONTROL_MESH_COMMAND_LOCATION_GLOBAL_GET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x17)
+#define HCI_CONTROL_MESH_COMMAND_LOCATION_LOCAL_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x18)
+#define HCI_CONTROL_MESH_COMMAND_BATTERY_GET                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x19)
+#define HCI_CONTROL_MESH_COMMAND_PROPERTIES_GET                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x1b)
+#define HCI_CONTROL_MESH_COMMAND_PROPERTY_GET                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x1c)
+#define HCI_CONTROL_MESH_COMMAND_PROPERTY_SET                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x1d)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_GET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x1e)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_SET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x1f)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LINEAR_GET             ((HCI_CONTROL_GROUP_MESH << 8) | 0x20)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LINEAR_SET             ((HCI_CONTROL_GROUP_MESH << 8) | 0x21)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LAST_GET               ((HCI_CONTROL_GROUP_MESH << 8) | 0x22)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_DEFAULT_GET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x23)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_DEFAULT_SET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x24)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_RANGE_GET              ((HCI_CONTROL_GROUP_MESH << 8) | 0x25)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_RANGE_SET              ((HCI_CONTROL_GROUP_MESH << 8) | 0x26)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x27)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x28)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_GET              ((HCI_CONTROL_GROUP_MESH << 8) | 0x29)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_SET              ((HCI_CONTROL_GROUP_MESH << 8) | 0x2a)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_DEFAULT_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x2b)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_DEFAULT_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x2c)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_RANGE_GET        ((HCI_CONTROL_GROUP_MESH << 8) | 0x2d)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_RANGE_SET        ((HCI_CONTROL_GROUP_MESH << 8) | 0x2e)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x2f)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x30)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_TARGET_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x31)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_RANGE_GET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x32)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_RANGE_SET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x33)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_DEFAULT_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x34)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_DEFAULT_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x35)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_HUE_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x36)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_HUE_SET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x37)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SATURATION_GET               ((HCI_CONTROL_GROUP_MESH << 8) | 0x38)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SATURATION_SET               ((HCI_CONTROL_GROUP_MESH << 8) | 0x39)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x3a)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x3b)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_RANGE_GET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x3c)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_RANGE_SET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x3d)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_TARGET_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x3e)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_DEFAULT_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x3f)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_DEFAULT_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x40)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_MODE_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x41)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_MODE_SET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x42)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_OCCUPANCY_MODE_GET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x43)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_OCCUPANCY_MODE_SET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x44)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_ONOFF_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x45)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_ONOFF_SET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x46)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_PROPERTY_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x47)
+#define HCI_CONTROL_MESH_COMMAND_LIGHT_LC_PROPERTY_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x48)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_DESCRIPTOR_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x49)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_CADENCE_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x4a)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_CADENCE_SET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x4b)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_SETTINGS_GET                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x4c)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_SETTING_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x4d)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_GET                             ((HCI_CONTROL_GROUP_MESH << 8) | 0x4e)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_COLUMN_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x4f)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_SERIES_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x50)
+#define HCI_CONTROL_MESH_COMMAND_SENSOR_SETTING_SET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x51)
+#define HCI_CONTROL_MESH_COMMAND_SCENE_STORE                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x52)
+#define HCI_CONTROL_MESH_COMMAND_SCENE_RECALL                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x53)
+#define HCI_CONTROL_MESH_COMMAND_SCENE_GET                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x54)
+#define HCI_CONTROL_MESH_COMMAND_SCENE_REGISTER_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x55)
+#define HCI_CONTROL_MESH_COMMAND_SCENE_DELETE                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x56)
+#define HCI_CONTROL_MESH_COMMAND_SCHEDULER_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x57)
+#define HCI_CONTROL_MESH_COMMAND_SCHEDULER_ACTION_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x58)
+#define HCI_CONTROL_MESH_COMMAND_SCHEDULER_ACTION_SET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x59)
+#define HCI_CONTROL_MESH_COMMAND_TIME_GET                               ((HCI_CONTROL_GROUP_MESH << 8) | 0x5a)
+#define HCI_CONTROL_MESH_COMMAND_TIME_SET                               ((HCI_CONTROL_GROUP_MESH << 8) | 0x5b)
+#define HCI_CONTROL_MESH_COMMAND_TIME_ZONE_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x5c)
+#define HCI_CONTROL_MESH_COMMAND_TIME_ZONE_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x5d)
+#define HCI_CONTROL_MESH_COMMAND_TIME_TAI_UTC_DELTA_GET                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x5e)
+#define HCI_CONTROL_MESH_COMMAND_TIME_TAI_UTC_DELTA_SET                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x5f)
+#define HCI_CONTROL_MESH_COMMAND_TIME_ROLE_GET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x60)
+#define HCI_CONTROL_MESH_COMMAND_TIME_ROLE_SET                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x61)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_CONNECT                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x63)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_DISCONNECT                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x64)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_START                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x65)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_OOB_VALUE                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x67)
+#define HCI_CONTROL_MESH_COMMAND_SEARCH_PROXY                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x68)
+#define HCI_CONTROL_MESH_COMMAND_PROXY_CONNECT                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x69)
+#define HCI_CONTROL_MESH_COMMAND_PROXY_DISCONNECT                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x6a)
+#define HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_TYPE_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x6b)
+#define HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_ADD             ((HCI_CONTROL_GROUP_MESH << 8) | 0x6c)
+#define HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_DELETE          ((HCI_CONTROL_GROUP_MESH << 8) | 0x6d)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_RESET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x6e)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x6f)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_SET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x70)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_COMPOSITION_DATA_GET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x71)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x72)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x73)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_GET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x74)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_SET                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x75)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_GET                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x76)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_SET                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x77)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x78)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_SET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x79)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_GET       ((HCI_CONTROL_GROUP_MESH << 8) | 0x7a)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_SET       ((HCI_CONTROL_GROUP_MESH << 8) | 0x7b)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_GET        ((HCI_CONTROL_GROUP_MESH << 8) | 0x7c)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_SET        ((HCI_CONTROL_GROUP_MESH << 8) | 0x7d)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_GET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x7e)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_SET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x7f)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_GET           ((HCI_CONTROL_GROUP_MESH << 8) | 0x80)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET           ((HCI_CONTROL_GROUP_MESH << 8) | 0x81)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_ADD          ((HCI_CONTROL_GROUP_MESH << 8) | 0x82)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE       ((HCI_CONTROL_GROUP_MESH << 8) | 0x83)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_OVERWRITE    ((HCI_CONTROL_GROUP_MESH << 8) | 0x84)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE_ALL   ((HCI_CONTROL_GROUP_MESH << 8) | 0x85)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_GET          ((HCI_CONTROL_GROUP_MESH << 8) | 0x86)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_ADD                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x87)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_DELETE                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x88)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_UPDATE                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x89)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x8a)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_ADD                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x8b)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_DELETE                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x8c)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_UPDATE                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x8d)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x8e)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x8f)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_UNBIND                ((HCI_CONTROL_GROUP_MESH << 8) | 0x90)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x91)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_GET               ((HCI_CONTROL_GROUP_MESH << 8) | 0x92)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_SET               ((HCI_CONTROL_GROUP_MESH << 8) | 0x93)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_LPN_POLL_TIMEOUT_GET            ((HCI_CONTROL_GROUP_MESH << 8) | 0x94)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_GET           ((HCI_CONTROL_GROUP_MESH << 8) | 0x95)
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_SET           ((HCI_CONTROL_GROUP_MESH << 8) | 0x96)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_GET                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x97)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_CLEAR                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x98)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_TEST                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x99)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_GET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x9a)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_SET                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x9b)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_GET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x9c)
+#define HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_SET                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x9d)
+#define HCI_CONTROL_MESH_COMMAND_SET_LOCAL_DEVICE                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x9e)
+#define HCI_CONTROL_MESH_COMMAND_SET_DEVICE_KEY                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x9f)
+#define HCI_CONTROL_MESH_COMMAND_VENDOR_DATA                            ((HCI_CONTROL_GROUP_MESH << 8) | 0xab)
+
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_ADD                       ((HCI_CONTROL_GROUP_MESH << 8) | 0xac)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_RETRIEVE_RECORD              ((HCI_CONTROL_GROUP_MESH << 8) | 0xad)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_CAPABILITIES_GET        ((HCI_CONTROL_GROUP_MESH << 8) | 0xae)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_EXTENDED_START          ((HCI_CONTROL_GROUP_MESH << 8) | 0xaf)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_GET                     ((HCI_CONTROL_GROUP_MESH << 8) | 0xb0)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_START                   ((HCI_CONTROL_GROUP_MESH << 8) | 0xb1)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_STOP                    ((HCI_CONTROL_GROUP_MESH << 8) | 0xb2)
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_SEND_INVITE                  ((HCI_CONTROL_GROUP_MESH << 8) | 0xb3)
+#define HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA                         ((HCI_CONTROL_GROUP_MESH << 8) | 0xb4)
+#define HCI_CONTROL_MESH_COMMAND_SET_ADV_TX_POWER                       ((HCI_CONTROL_GROUP_MESH << 8) | 0xb5)
+
+#define HCI_CONTROL_MESH_EVENT_COMMAND_STATUS                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x00)
+#define HCI_CONTROL_MESH_EVENT_ONOFF_STATUS                             ((HCI_CONTROL_GROUP_MESH << 8) | 0x01)
+#define HCI_CONTROL_MESH_EVENT_LEVEL_STATUS                             ((HCI_CONTROL_GROUP_MESH << 8) | 0x02)
+#define HCI_CONTROL_MESH_EVENT_LOCATION_GLOBAL_STATUS                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x03)
+#define HCI_CONTROL_MESH_EVENT_LOCATION_LOCAL_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x04)
+#define HCI_CONTROL_MESH_EVENT_BATTERY_STATUS                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x05)
+#define HCI_CONTROL_MESH_EVENT_DEF_TRANS_TIME_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x06)
+#define HCI_CONTROL_MESH_EVENT_POWER_ONOFF_STATUS                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x07)
+#define HCI_CONTROL_MESH_EVENT_POWER_LEVEL_STATUS                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x08)
+#define HCI_CONTROL_MESH_EVENT_POWER_LEVEL_LAST_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x09)
+#define HCI_CONTROL_MESH_EVENT_POWER_LEVEL_DEFAULT_STATUS               ((HCI_CONTROL_GROUP_MESH << 8) | 0x0a)
+#define HCI_CONTROL_MESH_EVENT_POWER_LEVEL_RANGE_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x0b)
+#define HCI_CONTROL_MESH_EVENT_PROPERTY_STATUS                          ((HCI_CONTROL_GROUP_MESH << 8) | 0x0c)
+#define HCI_CONTROL_MESH_EVENT_PROPERTIES_STATUS                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x0d)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_STATUS                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x0e)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LINEAR_STATUS            ((HCI_CONTROL_GROUP_MESH << 8) | 0x0f)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LAST_STATUS              ((HCI_CONTROL_GROUP_MESH << 8) | 0x10)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_DEFAULT_STATUS           ((HCI_CONTROL_GROUP_MESH << 8) | 0x11)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_RANGE_STATUS             ((HCI_CONTROL_GROUP_MESH << 8) | 0x12)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_CTL_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x13)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_STATUS             ((HCI_CONTROL_GROUP_MESH << 8) | 0x14)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_RANGE_STATUS       ((HCI_CONTROL_GROUP_MESH << 8) | 0x15)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_CTL_DEFAULT_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x16)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x17)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_TARGET_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x18)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_RANGE_STATUS                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x19)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_DEFAULT_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x1a)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_HUE_STATUS                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x1b)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_HSL_SATURATION_STATUS              ((HCI_CONTROL_GROUP_MESH << 8) | 0x1c)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_XYL_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x1d)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_XYL_TARGET_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x1e)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_XYL_RANGE_STATUS                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x1f)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_XYL_DEFAULT_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x20)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LC_MODE_CLIENT_STATUS              ((HCI_CONTROL_GROUP_MESH << 8) | 0x21)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LC_OCCUPANCY_MODE_CLIENT_STATUS    ((HCI_CONTROL_GROUP_MESH << 8) | 0x22)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LC_PROPERTY_CLIENT_STATUS          ((HCI_CONTROL_GROUP_MESH << 8) | 0x23)
+#define HCI_CONTROL_MESH_EVENT_LIGHT_LC_ONOFF_CLIENT_STATUS             ((HCI_CONTROL_GROUP_MESH << 8) | 0x24)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_DESCRIPTOR_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x25)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_STATUS                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x26)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_COLUMN_STATUS                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x27)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_SERIES_STATUS                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x28)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_CADENCE_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x29)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_SETTING_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x2a)
+#define HCI_CONTROL_MESH_EVENT_SENSOR_SETTINGS_STATUS                   ((HCI_CONTROL_GROUP_MESH << 8) | 0x2b)
+#define HCI_CONTROL_MESH_EVENT_SCENE_STATUS                             ((HCI_CONTROL_GROUP_MESH << 8) | 0x2c)
+#define HCI_CONTROL_MESH_EVENT_SCENE_REGISTER_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x2d)
+#define HCI_CONTROL_MESH_EVENT_SCHEDULER_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x2e)
+#define HCI_CONTROL_MESH_EVENT_SCHEDULER_ACTION_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x2f)
+#define HCI_CONTROL_MESH_EVENT_TIME_STATUS                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x30)
+#define HCI_CONTROL_MESH_EVENT_TIME_ZONE_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x31)
+#define HCI_CONTROL_MESH_EVENT_TIME_TAI_UTC_DELTA_STATUS                ((HCI_CONTROL_GROUP_MESH << 8) | 0x32)
+#define HCI_CONTROL_MESH_EVENT_TIME_ROLE_STATUS                         ((HCI_CONTROL_GROUP_MESH << 8) | 0x33)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_END                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x36)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_DEVICE_CAPABILITIES            ((HCI_CONTROL_GROUP_MESH << 8) | 0x37)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_OOB_DATA                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x38)
+#define HCI_CONTROL_MESH_EVENT_PROXY_DEVICE_NETWORK_DATA                ((HCI_CONTROL_GROUP_MESH << 8) | 0x39)
+#define HCI_CONTROL_MESH_EVENT_PROXY_CONNECTION_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x3a)
+#define HCI_CONTROL_MESH_EVENT_PROXY_FILTER_STATUS                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x3b)
+#define HCI_CONTROL_MESH_EVENT_NODE_RESET_STATUS                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x3c)
+#define HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x3d)
+#define HCI_CONTROL_MESH_EVENT_FRIEND_STATUS                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x3e)
+#define HCI_CONTROL_MESH_EVENT_HEARTBEAT_SUBSCRIPTION_STATUS            ((HCI_CONTROL_GROUP_MESH << 8) | 0x3f)
+#define HCI_CONTROL_MESH_EVENT_HEARTBEAT_PUBLICATION_STATUS             ((HCI_CONTROL_GROUP_MESH << 8) | 0x40)
+#define HCI_CONTROL_MESH_EVENT_NETWORK_TRANSMIT_PARAMS_STATUS           ((HCI_CONTROL_GROUP_MESH << 8) | 0x41)
+#define HCI_CONTROL_MESH_EVENT_MODEL_PUBLICATION_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x42)
+#define HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_STATUS                ((HCI_CONTROL_GROUP_MESH << 8) | 0x43)
+#define HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_LIST                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x44)
+#define HCI_CONTROL_MESH_EVENT_NETKEY_STATUS                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x45)
+#define HCI_CONTROL_MESH_EVENT_NETKEY_LIST                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x46)
+#define HCI_CONTROL_MESH_EVENT_APPKEY_STATUS                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x47)
+#define HCI_CONTROL_MESH_EVENT_APPKEY_LIST                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x48)
+#define HCI_CONTROL_MESH_EVENT_MODEL_APP_BIND_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x49)
+#define HCI_CONTROL_MESH_EVENT_MODEL_APP_LIST                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x4a)
+#define HCI_CONTROL_MESH_EVENT_NODE_IDENTITY_STATUS                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x4b)
+#define HCI_CONTROL_MESH_EVENT_LPN_POLL_TIMEOUT_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x4c)
+#define HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PHASE_STATUS                 ((HCI_CONTROL_GROUP_MESH << 8) | 0x4d)
+#define HCI_CONTROL_MESH_EVENT_HEALTH_CURRENT_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x4e)
+#define HCI_CONTROL_MESH_EVENT_HEALTH_FAULT_STATUS                      ((HCI_CONTROL_GROUP_MESH << 8) | 0x4f)
+#define HCI_CONTROL_MESH_EVENT_HEALTH_PERIOD_STATUS                     ((HCI_CONTROL_GROUP_MESH << 8) | 0x50)
+#define HCI_CONTROL_MESH_EVENT_HEALTH_ATTENTION_STATUS                  ((HCI_CONTROL_GROUP_MESH << 8) | 0x51)
+#define HCI_CONTROL_MESH_EVENT_BEACON_STATUS                            ((HCI_CONTROL_GROUP_MESH << 8) | 0x52)
+#define HCI_CONTROL_MESH_EVENT_DEFAULT_TTL_STATUS                       ((HCI_CONTROL_GROUP_MESH << 8) | 0x53)
+#define HCI_CONTROL_MESH_EVENT_RELAY_STATUS                             ((HCI_CONTROL_GROUP_MESH << 8) | 0x54)
+#define HCI_CONTROL_MESH_EVENT_GATT_PROXY_STATUS                        ((HCI_CONTROL_GROUP_MESH << 8) | 0x55)
+#define HCI_CONTROL_MESH_EVENT_VENDOR_DATA                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x56)
+#define HCI_CONTROL_MESH_EVENT_TX_COMPLETE                              ((HCI_CONTROL_GROUP_MESH << 8) | 0x57)
+
+#define HCI_CONTROL_MESH_EVENT_PROVISION_LINK_REPORT                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x58)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_LIST                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x59)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_RESPONSE                ((HCI_CONTROL_GROUP_MESH << 8) | 0x5a)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_CAPABILITIES_STATUS       ((HCI_CONTROL_GROUP_MESH << 8) | 0x5b)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_EXTENDED_REPORT           ((HCI_CONTROL_GROUP_MESH << 8) | 0x5c)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_REPORT                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x5d)
+#define HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_STATUS                    ((HCI_CONTROL_GROUP_MESH << 8) | 0x5e)
+#define HCI_CONTROL_MESH_EVENT_RAW_MODEL_DATA                           ((HCI_CONTROL_GROUP_MESH << 8) | 0x5f)
+
+#endif
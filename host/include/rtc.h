@@ -0,0 +1,9 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef RTC_H
+#define RTC_H
+
+#include "wiced_bt_types.h"
+
+#endif
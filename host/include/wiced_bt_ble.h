@@ -0,0 +1,19 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef WICED_BT_BLE_H
+#define WICED_BT_BLE_H
+
+#include "wiced_bt_types.h"
+
+#define BTM_BLE_ADVERT_TYPE_NAME_COMPLETE   0x09
+#define BTM_BLE_ADVERT_TYPE_APPEARANCE      0x19
+
+typedef struct
+{
+    uint8_t     *p_data;
+    uint16_t    len;
+    uint8_t     advert_type;
+} wiced_bt_ble_advert_elem_t;
+
+#endif
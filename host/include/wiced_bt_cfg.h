@@ -0,0 +1,20 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef WICED_BT_CFG_H
+#define WICED_BT_CFG_H
+
+#include "wiced_bt_types.h"
+
+typedef struct
+{
+    uint16_t    appearance;
+} wiced_bt_cfg_gatt_t;
+
+typedef struct
+{
+    uint8_t             *device_name;
+    wiced_bt_cfg_gatt_t gatt_cfg;
+} wiced_bt_cfg_settings_t;
+
+#endif
@@ -0,0 +1,9 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef WICED_BT_GATT_H
+#define WICED_BT_GATT_H
+
+#include "wiced_bt_types.h"
+
+#endif
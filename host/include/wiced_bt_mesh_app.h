@@ -0,0 +1,53 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. The functions are implemented
+ * by the mesh application library, host/stubs.c provides them for the host build.
+ */
+#ifndef WICED_BT_MESH_APP_H
+#define WICED_BT_MESH_APP_H
+
+#include "wiced_bt_types.h"
+#include "wiced_bt_mesh_core.h"
+#include "wiced_bt_ble.h"
+
+/*
+ * Event sent over the transport. Header is followed by the event specific data.
+ */
+typedef struct
+{
+    uint16_t    src;
+    uint16_t    app_key_idx;
+    uint8_t     element_idx;
+    uint8_t     data[1];
+} PACKED wiced_bt_mesh_hci_event_t;
+
+typedef void (*wiced_bt_mesh_app_init_t)(wiced_bool_t is_provisioned);
+typedef void (*wiced_bt_mesh_app_hardware_init_t)(void);
+typedef void (*wiced_bt_mesh_app_gatt_conn_status_t)(void *p_status);
+typedef void (*wiced_bt_mesh_app_attention_t)(uint8_t element_idx, uint8_t time);
+typedef void (*wiced_bt_mesh_app_notify_period_set_t)(uint8_t element_idx, uint16_t company_id, uint16_t model_id, uint32_t period);
+typedef uint32_t (*wiced_bt_mesh_app_proc_rx_cmd_t)(uint16_t opcode, uint8_t *p_data, uint32_t length);
+typedef uint32_t (*wiced_bt_mesh_app_lpn_sleep_t)(uint32_t max_sleep_duration);
+typedef void (*wiced_bt_mesh_app_factory_reset_t)(void);
+
+typedef struct
+{
+    wiced_bt_mesh_app_init_t                p_mesh_app_init;
+    wiced_bt_mesh_app_hardware_init_t       p_mesh_app_hw_init;
+    wiced_bt_mesh_app_gatt_conn_status_t    p_mesh_app_gatt_conn_status;
+    wiced_bt_mesh_app_attention_t           p_mesh_app_attention;
+    wiced_bt_mesh_app_notify_period_set_t   p_mesh_app_notify_period_set;
+    wiced_bt_mesh_app_proc_rx_cmd_t         p_mesh_app_proc_rx_cmd;
+    wiced_bt_mesh_app_lpn_sleep_t           p_mesh_app_lpn_sleep;
+    wiced_bt_mesh_app_factory_reset_t       p_mesh_app_factory_reset;
+} wiced_bt_mesh_app_func_table_t;
+
+wiced_bt_mesh_event_t *wiced_bt_mesh_create_event(uint8_t element_idx, uint16_t company_id, uint16_t model_id, uint16_t dst, uint16_t app_key_idx);
+wiced_bt_mesh_event_t *wiced_bt_mesh_create_event_from_wiced_hci(uint16_t hci_opcode, uint16_t company_id, uint16_t model_id, uint8_t **p_data, uint32_t *len);
+void wiced_bt_mesh_release_event(wiced_bt_mesh_event_t *p_event);
+wiced_bt_mesh_hci_event_t *wiced_bt_mesh_create_hci_event(wiced_bt_mesh_event_t *p_event);
+void wiced_bt_mesh_send_hci_tx_complete(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_event_t *p_event);
+void mesh_transport_send_data(uint16_t opcode, uint8_t *p_data, uint16_t length);
+void wiced_bt_mesh_set_raw_scan_response_data(uint8_t num_elem, wiced_bt_ble_advert_elem_t *p_adv);
+void wiced_bt_mesh_remote_provisioning_server_init(void);
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Only the declarations used by
+ * the application sources are provided, values are not the ones of the SDK.
+ */
+#ifndef WICED_BT_MESH_CLIENT_H
+#define WICED_BT_MESH_CLIENT_H
+
+#include "wiced_bt_types.h"
+#include "wiced_bt_mesh_core.h"
+
+#define CONNECT_TYPE_NET_ID     0
+#define CONNECT_TYPE_NODE_ID    1
+#define CONNECT_TYPE_BDADDR     2
+
+typedef struct
+{
+    uint8_t                     connect_type;
+    uint16_t                    node_id;
+    wiced_bt_device_address_t   bd_addr;
+    uint8_t                     bd_addr_type;
+    uint8_t                     scan_duration;
+} wiced_bt_mesh_proxy_connect_data_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t   bd_addr;
+    uint8_t                     bd_addr_type;
+    int8_t                      rssi;
+    uint16_t                    net_key_idx;
+} wiced_bt_mesh_proxy_device_network_data_t;
+
+typedef struct
+{
+    uint8_t     type;
+} wiced_bt_mesh_proxy_filter_set_type_data_t;
+
+typedef struct
+{
+    uint16_t    addr_num;
+    uint16_t    addr[1];
+} wiced_bt_mesh_proxy_filter_change_addr_data_t;
+
+typedef struct
+{
+    uint8_t     type;
+    uint16_t    list_size;
+} wiced_bt_mesh_proxy_filter_status_data_t;
+
+typedef void (wiced_bt_mesh_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+
+void wiced_bt_mesh_client_init(wiced_bt_mesh_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+void wiced_bt_mesh_proxy_client_init(wiced_bt_mesh_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+void wiced_bt_mesh_client_search_proxy(uint8_t start);
+wiced_bool_t wiced_bt_mesh_client_proxy_connect(wiced_bt_mesh_proxy_connect_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_client_proxy_disconnect(void);
+wiced_bool_t wiced_bt_mesh_proxy_set_filter_type(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_proxy_filter_set_type_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_proxy_filter_change_addr(wiced_bt_mesh_event_t *p_event, wiced_bool_t is_add, wiced_bt_mesh_proxy_filter_change_addr_data_t *p_data);
+
+#endif
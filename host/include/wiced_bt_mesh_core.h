@@ -0,0 +1,154 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Only the declarations used by
+ * the application sources are provided, values are not the ones of the SDK.
+ */
+#ifndef WICED_BT_MESH_CORE_H
+#define WICED_BT_MESH_CORE_H
+
+#include "wiced_bt_types.h"
+
+#define MESH_COMPANY_ID_UNUSED                          0xFFFF
+#define MESH_COMPANY_ID_BT_SIG                          0x0000
+#define MESH_COMPANY_ID_CYPRESS                         0x0131
+
+#define MESH_DEVICE_UUID_LEN                            16
+#define WICED_BT_MESH_KEY_LEN                           16
+#define MESH_ELEM_LOC_MAIN                              0x0100
+#define MESH_DEFAULT_TRANSITION_TIME_IN_MS              0
+#define WICED_BT_MESH_ON_POWER_UP_STATE_RESTORE         2
+#define MULTI_ADV_TX_POWER_MAX                          4
+#define APPEARANCE_GENERIC_TAG                          512
+
+#define WICED_BT_MESH_CORE_MODEL_ID_CONFIG_SRV          0x0000
+#define WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT         0x0001
+#define WICED_BT_MESH_CORE_MODEL_ID_HEALTH_SRV          0x0002
+#define WICED_BT_MESH_CORE_MODEL_ID_HEALTH_CLNT         0x0003
+#define WICED_BT_MESH_CORE_MODEL_ID_REMOTE_PROVISION_SRV  0x0004
+#define WICED_BT_MESH_CORE_MODEL_ID_REMOTE_PROVISION_CLNT 0x0005
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_ONOFF_SRV   0x1000
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_ONOFF_CLNT  0x1001
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LEVEL_SRV   0x1002
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LEVEL_CLNT  0x1003
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_DEFTT_SRV   0x1004
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_DEFTT_CLNT  0x1005
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_ONOFF_SRV   0x1006
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_ONOFF_SETUP_SRV 0x1007
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_ONOFF_CLNT  0x1008
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_LEVEL_CLNT  0x100B
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_BATTERY_CLNT      0x100D
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LOCATION_CLNT     0x1010
+#define WICED_BT_MESH_CORE_MODEL_ID_GENERIC_PROPERTY_CLNT     0x1015
+#define WICED_BT_MESH_CORE_MODEL_ID_SENSOR_CLNT               0x1102
+#define WICED_BT_MESH_CORE_MODEL_ID_TIME_CLNT                 0x1202
+#define WICED_BT_MESH_CORE_MODEL_ID_SCENE_CLNT                0x1205
+#define WICED_BT_MESH_CORE_MODEL_ID_SCHEDULER_CLNT            0x1208
+#define WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LIGHTNESS_CLNT      0x1302
+#define WICED_BT_MESH_CORE_MODEL_ID_LIGHT_CTL_CLNT            0x1305
+#define WICED_BT_MESH_CORE_MODEL_ID_LIGHT_HSL_CLNT            0x1309
+#define WICED_BT_MESH_CORE_MODEL_ID_LIGHT_XYL_CLNT            0x130E
+#define WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LC_CLNT             0x1311
+
+#define WICED_BT_MESH_CORE_TRACE_FID_ALL                0xFF
+#define WICED_BT_MESH_CORE_TRACE_FID_CORE_AES_CCM       0x01
+#define WICED_BT_MESH_CORE_TRACE_DEBUG                  0
+#define WICED_BT_MESH_CORE_TRACE_INFO                   1
+
+/*
+ * Status of the transmission reported with the event
+ */
+typedef struct
+{
+    uint8_t     tx_flag;
+    uint8_t     rpl_delay;
+} wiced_bt_mesh_event_status_t;
+
+/*
+ * Mesh event. Allocated by wiced_bt_mesh_create_event and wiced_bt_mesh_create_event_from_wiced_hci,
+ * released by wiced_bt_mesh_release_event.
+ */
+typedef struct
+{
+    uint16_t    opcode;
+    uint8_t     element_idx;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    src;
+    uint16_t    dst;
+    uint16_t    app_key_idx;
+    uint8_t     ttl;
+    uint8_t     credential_flag;
+    uint8_t     retrans_cnt;
+    uint8_t     retrans_time;
+    uint16_t    reply_timeout;
+    uint8_t     reply;
+    uint16_t    hci_opcode;
+    wiced_bt_mesh_event_status_t status;
+} wiced_bt_mesh_event_t;
+
+typedef void (wiced_bt_mesh_core_send_complete_callback_t)(wiced_bt_mesh_event_t *p_event);
+typedef wiced_bool_t (*wiced_bt_mesh_core_received_msg_handler_t)(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
+typedef wiced_bool_t (*wiced_bt_mesh_core_raw_msg_handler_t)(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
+
+typedef struct
+{
+    uint16_t                                    company_id;
+    uint16_t                                    model_id;
+    wiced_bt_mesh_core_received_msg_handler_t   p_message_handler;
+    void                                        *p_scene_store_handler;
+    void                                        *p_scene_recall_handler;
+} wiced_bt_mesh_core_config_model_t;
+
+typedef struct
+{
+    uint16_t                            location;
+    uint32_t                            default_transition_time;
+    uint8_t                             onpowerup_state;
+    uint16_t                            default_level;
+    uint16_t                            range_min;
+    uint16_t                            range_max;
+    uint8_t                             move_rollover;
+    uint8_t                             properties_num;
+    void                                *properties;
+    uint8_t                             sensors_num;
+    void                                *sensors;
+    uint8_t                             models_num;
+    wiced_bt_mesh_core_config_model_t   *models;
+} wiced_bt_mesh_core_config_element_t;
+
+typedef struct
+{
+    uint16_t    receive_window;
+    uint16_t    cache_buf_len;
+    uint16_t    max_lpn_num;
+} wiced_bt_mesh_core_config_friend_t;
+
+typedef struct
+{
+    uint8_t     rssi_factor;
+    uint8_t     receive_window_factor;
+    uint8_t     min_cache_size_log;
+    uint8_t     receive_delay;
+    uint32_t    poll_timeout;
+} wiced_bt_mesh_core_config_low_power_t;
+
+typedef struct
+{
+    uint16_t                                company_id;
+    uint16_t                                product_id;
+    uint16_t                                vendor_id;
+    uint16_t                                features;
+    wiced_bt_mesh_core_config_friend_t      friend_cfg;
+    wiced_bt_mesh_core_config_low_power_t   low_power;
+    wiced_bool_t                            gatt_client_only;
+    uint8_t                                 elements_num;
+    wiced_bt_mesh_core_config_element_t     *elements;
+} wiced_bt_mesh_core_config_t;
+
+extern uint8_t wiced_bt_mesh_core_adv_tx_power;
+
+uint64_t wiced_bt_mesh_core_get_tick_count(void);
+uint16_t wiced_bt_mesh_core_get_local_addr(void);
+wiced_result_t wiced_bt_mesh_core_send(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len, wiced_bt_mesh_core_send_complete_callback_t *complete_callback);
+void wiced_bt_mesh_core_set_trace_level(uint32_t fid_mask, uint8_t level);
+
+#endif
@@ -0,0 +1,9 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef WICED_BT_MESH_EVENT_H
+#define WICED_BT_MESH_EVENT_H
+
+#include "wiced_bt_mesh_core.h"
+
+#endif
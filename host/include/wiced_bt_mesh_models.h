@@ -0,0 +1,1377 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Only the declarations used by
+ * the application sources are provided, values are not the ones of the SDK.
+ */
+#ifndef WICED_BT_MESH_MODELS_H
+#define WICED_BT_MESH_MODELS_H
+
+#include "wiced_bt_types.h"
+#include "wiced_bt_mesh_core.h"
+
+/*
+ * Events reported to the configuration client callback
+ */
+#define WICED_BT_MESH_TX_COMPLETE                               0
+#define WICED_BT_MESH_CONFIG_NODE_RESET_STATUS                  1
+#define WICED_BT_MESH_CONFIG_BEACON_STATUS                      2
+#define WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS            3
+#define WICED_BT_MESH_CONFIG_FRIEND_STATUS                      4
+#define WICED_BT_MESH_CONFIG_GATT_PROXY_STATUS                  5
+#define WICED_BT_MESH_CONFIG_RELAY_STATUS                       6
+#define WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS                 7
+#define WICED_BT_MESH_CONFIG_NODE_IDENTITY_STATUS               8
+#define WICED_BT_MESH_CONFIG_MODEL_PUBLICATION_STATUS           9
+#define WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS          10
+#define WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_LIST            11
+#define WICED_BT_MESH_CONFIG_NETKEY_STATUS                      12
+#define WICED_BT_MESH_CONFIG_NETKEY_LIST                        13
+#define WICED_BT_MESH_CONFIG_APPKEY_STATUS                      14
+#define WICED_BT_MESH_CONFIG_APPKEY_LIST                        15
+#define WICED_BT_MESH_CONFIG_MODEL_APP_BIND_STATUS              16
+#define WICED_BT_MESH_CONFIG_MODEL_APP_BIND_LIST                17
+#define WICED_BT_MESH_CONFIG_HEARBEAT_SUBSCRIPTION_STATUS       18
+#define WICED_BT_MESH_CONFIG_HEARBEAT_PUBLICATION_STATUS        19
+#define WICED_BT_MESH_CONFIG_NETWORK_TRANSMIT_STATUS            20
+#define WICED_BT_MESH_CONFIG_KEY_REFRESH_PHASE_STATUS           21
+#define WICED_BT_MESH_CONFIG_LPN_POLL_TIMEOUT_STATUS            22
+#define WICED_BT_MESH_HEALTH_CURRENT_STATUS                     23
+#define WICED_BT_MESH_HEALTH_FAULT_STATUS                       24
+#define WICED_BT_MESH_HEALTH_PERIOD_STATUS                      25
+#define WICED_BT_MESH_HEALTH_ATTENTION_STATUS                   26
+#define WICED_BT_MESH_DEFAULT_TRANSITION_TIME_STATUS            27
+
+/*
+ * Events reported to the model client callbacks
+ */
+#define WICED_BT_MESH_ONOFF_STATUS                              28
+#define WICED_BT_MESH_LEVEL_STATUS                              29
+#define WICED_BT_MESH_POWER_ONOFF_ONPOWERUP_STATUS              30
+#define WICED_BT_MESH_POWER_LEVEL_STATUS                        31
+#define WICED_BT_MESH_POWER_LEVEL_LAST_STATUS                   32
+#define WICED_BT_MESH_POWER_LEVEL_DEFAULT_STATUS                33
+#define WICED_BT_MESH_POWER_LEVEL_RANGE_STATUS                  34
+#define WICED_BT_MESH_BATTERY_STATUS                            35
+#define WICED_BT_MESH_LOCATION_GLOBAL_STATUS                    36
+#define WICED_BT_MESH_LOCATION_LOCAL_STATUS                     37
+#define WICED_BT_MESH_USER_PROPERTIES_STATUS                    38
+#define WICED_BT_MESH_ADMIN_PROPERTIES_STATUS                   39
+#define WICED_BT_MESH_MANUF_PROPERTIES_STATUS                   40
+#define WICED_BT_MESH_CLIENT_PROPERTIES_STATUS                  41
+#define WICED_BT_MESH_USER_PROPERTY_STATUS                      42
+#define WICED_BT_MESH_ADMIN_PROPERTY_STATUS                     43
+#define WICED_BT_MESH_MANUF_PROPERTY_STATUS                     44
+#define WICED_BT_MESH_SENSOR_DESCRIPTOR_STATUS                  45
+#define WICED_BT_MESH_SENSOR_STATUS                             46
+#define WICED_BT_MESH_SENSOR_COLUMN_STATUS                      47
+#define WICED_BT_MESH_SENSOR_SERIES_STATUS                      48
+#define WICED_BT_MESH_SENSOR_CADENCE_STATUS                     49
+#define WICED_BT_MESH_SENSOR_SETTINGS_STATUS                    50
+#define WICED_BT_MESH_SENSOR_SETTING_STATUS                     51
+#define WICED_BT_MESH_TIME_STATUS                               52
+#define WICED_BT_MESH_TIME_ZONE_STATUS                          53
+#define WICED_BT_MESH_TAI_UTC_DELTA_STATUS                      54
+#define WICED_BT_MESH_TIME_ROLE_STATUS                          55
+#define WICED_BT_MESH_SCENE_STATUS                              56
+#define WICED_BT_MESH_SCENE_REGISTER_STATUS                     57
+#define WICED_BT_MESH_SCHEDULER_STATUS                          58
+#define WICED_BT_MESH_SCHEDULER_ACTION_STATUS                   59
+#define WICED_BT_MESH_LIGHT_LIGHTNESS_STATUS                    60
+#define WICED_BT_MESH_LIGHT_LIGHTNESS_LINEAR_STATUS             61
+#define WICED_BT_MESH_LIGHT_LIGHTNESS_LAST_STATUS               62
+#define WICED_BT_MESH_LIGHT_LIGHTNESS_DEFAULT_STATUS            63
+#define WICED_BT_MESH_LIGHT_LIGHTNESS_RANGE_STATUS              64
+#define WICED_BT_MESH_LIGHT_CTL_STATUS                          65
+#define WICED_BT_MESH_LIGHT_CTL_TEMPERATURE_STATUS              66
+#define WICED_BT_MESH_LIGHT_CTL_TEMPERATURE_RANGE_STATUS        67
+#define WICED_BT_MESH_LIGHT_CTL_DEFAULT_STATUS                  68
+#define WICED_BT_MESH_LIGHT_HSL_STATUS                          69
+#define WICED_BT_MESH_LIGHT_HSL_TARGET_STATUS                   70
+#define WICED_BT_MESH_LIGHT_HSL_RANGE_STATUS                    71
+#define WICED_BT_MESH_LIGHT_HSL_DEFAULT_STATUS                  72
+#define WICED_BT_MESH_LIGHT_HSL_HUE_STATUS                      73
+#define WICED_BT_MESH_LIGHT_HSL_SATURATION_STATUS               74
+#define WICED_BT_MESH_LIGHT_XYL_STATUS                          75
+#define WICED_BT_MESH_LIGHT_XYL_TARGET_STATUS                   76
+#define WICED_BT_MESH_LIGHT_XYL_RANGE_STATUS                    77
+#define WICED_BT_MESH_LIGHT_XYL_DEFAULT_STATUS                  78
+#define WICED_BT_MESH_LIGHT_LC_MODE_STATUS                      79
+#define WICED_BT_MESH_LIGHT_LC_OCCUPANCY_MODE_STATUS            80
+#define WICED_BT_MESH_LIGHT_LC_LIGHT_ONOFF_STATUS               81
+#define WICED_BT_MESH_LIGHT_LC_PROPERTY_STATUS                  82
+
+#define OPERATION_ADD           0
+#define OPERATION_DELETE        1
+#define OPERATION_OVERWRITE     2
+#define OPERATION_DELETE_ALL    3
+#define OPERATION_GET           4
+#define OPERATION_UPDATE        5
+#define OPERATION_BIND          6
+#define OPERATION_UNBIND        7
+
+#define WICED_BT_MESH_CONFIG_MAX_KEYS                           32
+#define WICED_BT_MESH_CONFIG_MAX_ADDRS                          32
+#define WICED_BT_MESH_HEALTH_MAX_FAULTS                         32
+
+#define WICED_BT_MESH_PROPERTY_LEN_DEVICE_MANUFACTURER_NAME     36
+#define WICED_BT_MESH_PROPERTY_LEN_DEVICE_MODEL_NUMBER          24
+#define WICED_BT_MESH_MAX_PROPERTY_VALUE_LEN                    36
+#define WICED_BT_MESH_PROPERTY_TYPE_USER                        1
+#define WICED_BT_MESH_PROPERTY_TYPE_ADMIN                       2
+#define WICED_BT_MESH_PROPERTY_TYPE_MANUFACTURER                3
+#define WICED_BT_MESH_PROPERTY_TYPE_CLIENT                      4
+#define WICED_BT_MESH_MAX_PROPERTIES                            32
+#define WICED_BT_MESH_MAX_SENSOR_DESCRIPTORS                    8
+#define WICED_BT_MESH_MAX_SENSOR_SETTINGS                       8
+#define WICED_BT_MESH_MAX_SENSOR_COLUMNS                        8
+#define WICED_BT_MESH_MAX_SENSOR_VALUE_LEN                      8
+#define WICED_BT_MESH_MAX_SCENES                                16
+
+#define WICED_BT_MESH_SCENE_REQUEST_TYPE_GET                    0
+#define WICED_BT_MESH_SCENE_REQUEST_TYPE_STORE                  1
+#define WICED_BT_MESH_SCENE_REQUEST_TYPE_DELETE                 2
+
+/*
+ * Models of the element, each is an initializer of wiced_bt_mesh_core_config_model_t
+ */
+#define WICED_BT_MESH_DEVICE                                { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_SRV, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_CONFIG_CLIENT                   { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_HEALTH_CLIENT                   { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_HEALTH_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_REMOTE_PROVISION_SERVER         { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_REMOTE_PROVISION_SRV, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_REMOTE_PROVISION_CLIENT         { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_REMOTE_PROVISION_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_DEFAULT_TRANSITION_TIME_CLIENT  { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_DEFTT_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_ONOFF_CLIENT                    { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_ONOFF_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LEVEL_CLIENT                    { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LEVEL_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_POWER_ONOFF_CLIENT              { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_ONOFF_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_POWER_LEVEL_CLIENT              { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_LEVEL_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_BATTERY_CLIENT                  { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_BATTERY_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LOCATION_CLIENT                 { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LOCATION_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_PROPERTY_CLIENT                 { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_GENERIC_PROPERTY_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_SENSOR_CLIENT                   { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_SENSOR_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_TIME_CLIENT                     { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_TIME_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_SCENE_CLIENT                    { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_SCENE_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_SCHEDULER_CLIENT                { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_SCHEDULER_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LIGHT_LIGHTNESS_CLIENT          { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LIGHTNESS_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LIGHT_CTL_CLIENT                { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_LIGHT_CTL_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LIGHT_HSL_CLIENT                { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_LIGHT_HSL_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LIGHT_XYL_CLIENT                { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_LIGHT_XYL_CLNT, NULL, NULL, NULL }
+#define WICED_BT_MESH_MODEL_LIGHT_LC_CLIENT                 { MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LC_CLNT, NULL, NULL, NULL }
+
+typedef void (wiced_bt_mesh_config_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_health_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_default_transition_time_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+
+/*
+ * Configuration client commands
+ */
+typedef struct
+{
+    uint8_t     page_number;
+} wiced_bt_mesh_config_composition_data_get_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_beacon_set_data_t;
+
+typedef struct
+{
+    uint8_t     ttl;
+} wiced_bt_mesh_config_default_ttl_set_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_gatt_proxy_set_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_friend_set_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+    uint8_t     retransmit_count;
+    uint16_t    retransmit_interval;
+} wiced_bt_mesh_config_relay_set_data_t;
+
+typedef struct
+{
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_node_identity_get_data_t;
+
+typedef struct
+{
+    uint16_t    net_key_idx;
+    uint8_t     identity;
+} wiced_bt_mesh_config_node_identity_set_data_t;
+
+typedef struct
+{
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+} wiced_bt_mesh_config_model_publication_get_data_t;
+
+typedef struct
+{
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint8_t     publish_addr[16];
+    uint16_t    app_key_idx;
+    uint8_t     credential_flag;
+    uint8_t     publish_ttl;
+    uint32_t    publish_period;
+    uint8_t     publish_retransmit_count;
+    uint16_t    publish_retransmit_interval;
+} wiced_bt_mesh_config_model_publication_set_data_t;
+
+typedef struct
+{
+    uint8_t     operation;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint8_t     addr[16];
+} wiced_bt_mesh_config_model_subscription_change_data_t;
+
+typedef struct
+{
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+} wiced_bt_mesh_config_model_subscription_get_data_t;
+
+typedef struct
+{
+    uint8_t     operation;
+    uint16_t    net_key_idx;
+    uint8_t     net_key[WICED_BT_MESH_KEY_LEN];
+} wiced_bt_mesh_config_netkey_change_data_t;
+
+typedef struct
+{
+    uint8_t     operation;
+    uint16_t    net_key_idx;
+    uint16_t    app_key_idx;
+    uint8_t     app_key[WICED_BT_MESH_KEY_LEN];
+} wiced_bt_mesh_config_appkey_change_data_t;
+
+typedef struct
+{
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_appkey_get_data_t;
+
+typedef struct
+{
+    uint8_t     operation;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    app_key_idx;
+} wiced_bt_mesh_config_model_app_bind_data_t;
+
+typedef struct
+{
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+} wiced_bt_mesh_config_model_app_get_data_t;
+
+typedef struct
+{
+    uint16_t    subscription_src;
+    uint16_t    subscription_dst;
+    uint32_t    period;
+} wiced_bt_mesh_config_heartbeat_subscription_set_data_t;
+
+typedef struct
+{
+    uint16_t    publication_dst;
+    uint32_t    count;
+    uint32_t    period;
+    uint8_t     ttl;
+    uint8_t     feature_relay;
+    uint8_t     feature_proxy;
+    uint8_t     feature_friend;
+    uint8_t     feature_low_power;
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_heartbeat_publication_set_data_t;
+
+typedef struct
+{
+    uint8_t     count;
+    uint16_t    interval;
+} wiced_bt_mesh_config_network_transmit_set_data_t;
+
+typedef struct
+{
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_key_refresh_phase_get_data_t;
+
+typedef struct
+{
+    uint16_t    net_key_idx;
+    uint8_t     transition;
+} wiced_bt_mesh_config_key_refresh_phase_set_data_t;
+
+typedef struct
+{
+    uint16_t    lpn_addr;
+} wiced_bt_mesh_lpn_poll_timeout_get_data_t;
+
+/*
+ * Configuration client events
+ */
+typedef struct
+{
+    uint8_t     page_number;
+    uint16_t    data_len;
+    uint8_t     data[1];
+} wiced_bt_mesh_config_composition_data_status_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_beacon_status_data_t;
+
+typedef struct
+{
+    uint8_t     ttl;
+} wiced_bt_mesh_config_default_ttl_status_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_gatt_proxy_status_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+} wiced_bt_mesh_config_friend_status_data_t;
+
+typedef struct
+{
+    uint8_t     state;
+    uint8_t     retransmit_count;
+    uint16_t    retransmit_interval;
+} wiced_bt_mesh_config_relay_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    net_key_idx;
+    uint8_t     identity;
+} wiced_bt_mesh_config_node_identity_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    publish_addr;
+    uint16_t    app_key_idx;
+    uint8_t     credential_flag;
+    uint8_t     publish_ttl;
+    uint32_t    publish_period;
+    uint8_t     publish_retransmit_count;
+    uint16_t    publish_retransmit_interval;
+} wiced_bt_mesh_config_model_publication_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    addr;
+} wiced_bt_mesh_config_model_subscription_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    num_addr;
+    uint16_t    addr[WICED_BT_MESH_CONFIG_MAX_ADDRS];
+} wiced_bt_mesh_config_model_subscription_list_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_netkey_status_data_t;
+
+typedef struct
+{
+    uint8_t     num_keys;
+    uint16_t    net_key_idx[WICED_BT_MESH_CONFIG_MAX_KEYS];
+} wiced_bt_mesh_config_netkey_list_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    net_key_idx;
+    uint16_t    app_key_idx;
+} wiced_bt_mesh_config_appkey_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    net_key_idx;
+    uint8_t     num_keys;
+    uint16_t    app_key_idx[WICED_BT_MESH_CONFIG_MAX_KEYS];
+} wiced_bt_mesh_config_appkey_list_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint16_t    app_key_idx;
+} wiced_bt_mesh_config_model_app_bind_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    element_addr;
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint8_t     num_keys;
+    uint16_t    app_key_idx[WICED_BT_MESH_CONFIG_MAX_KEYS];
+} wiced_bt_mesh_config_model_app_list_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    subscription_src;
+    uint16_t    subscription_dst;
+    uint32_t    period;
+    uint32_t    count;
+    uint8_t     min_hops;
+    uint8_t     max_hops;
+} wiced_bt_mesh_config_heartbeat_subscription_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    publication_dst;
+    uint32_t    count;
+    uint32_t    period;
+    uint8_t     ttl;
+    uint8_t     feature_relay;
+    uint8_t     feature_proxy;
+    uint8_t     feature_friend;
+    uint8_t     feature_low_power;
+    uint16_t    net_key_idx;
+} wiced_bt_mesh_config_heartbeat_publication_status_data_t;
+
+typedef struct
+{
+    uint8_t     count;
+    uint16_t    interval;
+} wiced_bt_mesh_config_network_transmit_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    net_key_idx;
+    uint8_t     phase;
+} wiced_bt_mesh_config_key_refresh_phase_status_data_t;
+
+typedef struct
+{
+    uint16_t    lpn_addr;
+    uint32_t    poll_timeout;
+} wiced_bt_mesh_lpn_poll_timeout_status_data_t;
+
+/*
+ * Health client
+ */
+typedef struct
+{
+    uint16_t    company_id;
+} wiced_bt_mesh_health_fault_get_data_t;
+
+typedef wiced_bt_mesh_health_fault_get_data_t wiced_bt_mesh_health_fault_clear_data_t;
+
+typedef struct
+{
+    uint8_t     id;
+    uint16_t    company_id;
+} wiced_bt_mesh_health_fault_test_data_t;
+
+typedef struct
+{
+    uint8_t     divisor;
+} wiced_bt_mesh_health_period_set_data_t;
+
+typedef struct
+{
+    uint8_t     timer;
+} wiced_bt_mesh_health_attention_set_data_t;
+
+typedef struct
+{
+    uint16_t    app_key_idx;
+    uint8_t     test_id;
+    uint16_t    company_id;
+    uint8_t     count;
+    uint8_t     fault_array[WICED_BT_MESH_HEALTH_MAX_FAULTS];
+} wiced_bt_mesh_health_fault_status_data_t;
+
+typedef struct
+{
+    uint16_t    app_key_idx;
+    uint8_t     divisor;
+} wiced_bt_mesh_health_period_status_data_t;
+
+typedef struct
+{
+    uint8_t     timer;
+} wiced_bt_mesh_health_attention_status_data_t;
+
+/*
+ * Default transition time client
+ */
+typedef struct
+{
+    uint32_t    time;
+} wiced_bt_mesh_default_transition_time_data_t;
+
+/*
+ * Generic OnOff client
+ */
+typedef struct
+{
+    uint8_t     onoff;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_onoff_set_data_t;
+
+typedef struct
+{
+    uint8_t     present_onoff;
+    uint8_t     target_onoff;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_onoff_status_data_t;
+
+/*
+ * Generic Level client
+ */
+typedef struct
+{
+    int16_t     level;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_level_set_level_t;
+
+typedef struct
+{
+    int32_t     delta;
+    uint8_t     continuation;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_level_set_delta_t;
+
+typedef struct
+{
+    int16_t     delta;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_level_set_move_t;
+
+typedef struct
+{
+    int16_t     present_level;
+    int16_t     target_level;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_level_status_data_t;
+
+/*
+ * Generic Power OnOff client
+ */
+typedef struct
+{
+    uint8_t     on_power_up;
+} wiced_bt_mesh_power_onoff_data_t;
+
+/*
+ * Generic Power Level client
+ */
+typedef struct
+{
+    uint16_t    level;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_power_level_set_level_t;
+
+typedef struct
+{
+    uint16_t    present_power;
+    uint16_t    target_power;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_power_level_status_data_t;
+
+typedef struct
+{
+    uint16_t    power;
+} wiced_bt_mesh_power_level_last_data_t;
+
+typedef struct
+{
+    uint16_t    power;
+} wiced_bt_mesh_power_default_data_t;
+
+typedef struct
+{
+    uint16_t    power_min;
+    uint16_t    power_max;
+} wiced_bt_mesh_power_level_range_set_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    power_min;
+    uint16_t    power_max;
+} wiced_bt_mesh_power_range_status_data_t;
+
+/*
+ * Generic Battery client
+ */
+typedef struct
+{
+    uint8_t     battery_level;
+    uint32_t    time_to_discharge;
+    uint32_t    time_to_charge;
+    uint8_t     presence;
+    uint8_t     level_inidicator;
+    uint8_t     charging;
+    uint8_t     servicability;
+} mesh_battery_event_t;
+
+/*
+ * Generic Location client
+ */
+typedef struct
+{
+    int32_t     global_latitude;
+    int32_t     global_longitude;
+    int16_t     global_altitude;
+} wiced_bt_mesh_location_global_data_t;
+
+typedef struct
+{
+    int16_t     local_north;
+    int16_t     local_east;
+    int16_t     local_altitude;
+    uint8_t     floor_number;
+    uint8_t     is_mobile;
+    uint8_t     update_time;
+    uint8_t     precision;
+} wiced_bt_mesh_location_local_data_t;
+
+/*
+ * Generic Property client
+ */
+typedef struct
+{
+    uint8_t     type;
+    uint16_t    starting_id;
+} wiced_bt_mesh_properties_get_data_t;
+
+typedef struct
+{
+    uint8_t     type;
+    uint8_t     properties_num;
+    uint16_t    id[WICED_BT_MESH_MAX_PROPERTIES];
+} wiced_bt_mesh_properties_status_data_t;
+
+typedef struct
+{
+    uint8_t     type;
+    uint16_t    id;
+} wiced_bt_mesh_property_get_data_t;
+
+typedef struct
+{
+    uint8_t     type;
+    uint16_t    id;
+    uint8_t     access;
+    uint16_t    len;
+    uint8_t     value[WICED_BT_MESH_MAX_PROPERTY_VALUE_LEN];
+} wiced_bt_mesh_property_set_data_t;
+
+typedef wiced_bt_mesh_property_set_data_t wiced_bt_mesh_property_status_data_t;
+
+/*
+ * Sensor client
+ */
+typedef struct
+{
+    uint16_t    property_id;
+} wiced_bt_mesh_sensor_get_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint16_t    positive_tolerance;
+    uint16_t    negative_tolerance;
+    uint8_t     sampling_function;
+    uint8_t     measurement_period;
+    uint8_t     update_interval;
+} wiced_bt_mesh_sensor_descriptor_data_t;
+
+typedef struct
+{
+    uint8_t                                 num_descriptors;
+    wiced_bt_mesh_sensor_descriptor_data_t  descriptor_list[WICED_BT_MESH_MAX_SENSOR_DESCRIPTORS];
+} wiced_bt_mesh_sensor_descriptor_status_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint8_t     prop_value_len;
+    uint8_t     raw_value[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_status_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint8_t     prop_value_len;
+    uint8_t     raw_valuex[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_column_get_data_t;
+
+typedef struct
+{
+    uint8_t     raw_valuex[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+    uint8_t     column_width[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+    uint8_t     raw_valuey[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_column_data_t;
+
+typedef struct
+{
+    uint16_t                            property_id;
+    uint8_t                             prop_value_len;
+    wiced_bt_mesh_sensor_column_data_t  column_data;
+} wiced_bt_mesh_sensor_column_status_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint8_t     prop_value_len;
+    uint8_t     start_index;
+    uint8_t     end_index;
+    uint8_t     raw_valuex1[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+    uint8_t     raw_valuex2[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_series_get_data_t;
+
+typedef struct
+{
+    uint16_t                            property_id;
+    uint8_t                             prop_value_len;
+    uint8_t                             no_of_columns;
+    wiced_bt_mesh_sensor_column_data_t  column_list[WICED_BT_MESH_MAX_SENSOR_COLUMNS];
+} wiced_bt_mesh_sensor_series_status_data_t;
+
+typedef struct
+{
+    uint16_t    fast_cadence_period_divisor;
+    uint8_t     trigger_type;
+    uint32_t    trigger_delta_down;
+    uint32_t    trigger_delta_up;
+    uint32_t    min_interval;
+    uint32_t    fast_cadence_low;
+    uint32_t    fast_cadence_high;
+} wiced_bt_mesh_sensor_cadence_t;
+
+typedef struct
+{
+    uint16_t                        property_id;
+    uint8_t                         prop_value_len;
+    wiced_bt_mesh_sensor_cadence_t  cadence_data;
+} wiced_bt_mesh_sensor_cadence_set_data_t;
+
+typedef struct
+{
+    uint16_t                        property_id;
+    uint8_t                         is_data_present;
+    uint8_t                         prop_value_len;
+    wiced_bt_mesh_sensor_cadence_t  cadence_data;
+} wiced_bt_mesh_sensor_cadence_status_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint16_t    setting_property_id;
+} wiced_bt_mesh_sensor_setting_get_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint16_t    setting_property_id;
+    uint8_t     prop_value_len;
+    uint8_t     setting_raw_val[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_setting_set_data_t;
+
+typedef struct
+{
+    uint16_t    setting_property_id;
+    uint8_t     access;
+    uint8_t     value_len;
+    uint8_t     val[WICED_BT_MESH_MAX_SENSOR_VALUE_LEN];
+} wiced_bt_mesh_sensor_setting_t;
+
+typedef struct
+{
+    uint16_t                        property_id;
+    wiced_bt_mesh_sensor_setting_t  setting;
+} wiced_bt_mesh_sensor_setting_status_data_t;
+
+typedef struct
+{
+    uint16_t    property_id;
+    uint8_t     num_setting_property_id;
+    uint16_t    setting_property_id_list[WICED_BT_MESH_MAX_SENSOR_SETTINGS];
+} wiced_bt_mesh_sensor_settings_status_data_t;
+
+/*
+ * Time client
+ */
+typedef struct
+{
+    uint64_t    tai_seconds;
+    uint8_t     subsecond;
+    uint8_t     uncertainty;
+    uint8_t     time_authority;
+    uint16_t    tai_utc_delta_current;
+    uint8_t     time_zone_offset_current;
+} wiced_bt_mesh_time_state_msg_t;
+
+typedef struct
+{
+    uint8_t     time_zone_offset_new;
+    uint64_t    tai_of_zone_change;
+} wiced_bt_mesh_time_zone_set_t;
+
+typedef struct
+{
+    uint8_t     time_zone_offset_current;
+    uint8_t     time_zone_offset_new;
+    uint64_t    tai_of_zone_change;
+} wiced_bt_mesh_time_zone_status_t;
+
+typedef struct
+{
+    uint16_t    tai_utc_delta_new;
+    uint64_t    tai_of_delta_change;
+} wiced_bt_mesh_time_tai_utc_delta_set_t;
+
+typedef struct
+{
+    uint16_t    tai_utc_delta_current;
+    uint16_t    tai_utc_delta_new;
+    uint64_t    tai_of_delta_change;
+} wiced_bt_mesh_time_tai_utc_delta_status_t;
+
+typedef struct
+{
+    uint8_t     role;
+} wiced_bt_mesh_time_role_msg_t;
+
+/*
+ * Scene client
+ */
+typedef struct
+{
+    uint8_t     type;
+    uint16_t    scene_number;
+} wiced_bt_mesh_scene_request_t;
+
+typedef struct
+{
+    uint16_t    scene_number;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_scene_recall_t;
+
+typedef struct
+{
+    uint8_t     status_code;
+    uint16_t    current_scene;
+    uint16_t    target_scene;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_scene_status_data_t;
+
+typedef struct
+{
+    uint8_t     status_code;
+    uint16_t    current_scene;
+    uint8_t     scene_num;
+    uint16_t    scene[WICED_BT_MESH_MAX_SCENES];
+} wiced_bt_mesh_scene_register_status_data_t;
+
+/*
+ * Scheduler client
+ */
+typedef struct
+{
+    uint16_t    actions;
+} wiced_bt_mesh_scheduler_status_t;
+
+typedef struct
+{
+    uint8_t     action_number;
+} wiced_bt_mesh_scheduler_action_get_t;
+
+typedef struct
+{
+    uint8_t     action_number;
+    uint8_t     year;
+    uint16_t    month;
+    uint8_t     day;
+    uint8_t     hour;
+    uint8_t     minute;
+    uint8_t     second;
+    uint8_t     day_of_week;
+    uint8_t     action;
+    uint32_t    transition_time;
+    uint16_t    scene_number;
+} wiced_bt_mesh_scheduler_action_data_t;
+
+/*
+ * Light Lightness client
+ */
+typedef struct
+{
+    uint16_t    lightness_actual;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_light_lightness_actual_set_t;
+
+typedef struct
+{
+    uint16_t    lightness_linear;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_light_lightness_linear_set_t;
+
+typedef struct
+{
+    uint16_t    present;
+    uint16_t    target;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_light_lightness_status_data_t;
+
+typedef struct
+{
+    uint16_t    last_level;
+} wiced_bt_mesh_light_lightness_last_data_t;
+
+typedef struct
+{
+    uint16_t    default_level;
+} wiced_bt_mesh_light_lightness_default_data_t;
+
+typedef struct
+{
+    uint16_t    min_level;
+    uint16_t    max_level;
+} wiced_bt_mesh_light_lightness_range_set_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    min_level;
+    uint16_t    max_level;
+} wiced_bt_mesh_light_lightness_range_status_data_t;
+
+/*
+ * Light CTL client
+ */
+typedef struct
+{
+    uint16_t    lightness;
+    uint16_t    temperature;
+    int16_t     delta_uv;
+} wiced_bt_mesh_light_ctl_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_ctl_data_t  target;
+    uint32_t                        transition_time;
+    uint16_t                        delay;
+} wiced_bt_mesh_light_ctl_set_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_ctl_data_t  present;
+    wiced_bt_mesh_light_ctl_data_t  target;
+    uint32_t                        remaining_time;
+} wiced_bt_mesh_light_ctl_status_data_t;
+
+typedef struct
+{
+    uint16_t    target_temperature;
+    int16_t     target_delta_uv;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_light_ctl_temperature_set_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_ctl_data_t  default_status;
+} wiced_bt_mesh_light_ctl_default_data_t;
+
+typedef struct
+{
+    uint16_t    min_level;
+    uint16_t    max_level;
+} wiced_bt_mesh_light_ctl_temperature_range_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    min_level;
+    uint16_t    max_level;
+} wiced_bt_mesh_light_ctl_temperature_range_status_data_t;
+
+/*
+ * Light HSL client
+ */
+typedef struct
+{
+    uint16_t    lightness;
+    uint16_t    hue;
+    uint16_t    saturation;
+} wiced_bt_mesh_light_hsl_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_hsl_data_t  target;
+    uint32_t                        transition_time;
+    uint16_t                        delay;
+} wiced_bt_mesh_light_hsl_set_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_hsl_data_t  present;
+    uint32_t                        remaining_time;
+} wiced_bt_mesh_light_hsl_status_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_hsl_data_t  target;
+    uint32_t                        remaining_time;
+} wiced_bt_mesh_light_hsl_target_status_data_t;
+
+typedef struct
+{
+    uint16_t    level;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_light_hsl_hue_set_t;
+
+typedef wiced_bt_mesh_light_hsl_hue_set_t wiced_bt_mesh_light_hsl_saturation_set_t;
+
+typedef struct
+{
+    uint16_t    present_hue;
+    uint16_t    target_hue;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_light_hsl_hue_status_data_t;
+
+typedef struct
+{
+    uint16_t    present_saturation;
+    uint16_t    target_saturation;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_light_hsl_saturation_status_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_hsl_data_t  default_status;
+} wiced_bt_mesh_light_hsl_default_data_t;
+
+typedef struct
+{
+    uint16_t    hue_min;
+    uint16_t    hue_max;
+    uint16_t    saturation_min;
+    uint16_t    saturation_max;
+} wiced_bt_mesh_light_hsl_range_set_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    hue_min;
+    uint16_t    hue_max;
+    uint16_t    saturation_min;
+    uint16_t    saturation_max;
+} wiced_bt_mesh_light_hsl_range_status_data_t;
+
+/*
+ * Light xyL client
+ */
+typedef struct
+{
+    uint16_t    lightness;
+    uint16_t    x;
+    uint16_t    y;
+} wiced_bt_mesh_light_xyl_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_xyl_data_t  target;
+    uint32_t                        transition_time;
+    uint16_t                        delay;
+} wiced_bt_mesh_light_xyl_set_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_xyl_data_t  present;
+    uint32_t                        remaining_time;
+} wiced_bt_mesh_light_xyl_status_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_xyl_data_t  target;
+    uint32_t                        remaining_time;
+} wiced_bt_mesh_light_xyl_target_status_data_t;
+
+typedef struct
+{
+    wiced_bt_mesh_light_xyl_data_t  default_status;
+} wiced_bt_mesh_light_xyl_default_data_t;
+
+typedef struct
+{
+    uint16_t    x_min;
+    uint16_t    x_max;
+    uint16_t    y_min;
+    uint16_t    y_max;
+} wiced_bt_mesh_light_xyl_range_set_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint16_t    x_min;
+    uint16_t    x_max;
+    uint16_t    y_min;
+    uint16_t    y_max;
+} wiced_bt_mesh_light_xyl_range_status_data_t;
+
+/*
+ * Light LC client
+ */
+typedef struct
+{
+    uint8_t     mode;
+} wiced_bt_mesh_light_lc_mode_set_data_t;
+
+typedef wiced_bt_mesh_light_lc_mode_set_data_t wiced_bt_mesh_light_lc_occupancy_mode_set_data_t;
+
+typedef struct
+{
+    uint8_t     light_onoff;
+    uint32_t    transition_time;
+    uint16_t    delay;
+} wiced_bt_mesh_light_lc_light_onoff_set_data_t;
+
+typedef struct
+{
+    uint8_t     present_onoff;
+    uint8_t     target_onoff;
+    uint32_t    remaining_time;
+} wiced_bt_mesh_light_lc_light_onoff_status_data_t;
+
+typedef struct
+{
+    uint16_t    id;
+} wiced_bt_mesh_light_lc_property_get_data_t;
+
+typedef struct
+{
+    uint16_t    id;
+    uint8_t     len;
+    uint8_t     value[WICED_BT_MESH_MAX_PROPERTY_VALUE_LEN];
+} wiced_bt_mesh_light_lc_property_set_data_t;
+
+typedef wiced_bt_mesh_light_lc_property_set_data_t wiced_bt_mesh_light_lc_property_status_data_t;
+
+typedef void (wiced_bt_mesh_battery_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, mesh_battery_event_t *p_data);
+typedef void (wiced_bt_mesh_level_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_level_status_data_t *p_data);
+typedef void (wiced_bt_mesh_light_ctl_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_light_hsl_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_light_lc_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_light_lightness_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_light_xyl_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_location_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_onoff_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_power_level_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_power_onoff_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_property_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_scene_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_scheduler_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_sensor_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+typedef void (wiced_bt_mesh_time_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+
+void wiced_bt_mesh_config_client_init(wiced_bt_mesh_config_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+void wiced_bt_mesh_health_client_init(wiced_bt_mesh_health_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+void wiced_bt_mesh_model_default_transition_time_client_init(uint8_t element_idx, wiced_bt_mesh_default_transition_time_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_default_transition_time_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_default_transition_time_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_default_transition_time_data_t *p_data);
+void wiced_bt_mesh_models_set_trace_level(uint8_t level);
+
+wiced_bool_t wiced_bt_mesh_config_node_reset(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_beacon_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_beacon_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_beacon_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_composition_data_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_composition_data_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_default_ttl_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_default_ttl_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_default_ttl_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_gatt_proxy_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_gatt_proxy_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_gatt_proxy_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_friend_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_friend_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_friend_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_relay_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_relay_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_relay_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_node_identity_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_node_identity_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_node_identity_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_node_identity_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_publication_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_publication_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_publication_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_publication_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_subscription_change(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_subscription_change_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_subscription_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_subscription_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_netkey_change(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_netkey_change_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_netkey_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_appkey_change(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_appkey_change_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_appkey_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_appkey_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_app_bind(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_app_bind_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_model_app_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_model_app_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_heartbeat_subscription_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_heartbeat_subscription_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_heartbeat_subscription_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_heartbeat_publication_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_heartbeat_publication_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_heartbeat_publication_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_network_transmit_params_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_config_network_transmit_params_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_network_transmit_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_key_refresh_phase_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_key_refresh_phase_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_config_key_refresh_phase_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_config_key_refresh_phase_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_lpn_poll_timeout_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_lpn_poll_timeout_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_health_fault_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_health_fault_get_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_health_fault_clear(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_health_fault_clear_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_health_fault_test(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_health_fault_test_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_health_period_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_health_period_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_health_period_set_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_health_attention_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_health_attention_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_health_attention_set_data_t *p_data);
+
+wiced_result_t wiced_bt_mesh_battery_client_send_get(wiced_bt_mesh_event_t *p_event);
+void wiced_bt_mesh_model_battery_client_init(wiced_bt_mesh_battery_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+void wiced_bt_mesh_model_level_client_init(uint8_t element_idx, wiced_bt_mesh_level_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_level_client_send_delta_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_level_set_delta_t *p_data);
+wiced_result_t wiced_bt_mesh_model_level_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_level_client_send_move_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_level_set_move_t *p_data);
+wiced_result_t wiced_bt_mesh_model_level_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_level_set_level_t *p_data);
+void wiced_bt_mesh_model_light_ctl_client_init(uint8_t element_idx, wiced_bt_mesh_light_ctl_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_default_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_default_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_ctl_default_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_ctl_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_temperature_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_temperature_range_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_temperature_range_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_ctl_temperature_range_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_ctl_client_send_temperature_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_ctl_temperature_set_t *p_data);
+void wiced_bt_mesh_model_light_hsl_client_init(uint8_t element_idx, wiced_bt_mesh_light_hsl_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_default_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_default_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_hsl_default_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_hue_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_hue_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_hsl_hue_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_range_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_range_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_hsl_range_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_saturation_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_saturation_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_hsl_saturation_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_hsl_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_hsl_client_send_target_get(wiced_bt_mesh_event_t *p_event);
+void wiced_bt_mesh_model_light_lc_client_init(uint8_t element_idx, wiced_bt_mesh_light_lc_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_light_onoff_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_light_onoff_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lc_light_onoff_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_mode_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_mode_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lc_mode_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_occupancy_mode_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_occupancy_mode_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lc_occupancy_mode_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_property_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lc_property_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lc_client_send_property_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lc_property_set_data_t *p_data);
+void wiced_bt_mesh_model_light_lightness_client_init(uint8_t element_idx, wiced_bt_mesh_light_lightness_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_default_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_default_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lightness_default_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_last_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_linear_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_linear_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lightness_linear_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_range_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_range_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lightness_range_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_lightness_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_lightness_actual_set_t *p_data);
+void wiced_bt_mesh_model_light_xyl_client_init(uint8_t element_idx, wiced_bt_mesh_light_xyl_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_default_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_default_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_xyl_default_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_range_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_range_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_xyl_range_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_light_xyl_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_light_xyl_client_send_target_get(wiced_bt_mesh_event_t *p_event);
+void wiced_bt_mesh_model_location_client_init(wiced_bt_mesh_location_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_location_client_send_global_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_location_client_send_global_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_location_global_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_location_client_send_local_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_location_client_send_local_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_location_local_data_t *p_data);
+void wiced_bt_mesh_model_onoff_client_init(uint8_t element_idx, wiced_bt_mesh_onoff_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_onoff_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_onoff_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_onoff_set_data_t *p_data);
+void wiced_bt_mesh_model_power_level_client_init(uint8_t element_idx, wiced_bt_mesh_power_level_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_default_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_default_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_power_default_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_last_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_range_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_range_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_power_level_range_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_power_level_client_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_power_level_set_level_t *p_data);
+void wiced_bt_mesh_model_power_onoff_client_init(uint8_t element_idx, wiced_bt_mesh_power_onoff_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_power_onoff_client_send_onpowerup_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_power_onoff_client_send_onpowerup_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_power_onoff_data_t *p_data);
+void wiced_bt_mesh_model_property_client_init(uint8_t element_idx, wiced_bt_mesh_property_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_property_client_send_properties_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_properties_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_property_client_send_property_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_property_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_property_client_send_property_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_property_set_data_t *p_data);
+void wiced_bt_mesh_model_scene_client_init(uint8_t element_idx, wiced_bt_mesh_scene_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_scene_client_send_recall(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_scene_recall_t *p_data);
+wiced_result_t wiced_bt_mesh_model_scene_client_send_register_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_scene_client_send_request(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_scene_request_t *p_data);
+void wiced_bt_mesh_model_scheduler_client_init(wiced_bt_mesh_scheduler_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_scheduler_client_send_action_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_scheduler_action_get_t *p_data);
+wiced_result_t wiced_bt_mesh_model_scheduler_client_send_action_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_scheduler_action_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_scheduler_client_send_get(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_sensor_client_descriptor_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_get_t *p_data);
+void wiced_bt_mesh_model_sensor_client_init(uint8_t element_idx, wiced_bt_mesh_sensor_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_cadence_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_get_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_cadence_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_cadence_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_column_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_column_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_get_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_series_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_series_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_setting_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_setting_get_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_setting_send_set(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_setting_set_data_t *p_data);
+wiced_result_t wiced_bt_mesh_model_sensor_client_sensor_settings_send_get(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_sensor_get_t *p_data);
+void wiced_bt_mesh_model_time_client_init(wiced_bt_mesh_time_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_result_t wiced_bt_mesh_model_time_client_tai_utc_delta_get_send(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_time_client_tai_utc_delta_set_send(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_time_tai_utc_delta_set_t *p_data);
+wiced_result_t wiced_bt_mesh_model_time_client_time_get_send(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_time_client_time_role_get_send(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_time_client_time_role_set_send(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_time_role_msg_t *p_data);
+wiced_result_t wiced_bt_mesh_model_time_client_time_set_send(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_time_state_msg_t *p_data);
+wiced_result_t wiced_bt_mesh_model_time_client_time_zone_get_send(wiced_bt_mesh_event_t *p_event);
+wiced_result_t wiced_bt_mesh_model_time_client_time_zone_set_send(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_time_zone_set_t *p_data);
+
+#endif
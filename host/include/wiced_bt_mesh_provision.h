@@ -0,0 +1,224 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Only the declarations used by
+ * the application sources are provided, values are not the ones of the SDK.
+ */
+#ifndef WICED_BT_MESH_PROVISION_H
+#define WICED_BT_MESH_PROVISION_H
+
+#include "wiced_bt_types.h"
+#include "wiced_bt_mesh_core.h"
+
+/*
+ * Events reported to the provisioning client callback, numbered after the configuration client events
+ */
+#define WICED_BT_MESH_PROVISION_SCAN_CAPABILITIES_STATUS        64
+#define WICED_BT_MESH_PROVISION_SCAN_STATUS                     65
+#define WICED_BT_MESH_PROVISION_SCAN_REPORT                     66
+#define WICED_BT_MESH_PROVISION_SCAN_EXTENDED_REPORT            67
+#define WICED_BT_MESH_PROVISION_LINK_STATUS                     68
+#define WICED_BT_MESH_PROVISION_LINK_REPORT                     69
+#define WICED_BT_MESH_PROVISION_END                             70
+#define WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES             71
+#define WICED_BT_MESH_PROVISION_GET_OOB_DATA                    72
+#define WICED_BT_MESH_PROXY_CONNECTION_STATUS                   73
+#define WICED_BT_MESH_PROXY_DEVICE                              74
+#define WICED_BT_MESH_PROXY_FILTER_STATUS                       75
+#define WICED_BT_MESH_DEVICE_PROVISIONING_RECORD_LIST           76
+#define WICED_BT_MESH_DEVICE_PROVISIONING_RECORD_RESP           77
+
+#define WICED_BT_MESH_PROVISION_PROCEDURE_PROVISION             0
+#define WICED_BT_MESH_PROVISION_RESULT_SUCCESS                  0
+#define WICED_BT_MESH_PROVISION_RESULT_TIMEOUT                  1
+#define WICED_BT_MESH_PROVISION_RESULT_FAILED                   2
+#define WICED_BT_MESH_PROVISION_GET_OOB_TYPE_ENTER_STATIC       3
+#define WICED_BT_MESH_REMOTE_PROVISION_STATE_LINK_ACTIVE        2
+#define WICED_BT_MESH_REMOTE_PROVISION_STATE_OUTBOUND_PDU_TRANSFER  3
+#define WICED_BT_MESH_AD_FILTER_TYPES_MAX                       16
+#define WICED_BT_MESH_PROVISION_ADV_DATA_LEN                    62
+#define WICED_BT_MESH_PROVISIONING_RECORD_MAX                   16
+#define WICED_BT_MESH_PROVISIONING_RECORD_FRAGMENT_MAX          128
+
+typedef struct
+{
+    uint8_t     timeout;
+    uint8_t     scanned_items_limit;
+    uint8_t     scan_single_uuid;
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+} wiced_bt_mesh_provision_scan_start_data_t;
+
+typedef struct
+{
+    uint8_t     num_ad_filters;
+    uint8_t     ad_filter_types[WICED_BT_MESH_AD_FILTER_TYPES_MAX];
+    uint8_t     uuid_present;
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+    uint8_t     timeout;
+} wiced_bt_mesh_provision_scan_extended_start_t;
+
+typedef struct
+{
+    uint8_t     max_scanned_items;
+    uint8_t     active_scan_supported;
+} wiced_bt_mesh_provision_scan_capabilities_status_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+    uint8_t     state;
+    uint8_t     scanned_items_limit;
+    uint8_t     timeout;
+} wiced_bt_mesh_provision_scan_status_data_t;
+
+typedef struct
+{
+    int8_t      rssi;
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+    uint16_t    oob;
+    uint32_t    uri_hash;
+} wiced_bt_mesh_provision_scan_report_data_t;
+
+typedef struct
+{
+    int8_t      rssi;
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+    uint16_t    oob;
+    uint8_t     adv_data[WICED_BT_MESH_PROVISION_ADV_DATA_LEN];
+} PACKED wiced_bt_mesh_provision_scan_extended_report_data_t;
+
+typedef struct
+{
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+    uint8_t     identify_duration;
+    uint8_t     procedure;
+} wiced_bt_mesh_provision_connect_data_t;
+
+typedef struct
+{
+    uint16_t    addr;
+    uint16_t    net_key_idx;
+    uint8_t     algorithm;
+    uint8_t     public_key_type;
+    uint8_t     auth_method;
+    uint8_t     auth_action;
+    uint8_t     auth_size;
+} wiced_bt_mesh_provision_start_data_t;
+
+typedef struct
+{
+    uint8_t     status;
+} wiced_bt_mesh_provision_link_status_data_t;
+
+typedef struct
+{
+    uint8_t     link_status;
+    uint8_t     rpr_state;
+    uint8_t     reason;
+    uint8_t     over_gatt;
+} wiced_bt_mesh_provision_link_report_data_t;
+
+typedef struct
+{
+    uint16_t    provisioner_addr;
+    uint16_t    addr;
+    uint16_t    net_key_idx;
+    uint8_t     result;
+    uint8_t     dev_key[WICED_BT_MESH_KEY_LEN];
+} wiced_bt_mesh_provision_status_data_t;
+
+typedef struct
+{
+    uint16_t    provisioner_addr;
+    uint8_t     elements_num;
+    uint16_t    algorithms;
+    uint8_t     pub_key_type;
+    uint8_t     static_oob_type;
+    uint8_t     output_oob_size;
+    uint16_t    output_oob_action;
+    uint8_t     input_oob_size;
+    uint16_t    input_oob_action;
+} wiced_bt_mesh_provision_device_capabilities_data_t;
+
+typedef struct
+{
+    uint16_t    provisioner_addr;
+    uint8_t     type;
+    uint8_t     size;
+    uint8_t     action;
+} wiced_bt_mesh_provision_device_oob_request_data_t;
+
+typedef struct
+{
+    uint16_t    record_id;
+    uint16_t    fragment_offset;
+    uint16_t    total_length;
+} wiced_bt_mesh_provision_device_record_fragment_data_t;
+
+typedef struct
+{
+    uint16_t    dst;
+    uint16_t    net_key_idx;
+    uint8_t     dev_key[WICED_BT_MESH_KEY_LEN];
+} wiced_bt_mesh_set_dev_key_data_t;
+
+typedef struct
+{
+    uint16_t    provisioner_addr;
+    uint16_t    addr;
+    uint8_t     connected;
+    uint8_t     over_gatt;
+} wiced_bt_mesh_connect_status_data_t;
+
+typedef struct
+{
+    uint16_t    extensions;
+    uint8_t     list_size;
+    uint16_t    list[WICED_BT_MESH_PROVISIONING_RECORD_MAX];
+} wiced_bt_mesh_core_provisioning_list_t;
+
+typedef struct
+{
+    uint8_t     status;
+    union
+    {
+        struct
+        {
+            uint16_t    record_id;
+            uint16_t    fragment_offset;
+            uint16_t    total_length;
+        } response;
+    } u;
+    uint16_t    size;
+    uint8_t     data[WICED_BT_MESH_PROVISIONING_RECORD_FRAGMENT_MAX];
+} wiced_bt_mesh_core_provisioning_record_t;
+
+/*
+ * Local device configuration, sent by the MCU with HCI_CONTROL_MESH_COMMAND_SET_LOCAL_DEVICE
+ */
+typedef struct
+{
+    uint16_t    addr;
+    uint8_t     dev_key[WICED_BT_MESH_KEY_LEN];
+    uint8_t     network_key[WICED_BT_MESH_KEY_LEN];
+    uint16_t    net_key_idx;
+    uint32_t    iv_idx;
+    uint8_t     key_refresh;
+    uint8_t     iv_update;
+} wiced_bt_mesh_local_device_set_data_t;
+
+typedef void (wiced_bt_mesh_provision_client_callback_t)(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+
+void wiced_bt_mesh_provision_client_init(wiced_bt_mesh_provision_client_callback_t *p_callback, wiced_bool_t is_provisioned);
+wiced_bool_t wiced_bt_mesh_provision_scan_capabilities_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_provision_scan_get(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_provision_scan_start(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_scan_start_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_provision_scan_extended_start(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_scan_extended_start_t *p_data);
+wiced_bool_t wiced_bt_mesh_provision_scan_stop(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_provision_connect(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_connect_data_t *p_data, uint8_t use_pb_gatt);
+wiced_bool_t wiced_bt_mesh_provision_disconnect(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_provision_start(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_start_data_t *p_data);
+wiced_bool_t wiced_bt_mesh_provision_client_set_oob(wiced_bt_mesh_event_t *p_event, uint8_t *p_oob, uint8_t len);
+wiced_bool_t wiced_bt_mesh_provision_send_invite(wiced_bt_mesh_event_t *p_event);
+wiced_bool_t wiced_bt_mesh_provision_retrieve_record(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_device_record_fragment_data_t *p_data);
+void wiced_bt_mesh_provision_set_dev_key(wiced_bt_mesh_set_dev_key_data_t *p_data);
+
+#endif
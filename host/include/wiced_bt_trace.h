@@ -0,0 +1,12 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Traces are compiled out.
+ */
+#ifndef WICED_BT_TRACE_H
+#define WICED_BT_TRACE_H
+
+#include "wiced_bt_types.h"
+
+#define WICED_BT_TRACE(...)
+#define WICED_BT_TRACE_ARRAY(...)
+
+#endif
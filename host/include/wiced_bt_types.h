@@ -0,0 +1,51 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Only the declarations used by
+ * the application sources are provided, values are not the ones of the SDK.
+ */
+#ifndef WICED_BT_TYPES_H
+#define WICED_BT_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef uint8_t     wiced_bool_t;
+typedef uint32_t    wiced_result_t;
+typedef uint8_t     wiced_bt_device_address_t[6];
+typedef uint32_t    wiced_bt_gatt_status_t;
+
+#define WICED_FALSE                 0
+#define WICED_TRUE                  1
+#define WICED_SUCCESS               0
+#define WICED_ERROR                 1
+#define WICED_BT_SUCCESS            0
+#define WICED_BT_ERROR              1
+#define WICED_BT_BADARG             2
+#define WICED_BT_NO_RESOURCES       3
+#define WICED_BT_PENDING            4
+#define BD_ADDR_LEN                 6
+
+#ifndef PACKED
+#define PACKED  __attribute__((packed))
+#endif
+
+#define UINT8_TO_STREAM(p, u8)      {*(p)++ = (uint8_t)(u8);}
+#define UINT16_TO_STREAM(p, u16)    {*(p)++ = (uint8_t)(u16); *(p)++ = (uint8_t)((u16) >> 8);}
+#define UINT24_TO_STREAM(p, u24)    {*(p)++ = (uint8_t)(u24); *(p)++ = (uint8_t)((u24) >> 8); *(p)++ = (uint8_t)((u24) >> 16);}
+#define UINT32_TO_STREAM(p, u32)    {*(p)++ = (uint8_t)(u32); *(p)++ = (uint8_t)((u32) >> 8); *(p)++ = (uint8_t)((u32) >> 16); *(p)++ = (uint8_t)((u32) >> 24);}
+#define UINT40_TO_STREAM(p, u40)    {*(p)++ = (uint8_t)(u40); *(p)++ = (uint8_t)((u40) >> 8); *(p)++ = (uint8_t)((u40) >> 16); *(p)++ = (uint8_t)((u40) >> 24); *(p)++ = (uint8_t)((u40) >> 32);}
+#define ARRAY_TO_STREAM(p, a, len)  {int ijk; for (ijk = 0; ijk < (int)(len); ijk++) *(p)++ = (uint8_t)(a)[ijk];}
+#define BDADDR_TO_STREAM(p, a)      {int ijk; for (ijk = 0; ijk < BD_ADDR_LEN; ijk++) *(p)++ = (uint8_t)(a)[BD_ADDR_LEN - 1 - ijk];}
+
+#define STREAM_TO_UINT8(u8, p)      {u8 = (uint8_t)(*(p)); (p) += 1;}
+#define STREAM_TO_UINT16(u16, p)    {u16 = (uint16_t)(((uint16_t)(*(p))) + (((uint16_t)(*((p) + 1))) << 8)); (p) += 2;}
+#define STREAM_TO_UINT24(u32, p)    {u32 = (((uint32_t)(*(p))) + ((((uint32_t)(*((p) + 1)))) << 8) + ((((uint32_t)(*((p) + 2)))) << 16)); (p) += 3;}
+#define STREAM_TO_UINT32(u32, p)    {u32 = (((uint32_t)(*(p))) + ((((uint32_t)(*((p) + 1)))) << 8) + ((((uint32_t)(*((p) + 2)))) << 16) + ((((uint32_t)(*((p) + 3)))) << 24)); (p) += 4;}
+#define STREAM_TO_UINT40(u64, p)    {u64 = (((uint64_t)(*(p))) + (((uint64_t)(*((p) + 1))) << 8) + (((uint64_t)(*((p) + 2))) << 16) + (((uint64_t)(*((p) + 3))) << 24) + (((uint64_t)(*((p) + 4))) << 32)); (p) += 5;}
+#define STREAM_TO_ARRAY(a, p, len)  {int ijk; for (ijk = 0; ijk < (int)(len); ijk++) ((uint8_t *)(a))[ijk] = *(p)++;}
+#define STREAM_TO_BDADDR(a, p)      {int ijk; uint8_t *pbda = (uint8_t *)(a) + BD_ADDR_LEN - 1; for (ijk = 0; ijk < BD_ADDR_LEN; ijk++) *pbda-- = *(p)++;}
+#define BE_STREAM_TO_UINT16(u16, p) {u16 = (uint16_t)((((uint16_t)(*(p))) << 8) + (uint16_t)(*((p) + 1))); (p) += 2;}
+#define BE_STREAM_TO_UINT32(u32, p) {u32 = ((uint32_t)(*((p) + 3)) + ((uint32_t)(*((p) + 2)) << 8) + ((uint32_t)(*((p) + 1)) << 16) + ((uint32_t)(*(p)) << 24)); (p) += 4;}
+#define UINT16_TO_BE_STREAM(p, u16) {*(p)++ = (uint8_t)((u16) >> 8); *(p)++ = (uint8_t)(u16);}
+
+#endif
@@ -0,0 +1,12 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name.
+ */
+#ifndef WICED_MEMORY_H
+#define WICED_MEMORY_H
+
+#include "wiced_bt_types.h"
+
+void *wiced_bt_get_buffer(uint16_t size);
+void wiced_bt_free_buffer(void *p_buf);
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Timers never fire by themselves,
+ * tests expire them with host_timers_advance().
+ */
+#ifndef WICED_TIMER_H
+#define WICED_TIMER_H
+
+#include "wiced_bt_types.h"
+
+#define TIMER_PARAM_TYPE    uint32_t
+
+typedef void (*wiced_timer_callback_t)(TIMER_PARAM_TYPE arg);
+
+typedef enum
+{
+    WICED_SECONDS_TIMER = 1,
+    WICED_MILLI_SECONDS_TIMER,
+    WICED_SECONDS_PERIODIC_TIMER,
+    WICED_MILLI_SECONDS_PERIODIC_TIMER
+} wiced_timer_type_t;
+
+typedef struct wiced_timer_s
+{
+    wiced_timer_callback_t  cb;
+    TIMER_PARAM_TYPE        arg;
+    wiced_timer_type_t      type;
+    wiced_bool_t            in_use;
+    uint64_t                deadline;
+    struct wiced_timer_s    *p_next;
+} wiced_timer_t;
+
+wiced_result_t wiced_init_timer(wiced_timer_t *p_timer, wiced_timer_callback_t cb, TIMER_PARAM_TYPE arg, wiced_timer_type_t type);
+wiced_result_t wiced_start_timer(wiced_timer_t *p_timer, uint32_t timeout);
+wiced_result_t wiced_stop_timer(wiced_timer_t *p_timer);
+wiced_bool_t wiced_is_timer_in_use(wiced_timer_t *p_timer);
+wiced_result_t wiced_deinit_timer(wiced_timer_t *p_timer);
+
+#endif
@@ -0,0 +1,16 @@
+/*
+ * Host build stand-in for the WICED SDK header of the same name. Buffers of the pool are
+ * TRANSPORT_BUFFER_SIZE bytes.
+ */
+#ifndef WICED_TRANSPORT_H
+#define WICED_TRANSPORT_H
+
+#include "wiced_bt_types.h"
+
+typedef struct wiced_transport_buffer_pool_s wiced_transport_buffer_pool_t;
+
+void *wiced_transport_allocate_buffer(wiced_transport_buffer_pool_t *p_pool);
+void wiced_transport_free_buffer(void *p_buf);
+wiced_result_t wiced_transport_send_data(uint16_t code, uint8_t *p_data, uint16_t length);
+
+#endif
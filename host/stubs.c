@@ -0,0 +1,722 @@
+/*
+ * Simulated mesh core and transport for the host build of the application sources. See host.h.
+ */
+#include <time.h>
+#include "host.h"
+#include "wiced_bt_cfg.h"
+#include "wiced_memory.h"
+#include "wiced_timer.h"
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+host_sent_t             host_sent[HOST_MAX_SENT];
+uint32_t                host_num_sent;
+host_request_t          host_requests[HOST_MAX_REQUESTS];
+uint32_t                host_num_requests;
+wiced_bool_t            host_request_result = WICED_TRUE;
+int                     host_events_in_use;
+int                     host_buffers_in_use;
+int                     host_buffers_max = 1000000;
+int                     host_failures;
+
+wiced_transport_buffer_pool_t               *host_trans_pool;
+wiced_bt_cfg_settings_t                     wiced_bt_cfg_settings;
+uint8_t                                     wiced_bt_mesh_core_adv_tx_power;
+wiced_bt_mesh_core_received_msg_handler_t   p_app_model_message_handler;
+void                                        *p_proxy_status_message_handler;
+
+extern wiced_bt_mesh_app_func_table_t       wiced_bt_mesh_app_func_table;
+
+static uint64_t                             host_tick;
+static wiced_timer_t                        *p_host_timers;
+static wiced_bt_mesh_config_client_callback_t *p_host_config_callback;
+
+/******************************************************
+ *               Test helpers
+ ******************************************************/
+void host_reset(void)
+{
+    host_num_sent       = 0;
+    host_num_requests   = 0;
+    host_request_result = WICED_TRUE;
+    host_buffers_max    = 1000000;
+}
+
+void host_app_init(void)
+{
+    wiced_bt_mesh_app_func_table.p_mesh_app_init(WICED_TRUE);
+}
+
+uint64_t host_now(void)
+{
+    return host_tick;
+}
+
+void host_advance(uint32_t ms)
+{
+    uint64_t target = host_tick + ms;
+    wiced_timer_t *p_timer;
+    wiced_timer_t *p_next;
+
+    for (;;)
+    {
+        p_next = NULL;
+        for (p_timer = p_host_timers; p_timer != NULL; p_timer = p_timer->p_next)
+        {
+            if (p_timer->in_use && (p_timer->deadline <= target) && ((p_next == NULL) || (p_timer->deadline < p_next->deadline)))
+                p_next = p_timer;
+        }
+        if (p_next == NULL)
+            break;
+
+        if (p_next->deadline > host_tick)
+            host_tick = p_next->deadline;
+        p_next->in_use = WICED_FALSE;
+        p_next->cb(p_next->arg);
+    }
+    host_tick = target;
+}
+
+uint32_t host_cmd(uint16_t opcode, const uint8_t *p_data, uint32_t length)
+{
+    uint8_t buffer[TRANSPORT_BUFFER_SIZE];
+
+    // Commands longer than the transport buffer never reach the application
+    if (length > sizeof(buffer))
+        abort();
+    memcpy(buffer, p_data, length);
+    return wiced_bt_mesh_app_func_table.p_mesh_app_proc_rx_cmd(opcode, buffer, length);
+}
+
+uint32_t host_cmd_to(uint16_t opcode, uint16_t dst, const uint8_t *p_data, uint32_t length)
+{
+    uint8_t buffer[TRANSPORT_BUFFER_SIZE];
+
+    memset(buffer, 0, HOST_EVENT_HDR_LEN);
+    buffer[0] = (uint8_t)dst;
+    buffer[1] = (uint8_t)(dst >> 8);
+    buffer[7] = 8;  // ttl
+    memcpy(&buffer[HOST_EVENT_HDR_LEN], p_data, length);
+    return wiced_bt_mesh_app_func_table.p_mesh_app_proc_rx_cmd(opcode, buffer, HOST_EVENT_HDR_LEN + length);
+}
+
+void host_reply(uint16_t event, uint16_t src, uint16_t model_id, void *p_data)
+{
+    wiced_bt_mesh_event_t *p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, model_id, src, 0);
+
+    p_event->src = src;
+    p_event->dst = 1;
+    p_host_config_callback(event, p_event, p_data);
+}
+
+wiced_bt_mesh_config_composition_data_status_data_t *host_composition(uint16_t cid, uint16_t pid, uint16_t vid, const uint8_t *p_elements, uint16_t elements_len)
+{
+    wiced_bt_mesh_config_composition_data_status_data_t *p_comp;
+    uint8_t *p;
+
+    p_comp = wiced_bt_get_buffer(sizeof(*p_comp) + 10 + elements_len);
+    p_comp->page_number = 0;
+    p = p_comp->data;
+    UINT16_TO_STREAM(p, cid);
+    UINT16_TO_STREAM(p, pid);
+    UINT16_TO_STREAM(p, vid);
+    UINT16_TO_STREAM(p, 4);         // crpl
+    UINT16_TO_STREAM(p, 0x0007);    // features
+    memcpy(p, p_elements, elements_len);
+    p_comp->data_len = 10 + elements_len;
+    return p_comp;
+}
+
+host_sent_t *host_sent_find(uint16_t opcode, int index)
+{
+    int count = (int)host_sent_count(opcode);
+    uint32_t i;
+
+    if (index < 0)
+        index += count;
+    if ((index < 0) || (index >= count))
+        return NULL;
+
+    for (i = 0; i < host_num_sent && i < HOST_MAX_SENT; i++)
+    {
+        if ((host_sent[i].opcode == opcode) && (index-- == 0))
+            return &host_sent[i];
+    }
+    return NULL;
+}
+
+uint32_t host_sent_count(uint16_t opcode)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < host_num_sent && i < HOST_MAX_SENT; i++)
+    {
+        if (host_sent[i].opcode == opcode)
+            count++;
+    }
+    return count;
+}
+
+host_request_t *host_request_find(const char *name, int index)
+{
+    int count = (int)host_request_count(name);
+    uint32_t i;
+
+    if (index < 0)
+        index += count;
+    if ((index < 0) || (index >= count))
+        return NULL;
+
+    for (i = 0; i < host_num_requests && i < HOST_MAX_REQUESTS; i++)
+    {
+        if ((strcmp(host_requests[i].name, name) == 0) && (index-- == 0))
+            return &host_requests[i];
+    }
+    return NULL;
+}
+
+uint32_t host_request_count(const char *name)
+{
+    uint32_t i, count = 0;
+
+    for (i = 0; i < host_num_requests && i < HOST_MAX_REQUESTS; i++)
+    {
+        if (strcmp(host_requests[i].name, name) == 0)
+            count++;
+    }
+    return count;
+}
+
+int host_last_status(void)
+{
+    host_sent_t *p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, -1);
+
+    return (p_sent == NULL) ? -1 : p_sent->data[0];
+}
+
+/******************************************************
+ *               Memory and transport
+ ******************************************************/
+void *wiced_bt_get_buffer(uint16_t size)
+{
+    return calloc(1, size);
+}
+
+void wiced_bt_free_buffer(void *p_buf)
+{
+    free(p_buf);
+}
+
+void *wiced_transport_allocate_buffer(wiced_transport_buffer_pool_t *p_pool)
+{
+    if (host_buffers_in_use >= host_buffers_max)
+        return NULL;
+    host_buffers_in_use++;
+    return calloc(1, TRANSPORT_BUFFER_SIZE);
+}
+
+void wiced_transport_free_buffer(void *p_buf)
+{
+    host_buffers_in_use--;
+    free(p_buf);
+}
+
+/*
+ * Transport of the mesh application library. Buffer is released after the send.
+ */
+void mesh_transport_send_data(uint16_t opcode, uint8_t *p_data, uint16_t length)
+{
+    host_sent_t *p_sent = &host_sent[host_num_sent++ % HOST_MAX_SENT];
+
+    p_sent->opcode = opcode;
+    p_sent->length = length;
+    memcpy(p_sent->data, p_data, length);
+    wiced_transport_free_buffer(p_data);
+}
+
+/******************************************************
+ *               Timers
+ ******************************************************/
+wiced_result_t wiced_init_timer(wiced_timer_t *p_timer, wiced_timer_callback_t cb, TIMER_PARAM_TYPE arg, wiced_timer_type_t type)
+{
+    wiced_timer_t *p;
+
+    for (p = p_host_timers; p != NULL; p = p->p_next)
+    {
+        if (p == p_timer)
+            break;
+    }
+    p_timer->cb     = cb;
+    p_timer->arg    = arg;
+    p_timer->type   = type;
+    p_timer->in_use = WICED_FALSE;
+    if (p == NULL)
+    {
+        p_timer->p_next = p_host_timers;
+        p_host_timers   = p_timer;
+    }
+    return WICED_SUCCESS;
+}
+
+wiced_result_t wiced_start_timer(wiced_timer_t *p_timer, uint32_t timeout)
+{
+    p_timer->in_use   = WICED_TRUE;
+    p_timer->deadline = host_tick + ((p_timer->type == WICED_SECONDS_TIMER) ? timeout * 1000ULL : timeout);
+    return WICED_SUCCESS;
+}
+
+wiced_result_t wiced_stop_timer(wiced_timer_t *p_timer)
+{
+    p_timer->in_use = WICED_FALSE;
+    return WICED_SUCCESS;
+}
+
+wiced_bool_t wiced_is_timer_in_use(wiced_timer_t *p_timer)
+{
+    return p_timer->in_use;
+}
+
+/******************************************************
+ *               Mesh core and application library
+ ******************************************************/
+uint64_t wiced_bt_mesh_core_get_tick_count(void)
+{
+    return host_tick;
+}
+
+uint16_t wiced_bt_mesh_core_get_local_addr(void)
+{
+    return 1;
+}
+
+wiced_bt_mesh_event_t *wiced_bt_mesh_create_event(uint8_t element_idx, uint16_t company_id, uint16_t model_id, uint16_t dst, uint16_t app_key_idx)
+{
+    wiced_bt_mesh_event_t *p_event = calloc(1, sizeof(wiced_bt_mesh_event_t));
+
+    p_event->element_idx = element_idx;
+    p_event->company_id  = company_id;
+    p_event->model_id    = model_id;
+    p_event->dst         = dst;
+    p_event->src         = 1;
+    p_event->app_key_idx = app_key_idx;
+    host_events_in_use++;
+    return p_event;
+}
+
+wiced_bt_mesh_event_t *wiced_bt_mesh_create_event_from_wiced_hci(uint16_t hci_opcode, uint16_t company_id, uint16_t model_id, uint8_t **p_data, uint32_t *len)
+{
+    wiced_bt_mesh_event_t *p_event;
+    uint8_t *p = *p_data;
+    uint16_t dst, app_key_idx;
+
+    if (*len < HOST_EVENT_HDR_LEN)
+        return NULL;
+
+    STREAM_TO_UINT16(dst, p);
+    STREAM_TO_UINT16(app_key_idx, p);
+    p_event = wiced_bt_mesh_create_event(p[0], company_id, model_id, dst, app_key_idx);
+    p_event->reply      = p[1];
+    p_event->ttl        = p[3];
+    p_event->hci_opcode = hci_opcode;
+    *p_data += HOST_EVENT_HDR_LEN;
+    *len    -= HOST_EVENT_HDR_LEN;
+    return p_event;
+}
+
+void wiced_bt_mesh_release_event(wiced_bt_mesh_event_t *p_event)
+{
+    host_events_in_use--;
+    free(p_event);
+}
+
+wiced_bt_mesh_hci_event_t *wiced_bt_mesh_create_hci_event(wiced_bt_mesh_event_t *p_event)
+{
+    wiced_bt_mesh_hci_event_t *p_hci_event = wiced_transport_allocate_buffer(host_trans_pool);
+
+    if (p_hci_event != NULL)
+    {
+        p_hci_event->src         = p_event->src;
+        p_hci_event->app_key_idx = p_event->app_key_idx;
+        p_hci_event->element_idx = p_event->element_idx;
+    }
+    return p_hci_event;
+}
+
+void wiced_bt_mesh_send_hci_tx_complete(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_event_t *p_event)
+{
+    uint8_t *p = p_hci_event->data;
+
+    UINT8_TO_STREAM(p, p_event->status.tx_flag);
+    UINT16_TO_STREAM(p, p_event->dst);
+    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_TX_COMPLETE, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+}
+
+wiced_result_t wiced_bt_mesh_core_send(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len, wiced_bt_mesh_core_send_complete_callback_t *complete_callback)
+{
+    host_request_t *p_request = &host_requests[host_num_requests++ % HOST_MAX_REQUESTS];
+
+    p_request->name       = "wiced_bt_mesh_core_send";
+    p_request->dst        = p_event->dst;
+    p_request->company_id = p_event->company_id;
+    p_request->model_id   = p_event->model_id;
+    memcpy(p_request->data, p_data, data_len < HOST_REQUEST_DATA_LEN ? data_len : HOST_REQUEST_DATA_LEN);
+    wiced_bt_mesh_release_event(p_event);
+    return host_request_result ? WICED_BT_SUCCESS : WICED_BT_ERROR;
+}
+
+void wiced_bt_mesh_set_raw_scan_response_data(uint8_t num_elem, wiced_bt_ble_advert_elem_t *p_adv)
+{
+}
+
+void wiced_bt_mesh_remote_provisioning_server_init(void)
+{
+}
+
+wiced_bool_t mesh_gatt_client_local_device_set(wiced_bt_mesh_local_device_set_data_t *p_data)
+{
+    return WICED_TRUE;
+}
+
+void mesh_proxy_client_process_filter_status(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len)
+{
+}
+
+/******************************************************
+ *               Model clients
+ ******************************************************/
+static wiced_bool_t host_request(const char *name, wiced_bt_mesh_event_t *p_event, const void *p_data, size_t len)
+{
+    host_request_t *p_request = &host_requests[host_num_requests++ % HOST_MAX_REQUESTS];
+
+    p_request->name       = name;
+    p_request->dst        = p_event->dst;
+    p_request->company_id = p_event->company_id;
+    p_request->model_id   = p_event->model_id;
+    memset(p_request->data, 0, HOST_REQUEST_DATA_LEN);
+    if (p_data != NULL)
+        memcpy(p_request->data, p_data, len < HOST_REQUEST_DATA_LEN ? len : HOST_REQUEST_DATA_LEN);
+    wiced_bt_mesh_release_event(p_event);
+    return host_request_result;
+}
+
+#define HOST_REQUEST(fn, type) \
+    wiced_bool_t fn(wiced_bt_mesh_event_t *p_event, type *p_data) { return host_request(#fn, p_event, p_data, sizeof(*p_data)); }
+
+#define HOST_REQUEST_NO_DATA(fn) \
+    wiced_bool_t fn(wiced_bt_mesh_event_t *p_event) { return host_request(#fn, p_event, NULL, 0); }
+
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_node_reset)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_beacon_get)
+HOST_REQUEST(wiced_bt_mesh_config_beacon_set, wiced_bt_mesh_config_beacon_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_composition_data_get, wiced_bt_mesh_config_composition_data_get_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_default_ttl_get)
+HOST_REQUEST(wiced_bt_mesh_config_default_ttl_set, wiced_bt_mesh_config_default_ttl_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_gatt_proxy_get)
+HOST_REQUEST(wiced_bt_mesh_config_gatt_proxy_set, wiced_bt_mesh_config_gatt_proxy_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_friend_get)
+HOST_REQUEST(wiced_bt_mesh_config_friend_set, wiced_bt_mesh_config_friend_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_relay_get)
+HOST_REQUEST(wiced_bt_mesh_config_relay_set, wiced_bt_mesh_config_relay_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_node_identity_get, wiced_bt_mesh_config_node_identity_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_node_identity_set, wiced_bt_mesh_config_node_identity_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_publication_get, wiced_bt_mesh_config_model_publication_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_publication_set, wiced_bt_mesh_config_model_publication_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_subscription_change, wiced_bt_mesh_config_model_subscription_change_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_subscription_get, wiced_bt_mesh_config_model_subscription_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_netkey_change, wiced_bt_mesh_config_netkey_change_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_netkey_get)
+HOST_REQUEST(wiced_bt_mesh_config_appkey_change, wiced_bt_mesh_config_appkey_change_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_appkey_get, wiced_bt_mesh_config_appkey_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_app_bind, wiced_bt_mesh_config_model_app_bind_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_model_app_get, wiced_bt_mesh_config_model_app_get_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_heartbeat_subscription_get)
+HOST_REQUEST(wiced_bt_mesh_config_heartbeat_subscription_set, wiced_bt_mesh_config_heartbeat_subscription_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_heartbeat_publication_get)
+HOST_REQUEST(wiced_bt_mesh_config_heartbeat_publication_set, wiced_bt_mesh_config_heartbeat_publication_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_config_network_transmit_params_get)
+HOST_REQUEST(wiced_bt_mesh_config_network_transmit_params_set, wiced_bt_mesh_config_network_transmit_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_key_refresh_phase_get, wiced_bt_mesh_config_key_refresh_phase_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_config_key_refresh_phase_set, wiced_bt_mesh_config_key_refresh_phase_set_data_t)
+HOST_REQUEST(wiced_bt_mesh_lpn_poll_timeout_get, wiced_bt_mesh_lpn_poll_timeout_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_health_fault_get, wiced_bt_mesh_health_fault_get_data_t)
+HOST_REQUEST(wiced_bt_mesh_health_fault_clear, wiced_bt_mesh_health_fault_clear_data_t)
+HOST_REQUEST(wiced_bt_mesh_health_fault_test, wiced_bt_mesh_health_fault_test_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_health_period_get)
+HOST_REQUEST(wiced_bt_mesh_health_period_set, wiced_bt_mesh_health_period_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_health_attention_get)
+HOST_REQUEST(wiced_bt_mesh_health_attention_set, wiced_bt_mesh_health_attention_set_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_provision_scan_capabilities_get)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_provision_scan_get)
+HOST_REQUEST(wiced_bt_mesh_provision_scan_start, wiced_bt_mesh_provision_scan_start_data_t)
+HOST_REQUEST(wiced_bt_mesh_provision_scan_extended_start, wiced_bt_mesh_provision_scan_extended_start_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_provision_scan_stop)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_provision_disconnect)
+HOST_REQUEST(wiced_bt_mesh_provision_start, wiced_bt_mesh_provision_start_data_t)
+HOST_REQUEST_NO_DATA(wiced_bt_mesh_provision_send_invite)
+HOST_REQUEST(wiced_bt_mesh_provision_retrieve_record, wiced_bt_mesh_provision_device_record_fragment_data_t)
+HOST_REQUEST(wiced_bt_mesh_proxy_set_filter_type, wiced_bt_mesh_proxy_filter_set_type_data_t)
+
+wiced_bool_t wiced_bt_mesh_provision_connect(wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_provision_connect_data_t *p_data, uint8_t use_pb_gatt)
+{
+    return host_request("wiced_bt_mesh_provision_connect", p_event, p_data, sizeof(*p_data));
+}
+
+wiced_bool_t wiced_bt_mesh_provision_client_set_oob(wiced_bt_mesh_event_t *p_event, uint8_t *p_oob, uint8_t len)
+{
+    return host_request("wiced_bt_mesh_provision_client_set_oob", p_event, p_oob, len);
+}
+
+wiced_bool_t wiced_bt_mesh_proxy_filter_change_addr(wiced_bt_mesh_event_t *p_event, wiced_bool_t is_add, wiced_bt_mesh_proxy_filter_change_addr_data_t *p_data)
+{
+    return host_request("wiced_bt_mesh_proxy_filter_change_addr", p_event, p_data, sizeof(uint16_t) * (1 + p_data->addr_num));
+}
+
+#define HOST_MODEL_REQUEST(fn, type) \
+    wiced_result_t fn(wiced_bt_mesh_event_t *p_event, type *p_data) { return host_request(#fn, p_event, p_data, sizeof(*p_data)) ? WICED_BT_SUCCESS : WICED_BT_ERROR; }
+
+#define HOST_MODEL_REQUEST_NO_DATA(fn) \
+    wiced_result_t fn(wiced_bt_mesh_event_t *p_event) { return host_request(#fn, p_event, NULL, 0) ? WICED_BT_SUCCESS : WICED_BT_ERROR; }
+
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_default_transition_time_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_default_transition_time_client_send_set, wiced_bt_mesh_default_transition_time_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_battery_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_level_client_send_delta_set, wiced_bt_mesh_level_set_delta_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_level_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_level_client_send_move_set, wiced_bt_mesh_level_set_move_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_level_client_send_set, wiced_bt_mesh_level_set_level_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_ctl_client_send_default_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_ctl_client_send_default_set, wiced_bt_mesh_light_ctl_default_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_ctl_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_ctl_client_send_set, wiced_bt_mesh_light_ctl_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_ctl_client_send_temperature_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_ctl_client_send_temperature_range_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_ctl_client_send_temperature_range_set, wiced_bt_mesh_light_ctl_temperature_range_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_ctl_client_send_temperature_set, wiced_bt_mesh_light_ctl_temperature_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_default_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_hsl_client_send_default_set, wiced_bt_mesh_light_hsl_default_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_hue_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_hsl_client_send_hue_set, wiced_bt_mesh_light_hsl_hue_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_range_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_hsl_client_send_range_set, wiced_bt_mesh_light_hsl_range_set_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_saturation_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_hsl_client_send_saturation_set, wiced_bt_mesh_light_hsl_saturation_set_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_hsl_client_send_set, wiced_bt_mesh_light_hsl_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_hsl_client_send_target_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lc_client_send_light_onoff_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lc_client_send_light_onoff_set, wiced_bt_mesh_light_lc_light_onoff_set_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lc_client_send_mode_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lc_client_send_mode_set, wiced_bt_mesh_light_lc_mode_set_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lc_client_send_occupancy_mode_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lc_client_send_occupancy_mode_set, wiced_bt_mesh_light_lc_occupancy_mode_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lc_client_send_property_get, wiced_bt_mesh_light_lc_property_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lc_client_send_property_set, wiced_bt_mesh_light_lc_property_set_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lightness_client_send_default_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lightness_client_send_default_set, wiced_bt_mesh_light_lightness_default_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lightness_client_send_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lightness_client_send_last_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lightness_client_send_linear_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lightness_client_send_linear_set, wiced_bt_mesh_light_lightness_linear_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_lightness_client_send_range_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lightness_client_send_range_set, wiced_bt_mesh_light_lightness_range_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_lightness_client_send_set, wiced_bt_mesh_light_lightness_actual_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_xyl_client_send_default_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_xyl_client_send_default_set, wiced_bt_mesh_light_xyl_default_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_xyl_client_send_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_xyl_client_send_range_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_xyl_client_send_range_set, wiced_bt_mesh_light_xyl_range_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_light_xyl_client_send_set, wiced_bt_mesh_light_xyl_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_light_xyl_client_send_target_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_location_client_send_global_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_location_client_send_global_set, wiced_bt_mesh_location_global_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_location_client_send_local_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_location_client_send_local_set, wiced_bt_mesh_location_local_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_onoff_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_onoff_client_send_set, wiced_bt_mesh_onoff_set_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_power_level_client_send_default_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_power_level_client_send_default_set, wiced_bt_mesh_power_default_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_power_level_client_send_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_power_level_client_send_last_get)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_power_level_client_send_range_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_power_level_client_send_range_set, wiced_bt_mesh_power_level_range_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_power_level_client_send_set, wiced_bt_mesh_power_level_set_level_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_power_onoff_client_send_onpowerup_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_power_onoff_client_send_onpowerup_set, wiced_bt_mesh_power_onoff_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_property_client_send_properties_get, wiced_bt_mesh_properties_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_property_client_send_property_get, wiced_bt_mesh_property_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_property_client_send_property_set, wiced_bt_mesh_property_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_scene_client_send_recall, wiced_bt_mesh_scene_recall_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_scene_client_send_register_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_scene_client_send_request, wiced_bt_mesh_scene_request_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_scheduler_client_send_action_get, wiced_bt_mesh_scheduler_action_get_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_scheduler_client_send_action_set, wiced_bt_mesh_scheduler_action_data_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_scheduler_client_send_get)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_descriptor_send_get, wiced_bt_mesh_sensor_get_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_cadence_send_get, wiced_bt_mesh_sensor_get_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_cadence_send_set, wiced_bt_mesh_sensor_cadence_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_column_send_get, wiced_bt_mesh_sensor_column_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_send_get, wiced_bt_mesh_sensor_get_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_series_send_get, wiced_bt_mesh_sensor_series_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_setting_send_get, wiced_bt_mesh_sensor_setting_get_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_setting_send_set, wiced_bt_mesh_sensor_setting_set_data_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_sensor_client_sensor_settings_send_get, wiced_bt_mesh_sensor_get_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_time_client_tai_utc_delta_get_send)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_time_client_tai_utc_delta_set_send, wiced_bt_mesh_time_tai_utc_delta_set_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_time_client_time_get_send)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_time_client_time_role_get_send)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_time_client_time_role_set_send, wiced_bt_mesh_time_role_msg_t)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_time_client_time_set_send, wiced_bt_mesh_time_state_msg_t)
+HOST_MODEL_REQUEST_NO_DATA(wiced_bt_mesh_model_time_client_time_zone_get_send)
+HOST_MODEL_REQUEST(wiced_bt_mesh_model_time_client_time_zone_set_send, wiced_bt_mesh_time_zone_set_t)
+
+void wiced_bt_mesh_provision_set_dev_key(wiced_bt_mesh_set_dev_key_data_t *p_data)
+{
+    host_request_t *p_request = &host_requests[host_num_requests++ % HOST_MAX_REQUESTS];
+
+    p_request->name = "wiced_bt_mesh_provision_set_dev_key";
+    p_request->dst  = p_data->dst;
+    memcpy(p_request->data, p_data, sizeof(*p_data));
+}
+
+void wiced_bt_mesh_client_search_proxy(uint8_t start)
+{
+}
+
+wiced_bool_t wiced_bt_mesh_client_proxy_connect(wiced_bt_mesh_proxy_connect_data_t *p_data)
+{
+    return host_request_result;
+}
+
+wiced_bool_t wiced_bt_mesh_client_proxy_disconnect(void)
+{
+    return host_request_result;
+}
+
+void wiced_bt_mesh_config_client_init(wiced_bt_mesh_config_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+    p_host_config_callback = p_callback;
+}
+
+void wiced_bt_mesh_provision_client_init(wiced_bt_mesh_provision_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_client_init(wiced_bt_mesh_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_health_client_init(wiced_bt_mesh_health_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_proxy_client_init(wiced_bt_mesh_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_default_transition_time_client_init(uint8_t element_idx, wiced_bt_mesh_default_transition_time_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_battery_client_init(wiced_bt_mesh_battery_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_level_client_init(uint8_t element_idx, wiced_bt_mesh_level_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_light_ctl_client_init(uint8_t element_idx, wiced_bt_mesh_light_ctl_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_light_hsl_client_init(uint8_t element_idx, wiced_bt_mesh_light_hsl_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_light_lc_client_init(uint8_t element_idx, wiced_bt_mesh_light_lc_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_light_lightness_client_init(uint8_t element_idx, wiced_bt_mesh_light_lightness_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_light_xyl_client_init(uint8_t element_idx, wiced_bt_mesh_light_xyl_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_location_client_init(wiced_bt_mesh_location_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_onoff_client_init(uint8_t element_idx, wiced_bt_mesh_onoff_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_power_level_client_init(uint8_t element_idx, wiced_bt_mesh_power_level_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_power_onoff_client_init(uint8_t element_idx, wiced_bt_mesh_power_onoff_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_property_client_init(uint8_t element_idx, wiced_bt_mesh_property_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_scene_client_init(uint8_t element_idx, wiced_bt_mesh_scene_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_scheduler_client_init(wiced_bt_mesh_scheduler_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_sensor_client_init(uint8_t element_idx, wiced_bt_mesh_sensor_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+void wiced_bt_mesh_model_time_client_init(wiced_bt_mesh_time_client_callback_t *p_callback, wiced_bool_t is_provisioned)
+{
+}
+
+/******************************************************
+ *               Benchmarks
+ ******************************************************/
+uint64_t host_clock_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void host_bench_report(const char *name, uint64_t start_ns, uint32_t num_ops)
+{
+    uint64_t elapsed = host_clock_ns() - start_ns;
+
+    printf("  %-46s %9u ops %10.1f ns/op\n", name, num_ops, (double)elapsed / (num_ops ? num_ops : 1));
+}
+
+/******************************************************
+ *               Test runner
+ ******************************************************/
+extern const host_test_t host_tests[];
+
+int main(void)
+{
+    const host_test_t *p_test;
+    int failures;
+
+    host_app_init();
+    for (p_test = host_tests; p_test->name != NULL; p_test++)
+    {
+        failures = host_failures;
+        host_reset();
+        p_test->p_test();
+        printf("%-60s %s\n", p_test->name, (host_failures == failures) ? "ok" : "FAILED");
+    }
+    return (host_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/*
+ * Unit tests of mesh_composition_cache.c
+ */
+#include "host.h"
+
+static const uint8_t cache_elements[] = { 0x00, 0x00, 2, 0, 0x00, 0x10, 0x02, 0x10 };
+
+static void cache_page0(uint16_t src, uint16_t pid, const uint8_t *p_elements, uint16_t len)
+{
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT,
+        host_composition(0x0131, pid, 1, p_elements, len));
+}
+
+static void cache_get(uint16_t dst, uint16_t pid, uint8_t page)
+{
+    uint8_t cmd[7];
+    uint8_t *p = cmd;
+
+    UINT16_TO_STREAM(p, 0x0131);
+    UINT16_TO_STREAM(p, pid);
+    UINT16_TO_STREAM(p, 1);
+    UINT8_TO_STREAM(p, page);
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_GET, dst, cmd, sizeof(cmd));
+}
+
+static host_sent_t *cache_stats_get(void)
+{
+    uint8_t reset = 1;
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_STATS_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_COMPOSITION_CACHE_STATS, -1);
+}
+
+static uint32_t cache_stat(host_sent_t *p_sent, uint8_t counter)
+{
+    uint8_t *p = &p_sent->data[1 + counter * 4];
+
+    return p[0] + (p[1] << 8) + (p[2] << 16) + ((uint32_t)p[3] << 24);
+}
+
+static void test_cache_hit(void)
+{
+    host_sent_t *p_sent;
+
+    cache_stats_get();
+    cache_page0(0x600, 0x10, cache_elements, sizeof(cache_elements));
+    host_reset();
+
+    // Page of the product is sent as if it was received from the new node
+    cache_get(0x601, 0x10, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 5 + 1 + 10 + sizeof(cache_elements));
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x601);
+    HOST_CHECK_EQ(p_sent->data[5], 0);
+    HOST_CHECK_EQ(p_sent->data[6] + (p_sent->data[7] << 8), 0x0131);
+    HOST_CHECK(memcmp(&p_sent->data[16], cache_elements, sizeof(cache_elements)) == 0);
+
+    // Other version is not cached
+    cache_get(0x601, 0x11, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 1);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_composition_data_get", 0)->dst, 0x601);
+
+    p_sent = cache_stats_get();
+    HOST_CHECK_EQ(cache_stat(p_sent, 0), 1);
+    HOST_CHECK_EQ(cache_stat(p_sent, 1), 1);
+    HOST_CHECK_EQ(cache_stat(p_sent, 2), 0);
+}
+
+static void test_cache_mismatch(void)
+{
+    static const uint8_t other[] = { 0x00, 0x00, 1, 0, 0x00, 0x13 };
+    host_sent_t *p_sent;
+
+    cache_page0(0x610, 0x20, cache_elements, sizeof(cache_elements));
+    cache_page0(0x611, 0x20, cache_elements, sizeof(cache_elements));
+    HOST_CHECK_EQ(cache_stat(cache_stats_get(), 2), 0);
+
+    // Node of the same product with other models replaces the page
+    cache_page0(0x612, 0x20, other, sizeof(other));
+    HOST_CHECK_EQ(cache_stat(cache_stats_get(), 2), 1);
+
+    host_reset();
+    cache_get(0x613, 0x20, 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 5 + 1 + 10 + sizeof(other));
+    HOST_CHECK(memcmp(&p_sent->data[16], other, sizeof(other)) == 0);
+}
+
+static void test_cache_other_pages(void)
+{
+    wiced_bt_mesh_config_composition_data_status_data_t *p_comp;
+
+    // Page 1 of the node without page 0 is not cached
+    p_comp = wiced_bt_get_buffer(sizeof(*p_comp) + 4);
+    p_comp->page_number = 1;
+    p_comp->data_len    = 4;
+    memset(p_comp->data, 0x11, 4);
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x620, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_comp);
+    cache_get(0x621, 0x30, 1);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 1);
+
+    cache_page0(0x620, 0x30, cache_elements, sizeof(cache_elements));
+    p_comp = wiced_bt_get_buffer(sizeof(*p_comp) + 4);
+    p_comp->page_number = 1;
+    p_comp->data_len    = 4;
+    memset(p_comp->data, 0x11, 4);
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x620, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_comp);
+
+    host_reset();
+    cache_get(0x621, 0x30, 1);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 0);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, 0)->data[5], 1);
+    cache_stats_get();
+}
+
+static void test_cache_lru(void)
+{
+    uint8_t elements[4 + 2 * 100];
+    uint16_t pid;
+
+    // 214 bytes per page, all 8 entries used
+    memset(elements, 0, sizeof(elements));
+    elements[2] = 100;
+    for (pid = 0x40; pid < 0x48; pid++)
+        cache_page0(0x640 + pid, pid, elements, sizeof(elements));
+    HOST_CHECK_EQ(cache_stats_get()->data[0], 8);
+
+    // Least recently used page is dropped
+    cache_get(0x700, 0x40, 0);
+    cache_page0(0x648, 0x48, elements, sizeof(elements));
+    host_reset();
+    cache_get(0x700, 0x41, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 1);
+    cache_get(0x700, 0x40, 0);
+    cache_get(0x700, 0x48, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 1);
+
+    cache_stats_get();
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_cache_hit),
+    HOST_TEST(test_cache_mismatch),
+    HOST_TEST(test_cache_other_pages),
+    HOST_TEST(test_cache_lru),
+    { NULL, NULL }
+};
@@ -0,0 +1,127 @@
+/*
+ * Unit tests of mesh_composition_index.c
+ */
+#include "host.h"
+
+// Element 0 hosts 0000 and 1000, element 1 hosts 1000 and vendor 0131:0001
+static const uint8_t index_elements[] =
+{
+    0x00, 0x00, 2, 0, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 1, 1, 0x00, 0x10, 0x31, 0x01, 0x01, 0x00,
+};
+
+static void index_page0(uint16_t src, const uint8_t *p_elements, uint16_t len)
+{
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT,
+        host_composition(0x0131, 1, 1, p_elements, len));
+}
+
+static host_sent_t *index_model_find(uint16_t addr, uint16_t company_id, uint16_t model_id)
+{
+    uint8_t cmd[6];
+    uint8_t *p = cmd;
+
+    UINT16_TO_STREAM(p, addr);
+    UINT16_TO_STREAM(p, company_id);
+    UINT16_TO_STREAM(p, model_id);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_COMPOSITION_MODEL_FIND, cmd, sizeof(cmd));
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_COMPOSITION_MODEL_ELEMENTS, -1);
+}
+
+static void test_index_find(void)
+{
+    uint16_t element_addrs[4];
+    host_sent_t *p_sent;
+
+    index_page0(0x900, index_elements, sizeof(index_elements));
+
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x900, MESH_COMPANY_ID_BT_SIG, 0x1000, element_addrs, 4), 2);
+    HOST_CHECK_EQ(element_addrs[0], 0x900);
+    HOST_CHECK_EQ(element_addrs[1], 0x901);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x900, MESH_COMPANY_ID_BT_SIG, 0x1000, element_addrs, 1), 1);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x900, 0x0131, 0x0001, element_addrs, 4), 1);
+    HOST_CHECK_EQ(element_addrs[0], 0x901);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x900, MESH_COMPANY_ID_BT_SIG, 0x1002, element_addrs, 4), 0);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x901, MESH_COMPANY_ID_BT_SIG, 0x1000, element_addrs, 4), 0);
+
+    p_sent = index_model_find(0x900, MESH_COMPANY_ID_BT_SIG, 0x1000);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 5 + 2 * 4);
+    HOST_CHECK_EQ(p_sent->data[4], 2);
+    HOST_CHECK_EQ(p_sent->data[5] + (p_sent->data[6] << 8), 0x900);
+    HOST_CHECK_EQ(p_sent->data[11] + (p_sent->data[12] << 8), 0x901);
+
+    index_model_find(0x950, MESH_COMPANY_ID_BT_SIG, 0x1000);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+}
+
+static void test_index_all_nodes(void)
+{
+    host_sent_t *p_sent;
+
+    index_page0(0x910, index_elements, sizeof(index_elements));
+    index_page0(0x920, index_elements, 8);
+
+    p_sent = index_model_find(0, MESH_COMPANY_ID_BT_SIG, 0x0000);
+    HOST_CHECK_EQ(p_sent->data[4], 3);
+    p_sent = index_model_find(0, 0x0131, 0x0001);
+    HOST_CHECK_EQ(p_sent->data[4], 2);
+}
+
+static void test_index_reset(void)
+{
+    wiced_bt_mesh_config_composition_data_status_data_t *p_comp;
+    uint16_t element_addr;
+
+    index_page0(0x930, index_elements, sizeof(index_elements));
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1), 1);
+
+    host_reply(WICED_BT_MESH_CONFIG_NODE_RESET_STATUS, 0x930, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, NULL);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1), 0);
+
+    // Other pages and empty page 0 keep the models of the node
+    index_page0(0x930, index_elements, sizeof(index_elements));
+    p_comp = wiced_bt_get_buffer(sizeof(*p_comp) + 4);
+    memset(p_comp, 0, sizeof(*p_comp));
+    p_comp->page_number = 1;
+    p_comp->data_len    = 4;
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x930, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_comp);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, 0x0131, 0x0001, &element_addr, 1), 1);
+    p_comp = wiced_bt_get_buffer(sizeof(*p_comp));
+    memset(p_comp, 0, sizeof(*p_comp));
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x930, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_comp);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, 0x0131, 0x0001, &element_addr, 1), 1);
+
+    // New composition data replaces the models of the node
+    index_page0(0x930, index_elements, 8);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, 0x0131, 0x0001, &element_addr, 1), 0);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0x930, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1), 1);
+}
+
+static void test_index_lru(void)
+{
+    uint16_t element_addr;
+    uint16_t addr;
+
+    // Fill the index, the oldest node is removed when a node is added
+    for (addr = 0xA00; addr < 0xA00 + 32; addr++)
+        index_page0(addr, index_elements, sizeof(index_elements));
+    mesh_app_composition_index_find(0xA00, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1);
+    index_page0(0xB00, index_elements, sizeof(index_elements));
+
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0xA00, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1), 1);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0xA01, MESH_COMPANY_ID_BT_SIG, 0x1000, &element_addr, 1), 0);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0xB00, 0x0131, 0x0001, &element_addr, 1), 1);
+    HOST_CHECK_EQ(element_addr, 0xB01);
+    HOST_CHECK_EQ(mesh_app_composition_index_find(0xA1F, 0x0131, 0x0001, &element_addr, 1), 1);
+    HOST_CHECK_EQ(element_addr, 0xA20);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_index_find),
+    HOST_TEST(test_index_all_nodes),
+    HOST_TEST(test_index_reset),
+    HOST_TEST(test_index_lru),
+    { NULL, NULL }
+};
@@ -0,0 +1,185 @@
+/*
+ * Unit tests of mesh_config_recipe.c
+ */
+#include "host.h"
+
+#define RECIPE_APP_KEY_IDX  0x0001
+#define RECIPE_MODEL_ID     0x1000
+#define RECIPE_GROUP        0xC001
+
+static void recipe_set(uint8_t flags)
+{
+    uint8_t cmd[20 + 14];
+    uint8_t *p = cmd;
+
+    memset(cmd, 0, sizeof(cmd));
+    UINT16_TO_STREAM(p, 0);                     // net key index
+    UINT16_TO_STREAM(p, RECIPE_APP_KEY_IDX);
+    memset(p, 0xAA, WICED_BT_MESH_KEY_LEN);
+    p += WICED_BT_MESH_KEY_LEN;
+    UINT16_TO_STREAM(p, MESH_COMPANY_ID_BT_SIG);
+    UINT16_TO_STREAM(p, RECIPE_MODEL_ID);
+    UINT8_TO_STREAM(p, flags);
+    UINT16_TO_STREAM(p, RECIPE_GROUP);
+    UINT16_TO_STREAM(p, 0xC002);
+    UINT8_TO_STREAM(p, 5);
+    UINT32_TO_STREAM(p, 10000);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET, cmd, sizeof(cmd));
+}
+
+static void recipe_clear(void)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET, NULL, 0);
+}
+
+static void recipe_provisioned(uint16_t addr)
+{
+    wiced_bt_mesh_provision_status_data_t status;
+
+    memset(&status, 0, sizeof(status));
+    status.addr   = addr;
+    status.result = WICED_BT_MESH_PROVISION_RESULT_SUCCESS;
+    host_reply(WICED_BT_MESH_PROVISION_END, addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+}
+
+static void recipe_composition(uint16_t addr)
+{
+    static const uint8_t elements[] = { 0x00, 0x00, 2, 0, 0x00, 0x10, 0x02, 0x10 };    // location, 1000, 1002
+
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT,
+        host_composition(0x0131, 1, 1, elements, sizeof(elements)));
+}
+
+static void test_recipe_sequence(void)
+{
+    wiced_bt_mesh_config_appkey_status_data_t appkey;
+    wiced_bt_mesh_config_model_app_bind_status_data_t bind;
+    wiced_bt_mesh_config_model_subscription_status_data_t subscription;
+    wiced_bt_mesh_config_model_publication_status_data_t publication;
+    wiced_bt_mesh_config_model_app_bind_data_t *p_bind;
+    host_request_t *p_request;
+    host_sent_t *p_sent;
+
+    recipe_set(0x07);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+
+    recipe_provisioned(0x100);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_set_dev_key"), 1);
+    p_request = host_request_find("wiced_bt_mesh_config_composition_data_get", -1);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(p_request->dst, 0x100);
+
+    recipe_composition(0x100);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_appkey_change"), 1);
+
+    memset(&appkey, 0, sizeof(appkey));
+    host_reply(WICED_BT_MESH_CONFIG_APPKEY_STATUS, 0x100, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &appkey);
+    p_request = host_request_find("wiced_bt_mesh_config_model_app_bind", -1);
+    HOST_CHECK(p_request != NULL);
+    p_bind = (wiced_bt_mesh_config_model_app_bind_data_t *)p_request->data;
+    HOST_CHECK_EQ(p_bind->element_addr, 0x100);
+    HOST_CHECK_EQ(p_bind->model_id, RECIPE_MODEL_ID);
+    HOST_CHECK_EQ(p_bind->app_key_idx, RECIPE_APP_KEY_IDX);
+
+    memset(&bind, 0, sizeof(bind));
+    host_reply(WICED_BT_MESH_CONFIG_MODEL_APP_BIND_STATUS, 0x100, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &bind);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_subscription_change"), 1);
+
+    // Node rejects the subscription
+    memset(&subscription, 0, sizeof(subscription));
+    subscription.status = 1;
+    host_reply(WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS, 0x100, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &subscription);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_publication_set"), 1);
+
+    memset(&publication, 0, sizeof(publication));
+    host_reply(WICED_BT_MESH_CONFIG_MODEL_PUBLICATION_STATUS, 0x100, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &publication);
+
+    // Statuses of the recipe messages are not sent to the MCU
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_APPKEY_STATUS), 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE), 1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE, 0);
+    HOST_CHECK_EQ(p_sent->length, 6);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x100);
+    HOST_CHECK_EQ(p_sent->data[2], 1);      // partial
+    HOST_CHECK_EQ(p_sent->data[3], 5);      // composition, app key, bind, subscribe, publish
+    HOST_CHECK_EQ(p_sent->data[4], 1);
+    HOST_CHECK_EQ(p_sent->data[5], 0);
+
+    recipe_clear();
+}
+
+static void test_recipe_timeout(void)
+{
+    host_sent_t *p_sent;
+
+    recipe_set(0x01);
+    recipe_provisioned(0x110);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 1);
+
+    host_advance(10000);
+    host_advance(10000);
+    host_advance(10000);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 4);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE), 0);
+
+    host_advance(10000);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[2], 2);      // timeout
+    HOST_CHECK_EQ(p_sent->data[5], 3);
+
+    recipe_clear();
+}
+
+static void test_recipe_queue(void)
+{
+    wiced_bt_mesh_config_appkey_status_data_t appkey;
+    uint16_t addr;
+
+    recipe_set(0x01);
+    for (addr = 0x120; addr < 0x125; addr++)
+        recipe_provisioned(addr);
+
+    // Four sessions, the fifth node waits
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 4);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_composition_data_get", -1)->dst, 0x123);
+
+    // Composition without the model of the recipe, only the app key is added
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x120, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, host_composition(0x0131, 1, 1, NULL, 0));
+    memset(&appkey, 0, sizeof(appkey));
+    host_reply(WICED_BT_MESH_CONFIG_APPKEY_STATUS, 0x120, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &appkey);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE, 0)->data[2], 0);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_composition_data_get", -1)->dst, 0x124);
+
+    // Status from a node not configured is left to the MCU
+    host_reply(WICED_BT_MESH_CONFIG_APPKEY_STATUS, 0x200, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &appkey);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_APPKEY_STATUS), 1);
+
+    recipe_clear();
+    host_advance(100000);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE), 1);
+}
+
+static void test_recipe_invalid(void)
+{
+    uint8_t cmd[20 + 14 + 1];
+
+    memset(cmd, 0, sizeof(cmd));
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET, cmd, 19);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET, cmd, sizeof(cmd));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Without recipe provisioned nodes are left alone
+    recipe_provisioned(0x130);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_composition_data_get"), 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_recipe_sequence),
+    HOST_TEST(test_recipe_timeout),
+    HOST_TEST(test_recipe_queue),
+    HOST_TEST(test_recipe_invalid),
+    { NULL, NULL }
+};
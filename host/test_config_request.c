@@ -0,0 +1,238 @@
+/*
+ * Unit tests of mesh_config_request.c
+ */
+#include "host.h"
+
+#define REQUEST_ITEM_LEN    (6 + HOST_EVENT_HDR_LEN)
+
+static uint8_t *request_item(uint8_t *p, uint16_t id, uint16_t dst)
+{
+    UINT16_TO_STREAM(p, id);
+    UINT16_TO_STREAM(p, 2 + HOST_EVENT_HDR_LEN);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET);
+    memset(p, 0, HOST_EVENT_HDR_LEN);
+    p[0] = (uint8_t)dst;
+    p[1] = (uint8_t)(dst >> 8);
+    return p + HOST_EVENT_HDR_LEN;
+}
+
+static void request_set(uint8_t window, uint8_t window_per_dst, uint16_t timeout, uint8_t retries)
+{
+    uint8_t cmd[5];
+    uint8_t *p = cmd;
+
+    UINT8_TO_STREAM(p, window);
+    UINT8_TO_STREAM(p, window_per_dst);
+    UINT16_TO_STREAM(p, timeout);
+    UINT8_TO_STREAM(p, retries);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET, cmd, sizeof(cmd));
+}
+
+static host_sent_t *request_stats_get(void)
+{
+    uint8_t reset = 1;
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_STATS_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_STATS, -1);
+}
+
+static void request_status(uint16_t src)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t status = { 5 };
+
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+}
+
+static void test_request_window_per_dst(void)
+{
+    uint8_t cmd[3 * REQUEST_ITEM_LEN];
+    uint8_t *p = cmd;
+    host_sent_t *p_sent;
+
+    p = request_item(p, 1, 0x300);
+    p = request_item(p, 2, 0x300);
+    p = request_item(p, 3, 0x301);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, sizeof(cmd));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+
+    // Second command to 0x300 waits for the status of the first one
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 2);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_default_ttl_get", 0)->dst, 0x300);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_default_ttl_get", 1)->dst, 0x301);
+
+    request_status(0x300);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 3);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 6);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 1);
+    HOST_CHECK_EQ(p_sent->data[2] + (p_sent->data[3] << 8), 0x300);
+    HOST_CHECK_EQ(p_sent->data[4], 0);
+
+    // Status is still sent to the MCU
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_DEFAULT_TTL_STATUS), 1);
+
+    request_status(0x301);
+    request_status(0x300);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 3);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 1)->data[0], 3);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 2)->data[0], 2);
+
+    p_sent = request_stats_get();
+    HOST_CHECK_EQ(p_sent->data[0], 0);
+    HOST_CHECK_EQ(p_sent->data[1], 0);
+    HOST_CHECK_EQ(p_sent->data[2], 3);
+}
+
+static void test_request_backoff(void)
+{
+    uint8_t cmd[REQUEST_ITEM_LEN];
+    host_sent_t *p_sent;
+
+    request_set(8, 1, 1000, 2);
+    request_item(cmd, 7, 0x310);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, sizeof(cmd));
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 1);
+
+    host_advance(1000);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 2);
+    host_advance(1999);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 2);
+    host_advance(1);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 3);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 0);
+
+    host_advance(4000);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[4], 2);      // timeout
+    HOST_CHECK_EQ(p_sent->data[5], 2);
+
+    p_sent = request_stats_get();
+    HOST_CHECK_EQ(p_sent->data[2], 0);      // completed
+    HOST_CHECK_EQ(p_sent->data[6], 2);      // retried
+    HOST_CHECK_EQ(p_sent->data[10], 1);     // failed
+
+    request_set(8, 1, 4000, 3);
+}
+
+static void test_request_window(void)
+{
+    uint8_t cmd[4 * REQUEST_ITEM_LEN];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    request_set(2, 1, 4000, 3);
+    for (i = 0; i < 4; i++)
+        p = request_item(p, i, 0x320 + i);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, sizeof(cmd));
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 2);
+
+    request_status(0x321);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 3);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_default_ttl_get", -1)->dst, 0x322);
+
+    // Larger window sends the rest right away
+    request_set(8, 1, 4000, 3);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 4);
+
+    for (i = 0; i < 4; i++)
+        request_status(0x320 + i);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 4);
+    request_stats_get();
+}
+
+static void test_request_invalid(void)
+{
+    uint8_t cmd[20 * REQUEST_ITEM_LEN];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    // Item header cut
+    request_item(cmd, 1, 0x330);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, 5);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Payload cut
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, REQUEST_ITEM_LEN - 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Not a config client command
+    cmd[4] = (uint8_t)HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET;
+    cmd[5] = (uint8_t)(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET >> 8);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, REQUEST_ITEM_LEN);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+
+    // Config client command without a status
+    cmd[4] = (uint8_t)HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA;
+    cmd[5] = (uint8_t)(HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA >> 8);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, REQUEST_ITEM_LEN);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+
+    // More commands than requests, none is queued
+    request_set(1, 1, 100, 0);
+    for (i = 0; i < 20; i++)
+        p = request_item(p, i, 0x340 + i);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, (uint32_t)(p - cmd));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, 13 * REQUEST_ITEM_LEN);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    HOST_CHECK_EQ(request_stats_get()->data[0], 19);
+
+    // Nodes do not reply, each command times out
+    host_advance(20 * 100);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 20);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 20);
+    HOST_CHECK_EQ(request_stats_get()->data[0], 0);
+    request_set(8, 1, 4000, 3);
+
+    request_set(0, 1, 4000, 3);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+}
+
+static void test_request_status_match(void)
+{
+    wiced_bt_mesh_config_relay_status_data_t relay;
+    uint8_t cmd[REQUEST_ITEM_LEN];
+
+    request_item(cmd, 11, 0x360);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, sizeof(cmd));
+
+    // Status of another command does not complete the request
+    memset(&relay, 0, sizeof(relay));
+    host_reply(WICED_BT_MESH_CONFIG_RELAY_STATUS, 0x360, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &relay);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 0);
+
+    request_status(0x360);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE), 1);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 0)->data[0], 11);
+    request_stats_get();
+}
+
+static void test_request_send_error(void)
+{
+    uint8_t cmd[REQUEST_ITEM_LEN];
+    host_sent_t *p_sent;
+
+    host_request_result = WICED_FALSE;
+    request_item(cmd, 9, 0x350);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, cmd, sizeof(cmd));
+    host_request_result = WICED_TRUE;
+
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[4], 1);
+    p_sent = request_stats_get();
+    HOST_CHECK_EQ(p_sent->data[1], 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_request_window_per_dst),
+    HOST_TEST(test_request_backoff),
+    HOST_TEST(test_request_window),
+    HOST_TEST(test_request_invalid),
+    HOST_TEST(test_request_status_match),
+    HOST_TEST(test_request_send_error),
+    { NULL, NULL }
+};
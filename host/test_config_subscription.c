@@ -0,0 +1,165 @@
+/*
+ * Unit tests of mesh_config_subscription.c
+ */
+#include "host.h"
+
+#define SUBS_MODEL_ID       0x1000
+#define SUBS_GROUP          0xC010
+#define SUBS_MAX_NODES      ((TRANSPORT_BUFFER_SIZE - 23) / 2)
+
+static uint32_t subs_fanout(uint8_t operation, uint8_t sessions, uint8_t element, const uint16_t *p_nodes, uint16_t num_nodes)
+{
+    uint8_t cmd[TRANSPORT_BUFFER_SIZE];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    UINT8_TO_STREAM(p, operation);
+    UINT8_TO_STREAM(p, sessions);
+    UINT16_TO_STREAM(p, MESH_COMPANY_ID_BT_SIG);
+    UINT16_TO_STREAM(p, SUBS_MODEL_ID);
+    memset(p, 0, 16);
+    UINT16_TO_STREAM(p, SUBS_GROUP);
+    p += 14;
+    UINT8_TO_STREAM(p, element);
+    for (i = 0; i < num_nodes; i++)
+        UINT16_TO_STREAM(p, p_nodes[i]);
+    return host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_SUBSCRIPTION_FANOUT, cmd, (uint32_t)(p - cmd));
+}
+
+static void subs_status(uint16_t src, uint8_t status)
+{
+    wiced_bt_mesh_config_model_subscription_status_data_t data;
+
+    memset(&data, 0, sizeof(data));
+    data.status = status;
+    host_reply(WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &data);
+}
+
+static void test_subs_sessions(void)
+{
+    static const uint16_t nodes[] = { 0x400, 0x401, 0x402, 0x403, 0x404 };
+    wiced_bt_mesh_config_model_subscription_change_data_t *p_data;
+    host_sent_t *p_sent;
+
+    subs_fanout(1, 2, 0, nodes, 5);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_subscription_change"), 2);
+    p_data = (wiced_bt_mesh_config_model_subscription_change_data_t *)host_request_find("wiced_bt_mesh_config_model_subscription_change", 1)->data;
+    HOST_CHECK_EQ(p_data->operation, OPERATION_DELETE);
+    HOST_CHECK_EQ(p_data->element_addr, 0x401);
+    HOST_CHECK_EQ(p_data->model_id, SUBS_MODEL_ID);
+    HOST_CHECK_EQ(p_data->addr[0] + (p_data->addr[1] << 8), SUBS_GROUP);
+
+    // Second command is rejected while the first one is executed
+    subs_fanout(0, 2, 0, nodes, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+
+    subs_status(0x401, 0);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_model_subscription_change", -1)->dst, 0x402);
+    subs_status(0x400, 1);
+    subs_status(0x402, 0);
+    subs_status(0x403, 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE), 0);
+    subs_status(0x404, 0);
+
+    // Statuses of the nodes are not sent to the MCU
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_STATUS), 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 5);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 5);
+    HOST_CHECK_EQ(p_sent->data[2] + (p_sent->data[3] << 8), 1);
+    HOST_CHECK_EQ(p_sent->data[4], 0x1E);
+}
+
+static void test_subs_timeout(void)
+{
+    static const uint16_t nodes[] = { 0x410 };
+    host_sent_t *p_sent;
+
+    subs_fanout(0, 0, 0, nodes, 1);
+    host_advance(10000);
+    host_advance(10000);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_subscription_change"), 3);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE), 0);
+
+    host_advance(10000);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[2], 1);
+    HOST_CHECK_EQ(p_sent->data[4], 0);
+}
+
+static void test_subs_element_find(void)
+{
+    static const uint8_t elements[] = { 0x00, 0x00, 1, 0, 0x00, 0x00, 0x00, 0x00, 1, 0, 0x00, 0x10 };  // 0000 / 1000
+    static const uint16_t nodes[] = { 0x421, 0x420 };
+    wiced_bt_mesh_config_model_subscription_change_data_t *p_data;
+    host_sent_t *p_sent;
+
+    host_reply(WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS, 0x420, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT,
+        host_composition(0x0131, 2, 1, elements, sizeof(elements)));
+
+    // Composition of 0x421 is not known, the node fails without message
+    subs_fanout(0, 1, 0xFF, nodes, 2);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_subscription_change"), 1);
+    p_data = (wiced_bt_mesh_config_model_subscription_change_data_t *)host_request_find("wiced_bt_mesh_config_model_subscription_change", 0)->data;
+    HOST_CHECK_EQ(p_data->element_addr, 0x421);
+
+    subs_status(0x420, 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[2], 1);
+    HOST_CHECK_EQ(p_sent->data[4], 0x02);
+}
+
+static void test_subs_send_failed(void)
+{
+    uint16_t nodes[SUBS_MAX_NODES];
+    host_sent_t *p_sent;
+    uint16_t i;
+
+    for (i = 0; i < SUBS_MAX_NODES; i++)
+        nodes[i] = 0x500 + i;
+
+    // Nodes of the full command fail one after another in one session
+    host_request_result = WICED_FALSE;
+    subs_fanout(0, 1, 0, nodes, SUBS_MAX_NODES);
+    host_request_result = WICED_TRUE;
+
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), SUBS_MAX_NODES);
+    HOST_CHECK_EQ(p_sent->data[2] + (p_sent->data[3] << 8), SUBS_MAX_NODES);
+    HOST_CHECK_EQ(p_sent->length, 4 + (SUBS_MAX_NODES + 7) / 8);
+}
+
+static void test_subs_stop(void)
+{
+    static const uint16_t nodes[] = { 0x430, 0x431 };
+
+    subs_fanout(0, 0, 0, nodes, 2);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_subscription_change"), 2);
+    subs_fanout(0, 0, 0, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+
+    // Status of the stopped command goes to the MCU
+    subs_status(0x430, 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_STATUS), 1);
+    host_advance(30000);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE), 0);
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_SUBSCRIPTION_FANOUT, (uint8_t *)nodes, 4);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_subs_sessions),
+    HOST_TEST(test_subs_timeout),
+    HOST_TEST(test_subs_element_find),
+    HOST_TEST(test_subs_send_failed),
+    HOST_TEST(test_subs_stop),
+    { NULL, NULL }
+};
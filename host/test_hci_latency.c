@@ -0,0 +1,140 @@
+/*
+ * Unit tests of mesh_hci_latency.c
+ */
+#include "host.h"
+
+#define LATENCY_NUM_BUCKETS     16
+#define LATENCY_NUM_OPCODES     6
+#define LATENCY_NUM_DSTS        4
+#define LATENCY_ENTRY_LEN       (2 + LATENCY_NUM_BUCKETS * 2)
+
+#define LATENCY_OPCODE_A        HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET
+#define LATENCY_OPCODE_B        HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND
+
+static uint8_t *latency_opcode_entry(host_sent_t *p_sent, uint8_t i)
+{
+    return &p_sent->data[2 + i * LATENCY_ENTRY_LEN];
+}
+
+static uint8_t *latency_dst_entry(host_sent_t *p_sent, uint8_t i)
+{
+    return &p_sent->data[3 + LATENCY_NUM_OPCODES * LATENCY_ENTRY_LEN + i * LATENCY_ENTRY_LEN];
+}
+
+static uint16_t latency_key(uint8_t *p_entry)
+{
+    return p_entry[0] + (p_entry[1] << 8);
+}
+
+static uint16_t latency_count(uint8_t *p_entry, uint8_t bucket)
+{
+    return p_entry[2 + bucket * 2] + (p_entry[3 + bucket * 2] << 8);
+}
+
+static host_sent_t *latency_get(uint8_t reset)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_LATENCY_STATUS, -1);
+}
+
+static void test_latency_buckets(void)
+{
+    host_sent_t *p_sent;
+
+    latency_get(1);
+    mesh_app_latency_record(LATENCY_OPCODE_A, 2, 0);
+    mesh_app_latency_record(LATENCY_OPCODE_A, 2, 1);
+    mesh_app_latency_record(LATENCY_OPCODE_A, 2, 5);
+    mesh_app_latency_record(LATENCY_OPCODE_B, 2, 100000);
+
+    p_sent = latency_get(0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 3 + (LATENCY_NUM_OPCODES + LATENCY_NUM_DSTS) * LATENCY_ENTRY_LEN);
+    HOST_CHECK_EQ(p_sent->data[0], LATENCY_NUM_BUCKETS);
+    HOST_CHECK_EQ(p_sent->data[1], LATENCY_NUM_OPCODES);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 0)), LATENCY_OPCODE_A);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 0), 1);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 1), 1);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 3), 1);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 1)), LATENCY_OPCODE_B);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 1), LATENCY_NUM_BUCKETS - 1), 1);
+    HOST_CHECK_EQ(p_sent->data[2 + LATENCY_NUM_OPCODES * LATENCY_ENTRY_LEN], LATENCY_NUM_DSTS);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 0)), 2);
+    HOST_CHECK_EQ(latency_count(latency_dst_entry(p_sent, 0), 0), 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+
+    // Histograms are cleared by the previous get only when requested
+    p_sent = latency_get(1);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 0), 1);
+    p_sent = latency_get(0);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 0), 0);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 0)), 0);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 0)), 0);
+}
+
+static void test_latency_least_recently_used(void)
+{
+    host_sent_t *p_sent;
+    uint16_t addr;
+
+    latency_get(1);
+    for (addr = 2; addr < 2 + LATENCY_NUM_DSTS; addr++)
+        mesh_app_latency_record(LATENCY_OPCODE_A, addr, 10);
+    mesh_app_latency_record(LATENCY_OPCODE_A, 2, 10);
+
+    // Each new destination replaces the one not updated for the longest time
+    mesh_app_latency_record(LATENCY_OPCODE_A, 0x100, 10);
+    mesh_app_latency_record(LATENCY_OPCODE_A, 0x101, 10);
+    p_sent = latency_get(0);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 0)), 2);
+    HOST_CHECK_EQ(latency_count(latency_dst_entry(p_sent, 0), 4), 2);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 1)), 0x100);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 2)), 0x101);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 3)), 5);
+    HOST_CHECK_EQ(latency_count(latency_dst_entry(p_sent, 1), 4), 1);
+
+    // Same for the opcodes
+    latency_get(1);
+    for (addr = 0; addr < LATENCY_NUM_OPCODES + 1; addr++)
+        mesh_app_latency_record((HCI_CONTROL_GROUP_MESH << 8) | addr, 2, 10);
+    p_sent = latency_get(1);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 0)), (HCI_CONTROL_GROUP_MESH << 8) | LATENCY_NUM_OPCODES);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 1)), (HCI_CONTROL_GROUP_MESH << 8) | 1);
+}
+
+static void test_latency_of_config_reply(void)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t ttl_status = { 5 };
+    host_sent_t *p_sent;
+
+    latency_get(1);
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET, 2, NULL, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_get"), 1);
+    host_advance(30);
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 2, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+
+    p_sent = latency_get(1);
+    HOST_CHECK_EQ(latency_key(latency_opcode_entry(p_sent, 0)), HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET);
+    HOST_CHECK_EQ(latency_count(latency_opcode_entry(p_sent, 0), 5), 1);
+    HOST_CHECK_EQ(latency_key(latency_dst_entry(p_sent, 0)), 2);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_latency_get_no_buffer(void)
+{
+    uint8_t reset = 0;
+
+    host_buffers_max = host_buffers_in_use;
+    host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, &reset, 1);
+    host_buffers_max = 1000000;
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_LATENCY_STATUS), 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_latency_buckets),
+    HOST_TEST(test_latency_least_recently_used),
+    HOST_TEST(test_latency_of_config_reply),
+    HOST_TEST(test_latency_get_no_buffer),
+    { NULL, NULL }
+};
@@ -0,0 +1,218 @@
+/*
+ * Unit tests of mesh_hci_scan.c
+ */
+#include "host.h"
+
+static uint32_t scan_stat(host_sent_t *p_sent, uint8_t i)
+{
+    uint8_t *p = &p_sent->data[i * 4];
+
+    return p[0] + (p[1] << 8) + (p[2] << 16) + ((uint32_t)p[3] << 24);
+}
+
+static host_sent_t *scan_stats_get(uint8_t reset)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_STATS_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_SCAN_STATS, -1);
+}
+
+static void scan_dedup_set(uint8_t enable, uint16_t refresh_interval, uint8_t rssi_delta)
+{
+    uint8_t data[4] = { enable, (uint8_t)refresh_interval, (uint8_t)(refresh_interval >> 8), rssi_delta };
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_DEDUP_SET, data, sizeof(data));
+}
+
+static void test_scan_no_dedup(void)
+{
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 1 };
+    int8_t  rssi = -50;
+    host_sent_t *p_sent;
+
+    mesh_app_scan_filter_set(NULL);
+    scan_dedup_set(0, 2000, 6);
+    scan_stats_get(1);
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+
+    p_sent = scan_stats_get(1);
+    HOST_CHECK_EQ(scan_stat(p_sent, 0), 2);
+    HOST_CHECK_EQ(scan_stat(p_sent, 1), 2);
+}
+
+static void test_scan_dedup(void)
+{
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 2 };
+    int8_t  rssi;
+    host_sent_t *p_sent;
+
+    mesh_app_scan_filter_set(NULL);
+    scan_dedup_set(1, 1000, 6);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    scan_stats_get(1);
+
+    rssi = -50;
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+    rssi = -52;
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0, &rssi));
+
+    // Smoothed RSSI moves by a quarter of the difference
+    rssi = -60;
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0, &rssi));
+    rssi = -90;
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+    HOST_CHECK(rssi > -90);
+
+    // Report is sent again when the refresh interval expires
+    host_advance(999);
+    rssi = -70;
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0, &rssi));
+    host_advance(1);
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+
+    p_sent = scan_stats_get(1);
+    HOST_CHECK_EQ(scan_stat(p_sent, 0), 6);
+    HOST_CHECK_EQ(scan_stat(p_sent, 1), 3);
+    HOST_CHECK_EQ(scan_stat(p_sent, 2), 3);
+}
+
+static void test_scan_cache_replacement(void)
+{
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 0 };
+    int8_t  rssi = -40;
+    host_sent_t *p_sent;
+    uint32_t i;
+
+    mesh_app_scan_filter_set(NULL);
+    scan_dedup_set(1, 60000, 20);
+    scan_stats_get(1);
+    for (i = 0; i < 1000; i++)
+    {
+        uuid[0] = (uint8_t)i;
+        uuid[1] = (uint8_t)(i >> 8);
+        HOST_CHECK(mesh_app_scan_report_check(uuid, 0, &rssi));
+        host_advance(1);
+    }
+    p_sent = scan_stats_get(1);
+    HOST_CHECK_EQ(scan_stat(p_sent, 1), 1000);
+    HOST_CHECK(scan_stat(p_sent, 3) >= 1000 - 64);
+
+    // Most recent devices are still known
+    uuid[0] = (uint8_t)999;
+    uuid[1] = (uint8_t)(999 >> 8);
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0, &rssi));
+    scan_dedup_set(0, 2000, 6);
+}
+
+static void test_scan_filter(void)
+{
+    uint8_t filter[2 * MESH_DEVICE_UUID_LEN + 3] = { 0 };
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 0 };
+    int8_t  rssi = -50;
+    host_sent_t *p_sent;
+
+    filter[0] = 0xA5;                           // uuid
+    filter[MESH_DEVICE_UUID_LEN] = 0xF0;        // uuid mask
+    filter[2 * MESH_DEVICE_UUID_LEN] = 0x02;    // oob mask
+    filter[2 * MESH_DEVICE_UUID_LEN + 2] = (uint8_t)-60;
+    mesh_app_scan_filter_set(filter);
+    scan_dedup_set(0, 2000, 6);
+    scan_stats_get(1);
+
+    uuid[0] = 0xA0;
+    HOST_CHECK(mesh_app_scan_report_check(uuid, 0x02, &rssi));
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0x01, &rssi));
+    HOST_CHECK(mesh_app_scan_filter_match(uuid, 0x03, NULL));
+    rssi = -61;
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0x02, &rssi));
+    uuid[0] = 0xB5;
+    rssi = -50;
+    HOST_CHECK(!mesh_app_scan_report_check(uuid, 0x02, &rssi));
+
+    p_sent = scan_stats_get(1);
+    HOST_CHECK_EQ(scan_stat(p_sent, 4), 3);
+    mesh_app_scan_filter_set(NULL);
+}
+
+static wiced_bt_mesh_provision_scan_start_data_t *scan_start(const uint8_t *p_uuid, const uint8_t *p_filter, uint8_t trailing)
+{
+    uint8_t data[2 + 2 * MESH_DEVICE_UUID_LEN + MESH_APP_SCAN_FILTER_LEN] = { 10, 20 };
+    uint8_t *p = &data[2];
+
+    if (p_uuid != NULL)
+    {
+        memcpy(p, p_uuid, MESH_DEVICE_UUID_LEN);
+        p += MESH_DEVICE_UUID_LEN;
+    }
+    if (p_filter != NULL)
+    {
+        memcpy(p, p_filter, MESH_APP_SCAN_FILTER_LEN);
+        p += MESH_APP_SCAN_FILTER_LEN;
+    }
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_START, 1, data, (uint32_t)(p - data) + trailing);
+    return (wiced_bt_mesh_provision_scan_start_data_t *)host_request_find("wiced_bt_mesh_provision_scan_start", -1)->data;
+}
+
+static void test_scan_start(void)
+{
+    uint8_t filter[MESH_APP_SCAN_FILTER_LEN] = { 0 };
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 0 };
+    wiced_bt_mesh_provision_scan_start_data_t *p_start;
+
+    filter[MESH_DEVICE_UUID_LEN] = 0xFF;        // first byte of the uuid must be 0
+    uuid[0] = 0x33;
+
+    p_start = scan_start(NULL, NULL, 0);
+    HOST_CHECK_EQ(p_start->scan_single_uuid, WICED_FALSE);
+    HOST_CHECK_EQ(p_start->scanned_items_limit, 10);
+
+    // Trailing bytes after the UUID are ignored
+    p_start = scan_start(uuid, NULL, 3);
+    HOST_CHECK_EQ(p_start->scan_single_uuid, WICED_TRUE);
+    HOST_CHECK_EQ(p_start->uuid[0], 0x33);
+    HOST_CHECK(mesh_app_scan_filter_match(uuid, 0, NULL));
+
+    p_start = scan_start(uuid, filter, 0);
+    HOST_CHECK_EQ(p_start->scan_single_uuid, WICED_TRUE);
+    HOST_CHECK(!mesh_app_scan_filter_match(uuid, 0, NULL));
+
+    // UUID of all zeros with the filter scans for all devices
+    memset(uuid, 0, sizeof(uuid));
+    p_start = scan_start(uuid, filter, 0);
+    HOST_CHECK_EQ(p_start->scan_single_uuid, WICED_FALSE);
+    HOST_CHECK(mesh_app_scan_filter_match(uuid, 0, NULL));
+    uuid[0] = 0x33;
+    HOST_CHECK(!mesh_app_scan_filter_match(uuid, 0, NULL));
+    mesh_app_scan_filter_set(NULL);
+}
+
+static void test_scan_ad_filter(void)
+{
+    uint8_t adv[] = { 2, 0x01, 0x06, 3, 0x09, 'a', 'b', 2, 0x0A, 0x04, 0, 0 };
+    uint8_t types[] = { 0x09, 0x0A };
+    uint8_t dst[sizeof(adv)];
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0);
+    HOST_CHECK_EQ(mesh_app_scan_ad_copy(dst, adv, sizeof(adv)), 10);
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, types, sizeof(types));
+    HOST_CHECK_EQ(mesh_app_scan_ad_copy(dst, adv, sizeof(adv)), 7);
+    HOST_CHECK_EQ(dst[1], 0x09);
+    HOST_CHECK_EQ(dst[5], 0x0A);
+
+    // Structure which does not fit stops the walk
+    adv[7] = 10;
+    HOST_CHECK_EQ(mesh_app_scan_ad_copy(dst, adv, sizeof(adv)), 4);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_scan_no_dedup),
+    HOST_TEST(test_scan_dedup),
+    HOST_TEST(test_scan_cache_replacement),
+    HOST_TEST(test_scan_filter),
+    HOST_TEST(test_scan_start),
+    HOST_TEST(test_scan_ad_filter),
+    { NULL, NULL }
+};
@@ -0,0 +1,70 @@
+/*
+ * Unit tests of mesh_hci_trace.c
+ */
+#include "host.h"
+
+#define TRACE_RING_SIZE         32
+#define TRACE_MAX_RECORDS       20
+#define TRACE_RECORD_LEN        18
+
+static void trace_drain(void)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRACE_GET, NULL, 0);
+    host_reset();
+}
+
+static void test_trace_record(void)
+{
+    host_sent_t *p_sent;
+    uint8_t *p;
+
+    trace_drain();
+    host_advance(1234);
+    mesh_app_bin_trace(0x77, 1, 2, 3);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRACE_GET, NULL, 0);
+
+    // The get command itself is traced when received
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRACE_DATA, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0);
+    HOST_CHECK_EQ(p_sent->data[2], 2);
+    HOST_CHECK_EQ(p_sent->length, 3 + 2 * TRACE_RECORD_LEN);
+    p = &p_sent->data[3];
+    HOST_CHECK_EQ(p[0], 0x77);
+    HOST_CHECK_EQ(p[2] + (p[3] << 8), (uint16_t)host_now());
+    HOST_CHECK_EQ(p[6], 1);
+    HOST_CHECK_EQ(p[10], 2);
+    HOST_CHECK_EQ(p[14], 3);
+    p += TRACE_RECORD_LEN;
+    HOST_CHECK_EQ(p[0], MESH_BIN_TRACE_ID_PROC_RX_CMD);
+    HOST_CHECK_EQ(p[6] + (p[7] << 8), HCI_CONTROL_MESH_COMMAND_TRACE_GET);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+}
+
+static void test_trace_ring_overflow(void)
+{
+    host_sent_t *p_sent;
+    uint32_t i;
+
+    trace_drain();
+    for (i = 0; i < 40; i++)
+        mesh_app_bin_trace(0x100 + i, i, 0, 0);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRACE_GET, NULL, 0);
+
+    // 41 records including the get, the oldest 9 dropped, the rest in two events
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRACE_DATA), 2);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRACE_DATA, 0);
+    HOST_CHECK_EQ(p_sent->data[0], 41 - TRACE_RING_SIZE);
+    HOST_CHECK_EQ(p_sent->data[2], TRACE_MAX_RECORDS);
+    HOST_CHECK_EQ(p_sent->data[3] + (p_sent->data[4] << 8), 0x100 + 41 - TRACE_RING_SIZE);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRACE_DATA, 1);
+    HOST_CHECK_EQ(p_sent->data[0], 0);
+    HOST_CHECK_EQ(p_sent->data[2], TRACE_RING_SIZE - TRACE_MAX_RECORDS);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_trace_record),
+    HOST_TEST(test_trace_ring_overflow),
+    { NULL, NULL }
+};
@@ -0,0 +1,217 @@
+/*
+ * Unit tests of mesh_hci_transport.c
+ */
+#include "host.h"
+
+#define STATUS_RING_SIZE        16
+
+static void coalesce_set(uint8_t enable, uint32_t deadline_us)
+{
+    uint8_t data[5] = { enable, (uint8_t)deadline_us, (uint8_t)(deadline_us >> 8), (uint8_t)(deadline_us >> 16), (uint8_t)(deadline_us >> 24) };
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATUS_COALESCE_SET, data, sizeof(data));
+}
+
+static void mux_set(uint8_t enable, uint16_t timeout_ms)
+{
+    uint8_t data[3] = { enable, (uint8_t)timeout_ms, (uint8_t)(timeout_ms >> 8) };
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_EVENT_MUX_SET, data, sizeof(data));
+}
+
+static void local_cmd(void)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0);
+}
+
+static void test_status_sent_immediately(void)
+{
+    local_cmd();
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS), 1);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, 0)->length, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+}
+
+static void test_status_coalesce_deadline(void)
+{
+    host_sent_t *p_sent;
+
+    coalesce_set(1, 3000);
+    local_cmd();
+    local_cmd();
+    HOST_CHECK_EQ(host_num_sent, 0);
+
+    host_advance(2);
+    HOST_CHECK_EQ(host_num_sent, 0);
+    host_advance(1);
+    HOST_CHECK_EQ(host_num_sent, 1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0], 3);
+    HOST_CHECK_EQ(p_sent->data[1], 1);
+    HOST_CHECK_EQ(p_sent->data[2], HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(p_sent->length, 1 + 3 * 2);
+
+    // Disabling sends the statuses collected so far, the status of the command itself is not collected
+    host_reset();
+    local_cmd();
+    coalesce_set(0, 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST), 1);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS), 1);
+}
+
+static void test_status_coalesce_ring_full(void)
+{
+    uint8_t i;
+
+    coalesce_set(1, 1000000);
+    for (i = 0; i < STATUS_RING_SIZE - 1; i++)
+        local_cmd();
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST), 1);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST, 0)->data[0], STATUS_RING_SIZE);
+
+    // Timer of the flushed statuses does not fire for the next ones
+    local_cmd();
+    host_advance(999);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST), 1);
+    coalesce_set(0, 0);
+}
+
+static void test_status_coalesce_before_event(void)
+{
+    uint8_t reset = 0;
+
+    coalesce_set(1, 1000000);
+    local_cmd();
+    host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, &reset, 1);
+
+    HOST_CHECK_EQ(host_num_sent, 2);
+    HOST_CHECK_EQ(host_sent[0].opcode, HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST);
+    HOST_CHECK_EQ(host_sent[0].data[0], 2);
+    HOST_CHECK_EQ(host_sent[1].opcode, HCI_CONTROL_MESH_EVENT_LATENCY_STATUS);
+    coalesce_set(0, 0);
+}
+
+static void test_mux_frame(void)
+{
+    host_sent_t *p_sent;
+    uint8_t *p;
+    uint8_t i;
+
+    mux_set(1, 5);
+    local_cmd();
+    local_cmd();
+    HOST_CHECK_EQ(host_num_sent, 0);
+    host_advance(5);
+    HOST_CHECK_EQ(host_num_sent, 1);
+
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_MULTIPLEXED, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 3 * (4 + 1));
+    for (i = 0, p = p_sent->data; i < 3; i++, p += 5)
+    {
+        HOST_CHECK_EQ(p[0] + (p[1] << 8), HCI_CONTROL_MESH_EVENT_COMMAND_STATUS);
+        HOST_CHECK_EQ(p[2] + (p[3] << 8), 1);
+        HOST_CHECK_EQ(p[4], HCI_CONTROL_MESH_STATUS_SUCCESS);
+    }
+
+    // Frame with one event is sent as the event
+    host_reset();
+    local_cmd();
+    host_advance(5);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS), 1);
+    HOST_CHECK_EQ(host_sent[0].length, 1);
+    mux_set(0, 0);
+}
+
+static void test_mux_large_event(void)
+{
+    uint8_t reset = 0;
+
+    mux_set(1, 5);
+    local_cmd();
+    host_reset();
+    host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, &reset, 1);
+
+    // Large event flushes the frame and is sent in its own buffer
+    HOST_CHECK_EQ(host_num_sent, 2);
+    HOST_CHECK_EQ(host_sent[0].opcode, HCI_CONTROL_MESH_EVENT_MULTIPLEXED);
+    HOST_CHECK_EQ(host_sent[1].opcode, HCI_CONTROL_MESH_EVENT_LATENCY_STATUS);
+    mux_set(0, 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS), 2);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+static void test_mux_tx_complete(void)
+{
+    uint8_t *p;
+
+    // Tx complete is added to the frame after the statuses of both commands
+    mux_set(1, 5);
+    host_reset();
+    local_cmd();
+    host_reply(WICED_BT_MESH_TX_COMPLETE, 0x0A0B, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, NULL);
+    HOST_CHECK_EQ(host_num_sent, 0);
+    host_advance(5);
+
+    HOST_CHECK_EQ(host_num_sent, 1);
+    HOST_CHECK_EQ(host_sent[0].opcode, HCI_CONTROL_MESH_EVENT_MULTIPLEXED);
+    p = &host_sent[0].data[2 * (4 + 1)];
+    HOST_CHECK_EQ(p[0] + (p[1] << 8), HCI_CONTROL_MESH_EVENT_TX_COMPLETE);
+    HOST_CHECK_EQ(p[2] + (p[3] << 8), 5 + 3);
+    HOST_CHECK_EQ(p[4] + (p[5] << 8), 0x0A0B);
+    HOST_CHECK_EQ(p[4 + 6] + (p[4 + 7] << 8), 1);
+    mux_set(0, 0);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+static void test_tx_complete_format(void)
+{
+    wiced_bt_mesh_event_t *p_event;
+    host_sent_t *p_app;
+    host_sent_t *p_lib;
+
+    // Tx complete built by the application is the one the library builds
+    p_event = wiced_bt_mesh_create_event(1, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, 0x0A0B, 0x0123);
+    p_event->src = 0x0C0D;
+    p_event->status.tx_flag = 0x02;
+    mesh_app_send_hci_tx_complete(wiced_bt_mesh_create_hci_event(p_event), p_event);
+    wiced_bt_mesh_send_hci_tx_complete(wiced_bt_mesh_create_hci_event(p_event), p_event);
+    wiced_bt_mesh_release_event(p_event);
+
+    HOST_CHECK_EQ(host_num_sent, 2);
+    p_app = host_sent_find(HCI_CONTROL_MESH_EVENT_TX_COMPLETE, 0);
+    p_lib = host_sent_find(HCI_CONTROL_MESH_EVENT_TX_COMPLETE, 1);
+    HOST_CHECK_EQ(p_app->length, offsetof(wiced_bt_mesh_hci_event_t, data) + 3);
+    HOST_CHECK_EQ(p_app->length, p_lib->length);
+    HOST_CHECK_EQ(memcmp(p_app->data, p_lib->data, p_lib->length), 0);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+static void test_mux_frame_full(void)
+{
+    uint32_t i;
+
+    mux_set(1, 100);
+    for (i = 0; i < 100; i++)
+        local_cmd();
+    mux_set(0, 0);
+
+    // Each status takes 5 bytes of the frame
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_MULTIPLEXED), (101 * 5 + (TRANSPORT_BUFFER_SIZE - 16) - 1) / (TRANSPORT_BUFFER_SIZE - 16));
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_status_sent_immediately),
+    HOST_TEST(test_status_coalesce_deadline),
+    HOST_TEST(test_status_coalesce_ring_full),
+    HOST_TEST(test_status_coalesce_before_event),
+    HOST_TEST(test_mux_frame),
+    HOST_TEST(test_mux_large_event),
+    HOST_TEST(test_mux_tx_complete),
+    HOST_TEST(test_mux_frame_full),
+    HOST_TEST(test_tx_complete_format),
+    { NULL, NULL }
+};
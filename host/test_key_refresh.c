@@ -0,0 +1,184 @@
+/*
+ * Unit tests of mesh_key_refresh.c
+ */
+#include "host.h"
+
+#define KR_NET_KEY_IDX      0x0000
+#define KR_APP_KEY_IDX      0x0002
+#define KR_MAX_NODES        ((TRANSPORT_BUFFER_SIZE - 20) / 2)
+
+static void kr_start(uint8_t sessions, const uint16_t *p_nodes, uint16_t num_nodes)
+{
+    uint8_t cmd[TRANSPORT_BUFFER_SIZE];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    UINT8_TO_STREAM(p, sessions);
+    UINT16_TO_STREAM(p, KR_NET_KEY_IDX);
+    memset(p, 0x55, WICED_BT_MESH_KEY_LEN);
+    p += WICED_BT_MESH_KEY_LEN;
+    UINT8_TO_STREAM(p, 1);
+    UINT16_TO_STREAM(p, KR_APP_KEY_IDX);
+    memset(p, 0x66, WICED_BT_MESH_KEY_LEN);
+    p += WICED_BT_MESH_KEY_LEN;
+    for (i = 0; i < num_nodes; i++)
+        UINT16_TO_STREAM(p, p_nodes[i]);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, cmd, (uint32_t)(p - cmd));
+}
+
+static void kr_start_no_app_keys(uint16_t num_nodes)
+{
+    uint8_t cmd[TRANSPORT_BUFFER_SIZE];
+    uint8_t *p = cmd;
+    uint16_t i;
+
+    UINT8_TO_STREAM(p, 0);
+    UINT16_TO_STREAM(p, KR_NET_KEY_IDX);
+    memset(p, 0x55, WICED_BT_MESH_KEY_LEN);
+    p += WICED_BT_MESH_KEY_LEN;
+    UINT8_TO_STREAM(p, 0);
+    for (i = 0; i < num_nodes; i++)
+        UINT16_TO_STREAM(p, 0xD00 + i);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, cmd, (uint32_t)(p - cmd));
+}
+
+static void kr_update(uint16_t src)
+{
+    wiced_bt_mesh_config_netkey_status_data_t netkey;
+    wiced_bt_mesh_config_appkey_status_data_t appkey;
+
+    memset(&netkey, 0, sizeof(netkey));
+    host_reply(WICED_BT_MESH_CONFIG_NETKEY_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &netkey);
+    memset(&appkey, 0, sizeof(appkey));
+    host_reply(WICED_BT_MESH_CONFIG_APPKEY_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &appkey);
+}
+
+static void kr_phase(uint16_t src)
+{
+    wiced_bt_mesh_config_key_refresh_phase_status_data_t phase;
+
+    memset(&phase, 0, sizeof(phase));
+    host_reply(WICED_BT_MESH_CONFIG_KEY_REFRESH_PHASE_STATUS, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &phase);
+}
+
+/*
+ * Check progress event at the index among the progress events
+ */
+static void kr_check_progress(int index, uint8_t step, uint16_t addr, uint8_t status, uint16_t confirmed, uint16_t failed)
+{
+    host_sent_t *p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS, index);
+
+    HOST_CHECK(p_sent != NULL);
+    if (p_sent == NULL)
+        return;
+    HOST_CHECK_EQ(p_sent->length, 8);
+    HOST_CHECK_EQ(p_sent->data[0], step);
+    HOST_CHECK_EQ(p_sent->data[1] + (p_sent->data[2] << 8), addr);
+    HOST_CHECK_EQ(p_sent->data[3], status);
+    HOST_CHECK_EQ(p_sent->data[4] + (p_sent->data[5] << 8), confirmed);
+    HOST_CHECK_EQ(p_sent->data[6] + (p_sent->data[7] << 8), failed);
+}
+
+static void test_kr_steps(void)
+{
+    static const uint16_t nodes[] = { 0x0001, 0xC00, 0xC01 };
+    wiced_bt_mesh_config_key_refresh_phase_set_data_t *p_phase;
+    wiced_bt_mesh_config_appkey_change_data_t *p_appkey;
+
+    kr_start(2, nodes, 3);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+
+    // Provisioner is updated first
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_netkey_change"), 1);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_config_netkey_change", 0)->dst, 0x0001);
+    kr_update(0x0001);
+    p_appkey = (wiced_bt_mesh_config_appkey_change_data_t *)host_request_find("wiced_bt_mesh_config_appkey_change", 0)->data;
+    HOST_CHECK_EQ(p_appkey->app_key_idx, KR_APP_KEY_IDX);
+    HOST_CHECK_EQ(p_appkey->app_key[0], 0x66);
+    kr_check_progress(0, 0, 0x0001, 0, 1, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_netkey_change"), 3);
+
+    kr_update(0xC01);
+    kr_update(0xC00);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS), 4);
+    kr_check_progress(3, 0, 0, 0, 3, 0);
+
+    // Phase 2, then phase 3
+    p_phase = (wiced_bt_mesh_config_key_refresh_phase_set_data_t *)host_request_find("wiced_bt_mesh_config_key_refresh_phase_set", 0)->data;
+    HOST_CHECK_EQ(p_phase->transition, 2);
+    kr_phase(0x0001);
+    kr_phase(0xC00);
+    kr_phase(0xC01);
+    kr_check_progress(-1, 1, 0, 0, 3, 0);
+    p_phase = (wiced_bt_mesh_config_key_refresh_phase_set_data_t *)host_request_find("wiced_bt_mesh_config_key_refresh_phase_set", -1)->data;
+    HOST_CHECK_EQ(p_phase->transition, 3);
+    kr_phase(0x0001);
+    kr_phase(0xC00);
+    kr_phase(0xC01);
+
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS), 13);
+    kr_check_progress(-2, 2, 0, 0, 3, 0);
+    kr_check_progress(-1, 3, 0, 0, 3, 0);
+
+    // Statuses of the nodes are not sent to the MCU
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_NETKEY_STATUS), 0);
+}
+
+static void test_kr_node_failed(void)
+{
+    static const uint16_t nodes[] = { 0x0001, 0xC10 };
+    uint32_t count;
+
+    kr_start(0, nodes, 2);
+    kr_update(0x0001);
+
+    // Node is tried three times in each of the two passes
+    for (count = 0; count < 6; count++)
+        host_advance(10000);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_netkey_change"), 7);
+    kr_check_progress(-1, 0, 0, 1, 1, 1);
+
+    // Failed node is not configured in the next steps
+    kr_phase(0x0001);
+    kr_phase(0x0001);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_key_refresh_phase_set"), 2);
+    kr_check_progress(-1, 3, 0, 1, 1, 1);
+}
+
+static void test_kr_invalid(void)
+{
+    static const uint16_t nodes[] = { 0x0001 };
+    uint8_t cmd[22];
+
+    memset(cmd, 0, sizeof(cmd));
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, cmd, 19);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    cmd[19] = 5;
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, cmd, sizeof(cmd));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    cmd[19] = 0;
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, cmd, 21);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Procedure in progress is stopped with the command without nodes
+    kr_start(0, nodes, 1);
+    kr_start(0, nodes, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, NULL, 0);
+    kr_start(0, nodes, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, NULL, 0);
+
+    // Command filling the transport buffer
+    kr_start_no_app_keys(KR_MAX_NODES);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, NULL, 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_kr_steps),
+    HOST_TEST(test_kr_node_failed),
+    HOST_TEST(test_kr_invalid),
+    { NULL, NULL }
+};
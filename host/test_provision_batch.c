@@ -0,0 +1,243 @@
+/*
+ * Unit tests of mesh_provision_batch.c
+ */
+#include "host.h"
+
+#define BATCH_TIMEOUT           30000
+
+static uint32_t batch_cmd(uint16_t server_addr, uint16_t start_addr, uint8_t num_devices, const uint16_t *p_servers, uint8_t num_servers)
+{
+    uint8_t data[TRANSPORT_BUFFER_SIZE];
+    uint8_t *p = data;
+    uint8_t i;
+
+    UINT16_TO_STREAM(p, server_addr);
+    UINT16_TO_STREAM(p, 0);             // net_key_idx
+    UINT16_TO_STREAM(p, start_addr);
+    UINT8_TO_STREAM(p, 0);              // identify_duration
+    UINT8_TO_STREAM(p, 0);              // use_pb_gatt
+    UINT8_TO_STREAM(p, 0);              // algorithm
+    UINT8_TO_STREAM(p, 0);              // public_key_type
+    UINT8_TO_STREAM(p, 1);              // auth_method static
+    UINT8_TO_STREAM(p, 0);              // auth_action
+    UINT8_TO_STREAM(p, 0);              // auth_size
+    UINT8_TO_STREAM(p, 2);              // oob_len
+    UINT8_TO_STREAM(p, 0xAA);
+    UINT8_TO_STREAM(p, 0xBB);
+    UINT8_TO_STREAM(p, num_devices);
+    for (i = 0; i < num_devices; i++)
+    {
+        memset(p, 0x10 + i, MESH_DEVICE_UUID_LEN);
+        p += MESH_DEVICE_UUID_LEN;
+    }
+    if (num_servers != 0)
+    {
+        UINT8_TO_STREAM(p, num_servers);
+        for (i = 0; i < num_servers; i++)
+            UINT16_TO_STREAM(p, p_servers[i]);
+    }
+    return host_cmd(HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH, data, (uint32_t)(p - data));
+}
+
+static void batch_caps(uint16_t server_addr, uint8_t elements_num)
+{
+    wiced_bt_mesh_provision_device_capabilities_data_t caps;
+
+    memset(&caps, 0, sizeof(caps));
+    caps.elements_num = elements_num;
+    host_reply(WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES, server_addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &caps);
+}
+
+static void batch_end(uint16_t server_addr, uint8_t result)
+{
+    wiced_bt_mesh_provision_status_data_t status;
+
+    memset(&status, 0, sizeof(status));
+    status.result = result;
+    memset(status.dev_key, 0x5A, WICED_BT_MESH_KEY_LEN);
+    host_reply(WICED_BT_MESH_PROVISION_END, server_addr, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &status);
+}
+
+static void test_batch_sequence(void)
+{
+    wiced_bt_mesh_provision_device_oob_request_data_t oob_request = { 0, WICED_BT_MESH_PROVISION_GET_OOB_TYPE_ENTER_STATIC, 2, 0 };
+    host_request_t *p_request;
+    host_sent_t *p_sent;
+
+    batch_cmd(1, 0x100, 2, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    p_request = host_request_find("wiced_bt_mesh_provision_connect", 0);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(p_request->data[0], 0x10);
+    HOST_CHECK_EQ(p_request->dst, 1);
+
+    // Busy while the batch is in progress
+    batch_cmd(1, 0x100, 1, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+
+    batch_caps(1, 3);
+    p_request = host_request_find("wiced_bt_mesh_provision_start", 0);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(((wiced_bt_mesh_provision_start_data_t *)p_request->data)->addr, 0x100);
+
+    host_reply(WICED_BT_MESH_PROVISION_GET_OOB_DATA, 1, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &oob_request);
+    p_request = host_request_find("wiced_bt_mesh_provision_client_set_oob", 0);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(p_request->data[0], 0xAA);
+
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0], 0);      // device
+    HOST_CHECK_EQ(p_sent->data[1], 1);      // remaining
+    HOST_CHECK_EQ(p_sent->data[3], WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    HOST_CHECK_EQ(p_sent->data[4] + (p_sent->data[5] << 8), 0x100);
+    HOST_CHECK_EQ(p_sent->data[6], 3);
+    HOST_CHECK_EQ(p_sent->data[7], 0x5A);
+    HOST_CHECK_EQ(p_sent->length, 7 + WICED_BT_MESH_KEY_LEN);
+
+    // Second device gets the address after the elements of the first one
+    p_request = host_request_find("wiced_bt_mesh_provision_connect", 1);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(p_request->data[0], 0x11);
+    batch_caps(1, 1);
+    p_request = host_request_find("wiced_bt_mesh_provision_start", 1);
+    HOST_CHECK_EQ(((wiced_bt_mesh_provision_start_data_t *)p_request->data)->addr, 0x103);
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 2);
+
+    // Batch is done, events are not consumed any more
+    host_reset();
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 0);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_batch_timeout(void)
+{
+    host_sent_t *p_sent;
+
+    batch_cmd(1, 0x200, 1, NULL, 0);
+    host_advance(BATCH_TIMEOUT - 1);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 0);
+    host_advance(1);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_disconnect"), 1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[3], WICED_BT_MESH_PROVISION_RESULT_TIMEOUT);
+
+    // New batch can be started
+    batch_cmd(1, 0x200, 1, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    batch_caps(1, 1);
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+}
+
+static void test_batch_connect_failure(void)
+{
+    host_request_result = WICED_FALSE;
+    batch_cmd(1, 0x300, 3, NULL, 0);
+    host_request_result = WICED_TRUE;
+
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 3);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, 2)->data[1], 0);
+    batch_cmd(1, 0x300, 1, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    batch_caps(1, 1);
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+}
+
+static void test_batch_sessions(void)
+{
+    uint16_t servers[2] = { 0x20, 0x30 };
+    host_sent_t *p_sent;
+
+    batch_cmd(1, 0x400, 4, servers, 2);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_connect"), 3);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_provision_connect", 1)->dst, 0x20);
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_provision_connect", 2)->dst, 0x30);
+
+    // Addresses are reserved in the order of the capabilities
+    batch_caps(0x30, 2);
+    batch_caps(1, 1);
+    HOST_CHECK_EQ(((wiced_bt_mesh_provision_start_data_t *)host_request_find("wiced_bt_mesh_provision_start", 0)->data)->addr, 0x400);
+    HOST_CHECK_EQ(((wiced_bt_mesh_provision_start_data_t *)host_request_find("wiced_bt_mesh_provision_start", 1)->data)->addr, 0x402);
+
+    batch_end(0x30, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, 0);
+    HOST_CHECK_EQ(p_sent->data[0], 2);
+    HOST_CHECK_EQ(p_sent->data[2], 2);      // session
+    HOST_CHECK_EQ(host_request_find("wiced_bt_mesh_provision_connect", 3)->dst, 0x30);
+
+    host_cmd(HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH_STATUS_GET, NULL, 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_STATUS, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0], 1);
+    HOST_CHECK_EQ(p_sent->data[1], 4);
+    HOST_CHECK_EQ(p_sent->data[2], 1);
+    HOST_CHECK_EQ(p_sent->data[3], 3);
+    HOST_CHECK_EQ(p_sent->length, 4 + 3 * 10);
+
+    host_advance(BATCH_TIMEOUT);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 4);
+}
+
+static void test_batch_invalid(void)
+{
+    uint16_t servers[4] = { 2, 3, 4, 5 };
+
+    batch_cmd(1, 0x500, 0, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    batch_cmd(1, 0x500, 17, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    batch_cmd(1, 0x500, 1, servers, 4);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Start address and servers are unicast addresses, servers are not repeated
+    batch_cmd(1, 0x0000, 1, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    batch_cmd(1, 0x8000, 1, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    servers[0] = 0xC000;
+    batch_cmd(1, 0x500, 1, servers, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    servers[0] = 3;
+    batch_cmd(1, 0x500, 1, servers, 2);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    servers[0] = 1;
+    batch_cmd(1, 0x500, 1, servers, 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_connect"), 0);
+}
+
+static void test_batch_address_range(void)
+{
+    host_sent_t *p_sent;
+
+    // Elements of the first device do not fit, the second device gets the last addresses
+    batch_cmd(1, 0x7FFE, 2, NULL, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    batch_caps(1, 3);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_start"), 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_disconnect"), 1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[3], WICED_BT_MESH_PROVISION_RESULT_FAILED);
+    HOST_CHECK_EQ(p_sent->data[6], 3);
+
+    batch_caps(1, 2);
+    HOST_CHECK_EQ(((wiced_bt_mesh_provision_start_data_t *)host_request_find("wiced_bt_mesh_provision_start", 0)->data)->addr, 0x7FFE);
+    batch_end(1, WICED_BT_MESH_PROVISION_RESULT_SUCCESS);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT), 2);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_batch_sequence),
+    HOST_TEST(test_batch_timeout),
+    HOST_TEST(test_batch_connect_failure),
+    HOST_TEST(test_batch_sessions),
+    HOST_TEST(test_batch_invalid),
+    HOST_TEST(test_batch_address_range),
+    { NULL, NULL }
+};
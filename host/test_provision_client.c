@@ -0,0 +1,383 @@
+/*
+ * Unit tests of the command dispatch, batch, transaction and payload decode of mesh_provision_client.c
+ */
+#include "host.h"
+
+#define PUBLICATION_SET_LEN     33
+
+static uint8_t *batch_add(uint8_t *p, uint16_t opcode, const uint8_t *p_data, uint16_t length)
+{
+    UINT16_TO_STREAM(p, length + 2);
+    UINT16_TO_STREAM(p, opcode);
+    memcpy(p, p_data, length);
+    return p + length;
+}
+
+static uint8_t *event_hdr(uint8_t *p, uint16_t dst)
+{
+    memset(p, 0, HOST_EVENT_HDR_LEN);
+    p[0] = (uint8_t)dst;
+    p[1] = (uint8_t)(dst >> 8);
+    return p + HOST_EVENT_HDR_LEN;
+}
+
+static void test_cmd_unknown(void)
+{
+    HOST_CHECK_EQ(host_cmd((HCI_CONTROL_GROUP_MESH << 8) | 0xDF, NULL, 0), WICED_FALSE);
+    HOST_CHECK_EQ(host_cmd((0x17 << 8) | (HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET & 0xFF), NULL, 0), WICED_FALSE);
+    HOST_CHECK_EQ(host_num_sent, 0);
+    HOST_CHECK_EQ(host_cmd(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0), WICED_TRUE);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+}
+
+static void test_cmd_index(void)
+{
+    uint8_t data[HOST_EVENT_HDR_LEN + 2];
+
+    // No command is processed by two entries when every model client is built
+    HOST_CHECK_EQ(mesh_app_hci_cmd_index_init(), WICED_TRUE);
+
+    // Command of a model client front-end
+    event_hdr(data, 0x1234);
+    data[HOST_EVENT_HDR_LEN]     = 0x05;
+    data[HOST_EVENT_HDR_LEN + 1] = 0x00;
+    HOST_CHECK_EQ(host_cmd(HCI_CONTROL_MESH_COMMAND_SCENE_STORE, data, sizeof(data)), WICED_TRUE);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_model_scene_client_send_request"), 1);
+
+    // Commands of the provisioner table
+    HOST_CHECK_EQ(mesh_app_config_cmd_check(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET), WICED_TRUE);
+    HOST_CHECK_EQ(mesh_app_config_cmd_check(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET), WICED_FALSE);
+    HOST_CHECK_EQ(mesh_app_config_cmd_check(HCI_CONTROL_MESH_COMMAND_VENDOR_DATA), WICED_FALSE);
+    HOST_CHECK_EQ(mesh_app_config_cmd_check((HCI_CONTROL_GROUP_MESH << 8) | 0xDF), WICED_FALSE);
+}
+
+static void test_cmd_min_length(void)
+{
+    uint8_t data[HOST_EVENT_HDR_LEN + 2] = { 0 };
+
+    // Local command shorter than its min length
+    host_cmd(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, data, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Config command without the event header is not processed
+    HOST_CHECK_EQ(host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET, data, HOST_EVENT_HDR_LEN - 1), WICED_FALSE);
+
+    // Config command shorter than its min length
+    host_cmd(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET, data, HOST_EVENT_HDR_LEN);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_set"), 0);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_cmd_decode(void)
+{
+    wiced_bt_mesh_config_model_publication_set_data_t *p_set;
+    uint8_t data[PUBLICATION_SET_LEN];
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, 0x0102);
+    UINT16_TO_STREAM(p, 0xFFFF);
+    UINT16_TO_STREAM(p, 0x1000);
+    memset(p, 0, 16);
+    p[0] = 0x01;
+    p[1] = 0xC0;
+    p += 16;
+    UINT16_TO_STREAM(p, 3);
+    UINT8_TO_STREAM(p, 1);
+    UINT8_TO_STREAM(p, 7);
+    UINT32_TO_STREAM(p, 10000);
+    UINT8_TO_STREAM(p, 2);
+    UINT16_TO_STREAM(p, 50);
+
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET, 2, data, sizeof(data) - 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_model_publication_set"), 0);
+
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET, 2, data, sizeof(data));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    p_set = (wiced_bt_mesh_config_model_publication_set_data_t *)host_request_find("wiced_bt_mesh_config_model_publication_set", 0)->data;
+    HOST_CHECK_EQ(p_set->element_addr, 0x0102);
+    HOST_CHECK_EQ(p_set->company_id, 0xFFFF);
+    HOST_CHECK_EQ(p_set->model_id, 0x1000);
+    HOST_CHECK_EQ(p_set->publish_addr[1], 0xC0);
+    HOST_CHECK_EQ(p_set->app_key_idx, 3);
+    HOST_CHECK_EQ(p_set->publish_ttl, 7);
+    HOST_CHECK_EQ(p_set->publish_period, 10000);
+    HOST_CHECK_EQ(p_set->publish_retransmit_interval, 50);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_cmd_decode_model(void)
+{
+    wiced_bt_mesh_time_state_msg_t *p_time;
+    wiced_bt_mesh_light_hsl_set_t *p_hsl;
+    uint8_t data[12];
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, 0x8000);
+    UINT16_TO_STREAM(p, 0x1234);
+    UINT16_TO_STREAM(p, 0xFFFF);
+    UINT32_TO_STREAM(p, 500);
+    UINT16_TO_STREAM(p, 20);
+
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SET, 0x100, data, sizeof(data) - 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_model_light_hsl_client_send_set"), 0);
+
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SET, 0x100, data, sizeof(data));
+    p_hsl = (wiced_bt_mesh_light_hsl_set_t *)host_request_find("wiced_bt_mesh_model_light_hsl_client_send_set", 0)->data;
+    HOST_CHECK_EQ(p_hsl->target.lightness, 0x8000);
+    HOST_CHECK_EQ(p_hsl->target.hue, 0x1234);
+    HOST_CHECK_EQ(p_hsl->target.saturation, 0xFFFF);
+    HOST_CHECK_EQ(p_hsl->transition_time, 500);
+    HOST_CHECK_EQ(p_hsl->delay, 20);
+
+    p = data;
+    UINT40_TO_STREAM(p, 0x0102030405ULL);
+    UINT8_TO_STREAM(p, 6);
+    UINT8_TO_STREAM(p, 7);
+    UINT8_TO_STREAM(p, 1);
+    UINT16_TO_STREAM(p, 0x0809);
+    UINT8_TO_STREAM(p, 0x40);
+
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_TIME_SET, 0x100, data, 11);
+    p_time = (wiced_bt_mesh_time_state_msg_t *)host_request_find("wiced_bt_mesh_model_time_client_time_set_send", 0)->data;
+    HOST_CHECK(p_time->tai_seconds == 0x0102030405ULL);
+    HOST_CHECK_EQ(p_time->subsecond, 6);
+    HOST_CHECK_EQ(p_time->uncertainty, 7);
+    HOST_CHECK_EQ(p_time->time_authority, 1);
+    HOST_CHECK_EQ(p_time->tai_utc_delta_current, 0x0809);
+    HOST_CHECK_EQ(p_time->time_zone_offset_current, 0x40);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_batch(void)
+{
+    uint8_t data[128];
+    uint8_t ttl[HOST_EVENT_HDR_LEN + 1];
+    uint8_t reset = 0;
+    uint8_t *p = data;
+    host_sent_t *p_sent;
+
+    event_hdr(ttl, 2)[0] = 5;
+    p = batch_add(p, HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0);
+    p = batch_add(p, HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET, ttl, sizeof(ttl));
+    p = batch_add(p, HCI_CONTROL_MESH_COMMAND_LATENCY_GET, &reset, 0);
+    p = batch_add(p, (HCI_CONTROL_GROUP_MESH << 8) | 0xDF, NULL, 0);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_BATCH, data, (uint32_t)(p - data));
+
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS), 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_config_default_ttl_set"), 1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_BATCH_STATUS, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0], 4);
+    HOST_CHECK_EQ(p_sent->data[1], HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(p_sent->data[2], HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(p_sent->data[3], HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    HOST_CHECK_EQ(p_sent->data[4], HCI_CONTROL_MESH_STATUS_ERROR);
+}
+
+static void test_batch_bad_length(void)
+{
+    uint8_t data[16];
+    uint8_t *p = data;
+    host_sent_t *p_sent;
+
+    p = batch_add(p, HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, NULL, 0);
+    UINT16_TO_STREAM(p, 10);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_BATCH, data, (uint32_t)(p - data));
+
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_BATCH_STATUS, 0);
+    HOST_CHECK_EQ(p_sent->data[0], 1);
+
+    // Trailing bytes shorter than a command header are ignored
+    host_cmd(HCI_CONTROL_MESH_COMMAND_BATCH, data, 7);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_BATCH_STATUS, 1)->data[0], 1);
+
+    // A length that does not cover the opcode stops the batch
+    p = data;
+    UINT16_TO_STREAM(p, 1);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_BATCH, data, (uint32_t)(p - data));
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_BATCH_STATUS, 2)->data[0], 0);
+}
+
+static void test_transaction(void)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t ttl_status = { 5 };
+    uint8_t data[4 + HOST_EVENT_HDR_LEN];
+    host_sent_t *p_sent;
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, 0x1234);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET);
+    p = event_hdr(p, 0x0A);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRANSACTION, data, (uint32_t)(p - data));
+
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 3);
+    HOST_CHECK_EQ(p_sent->data[0], HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(p_sent->data[1] + (p_sent->data[2] << 8), 0x1234);
+
+    host_reset();
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0A, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    HOST_CHECK_EQ(host_num_sent, 1);
+    HOST_CHECK_EQ(host_sent[0].opcode, HCI_CONTROL_MESH_EVENT_TRANSACTION);
+    HOST_CHECK_EQ(host_sent[0].data[0] + (host_sent[0].data[1] << 8), 0x1234);
+    HOST_CHECK_EQ(host_sent[0].data[2] + (host_sent[0].data[3] << 8), HCI_CONTROL_MESH_EVENT_DEFAULT_TTL_STATUS);
+    HOST_CHECK_EQ(host_sent[0].data[4] + (host_sent[0].data[5] << 8), 0x0A);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+
+    // Second reply is not tagged
+    host_reset();
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0A, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 0);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void tagged_ttl_get(uint16_t tid, uint16_t dst)
+{
+    uint8_t data[4 + HOST_EVENT_HDR_LEN];
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, tid);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET);
+    p = event_hdr(p, dst);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRANSACTION, data, (uint32_t)(p - data));
+}
+
+static void test_transaction_untagged_first(void)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t ttl_status = { 5 };
+    host_sent_t *p_sent;
+    int i;
+
+    // Commands without reply to the same node do not take the transaction ID
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET, 0x0B, NULL, 0);
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET, 0x0B, NULL, 0);
+    tagged_ttl_get(0x2222, 0x0B);
+    tagged_ttl_get(0x3333, 0x0B);
+
+    host_reset();
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0B, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0B, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 2);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRANSACTION, 0);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x2222);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRANSACTION, 1);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x3333);
+
+    // Many untagged commands do not push the tagged command out
+    tagged_ttl_get(0x4444, 0x0B);
+    for (i = 0; i < 20; i++)
+        host_cmd_to(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET, 0x0C, NULL, 0);
+    host_reset();
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0B, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 1);
+    host_advance(30001);
+}
+
+static void test_transaction_group(void)
+{
+    wiced_bt_mesh_config_default_ttl_status_data_t ttl_status = { 5 };
+    host_sent_t *p_sent;
+
+    // Command to a group is tagged in the status only
+    tagged_ttl_get(0x5555, 0xC000);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, -1);
+    HOST_CHECK_EQ(p_sent->data[1] + (p_sent->data[2] << 8), 0x5555);
+    host_reset();
+    host_reply(WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS, 0x0D, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &ttl_status);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 0);
+}
+
+static void test_transaction_vendor(void)
+{
+    uint8_t data[4 + HOST_EVENT_HDR_LEN + 5];
+    wiced_bt_mesh_event_t *p_event;
+    wiced_bt_mesh_hci_event_t *p_hci_event;
+    host_sent_t *p_sent;
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, 0x6666);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_VENDOR_DATA);
+    p = event_hdr(p, 0x0E);
+    UINT16_TO_STREAM(p, 0x0131);
+    UINT16_TO_STREAM(p, 0x0001);
+    UINT8_TO_STREAM(p, 0x01);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_TRANSACTION, data, (uint32_t)(p - data));
+    host_reset();
+
+    // Reply for another model of the node is not the reply to the command
+    p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, 0x0001, 0x0E, 0);
+    p_event->src = 0x0E;
+    p_hci_event = mesh_app_create_hci_event(p_event);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_VENDOR_DATA, (uint8_t *)p_hci_event, sizeof(*p_hci_event));
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 0);
+
+    p_event->company_id = 0x0131;
+    p_hci_event = mesh_app_create_hci_event(p_event);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_VENDOR_DATA, (uint8_t *)p_hci_event, sizeof(*p_hci_event));
+    wiced_bt_mesh_release_event(p_event);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_TRANSACTION, 0);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->length, 4 + sizeof(*p_hci_event));
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x6666);
+    HOST_CHECK_EQ(p_sent->data[2] + (p_sent->data[3] << 8), HCI_CONTROL_MESH_EVENT_VENDOR_DATA);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+static void test_transaction_free(void)
+{
+    wiced_bt_mesh_event_t *p_event;
+    wiced_bt_mesh_hci_event_t *p_hci_event;
+
+    // Tagged event which is not sent releases the whole buffer
+    tagged_ttl_get(0x7777, 0x0F);
+    host_reset();
+    p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, 0x0F, 0);
+    p_event->src = 0x0F;
+    p_hci_event = mesh_app_create_hci_event(p_event);
+    HOST_CHECK(p_hci_event != NULL);
+    HOST_CHECK_EQ(host_buffers_in_use, 1);
+    mesh_app_free_hci_event(p_hci_event);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+
+    // The next event is not taken for the freed one
+    p_hci_event = mesh_app_create_hci_event(p_event);
+    wiced_bt_mesh_release_event(p_event);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_VENDOR_DATA, (uint8_t *)p_hci_event, sizeof(*p_hci_event));
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_TRANSACTION), 0);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+}
+
+static void test_transaction_nested(void)
+{
+    uint8_t data[8];
+    uint8_t *p = data;
+
+    UINT16_TO_STREAM(p, 1);
+    UINT16_TO_STREAM(p, HCI_CONTROL_MESH_COMMAND_TRANSACTION);
+    HOST_CHECK_EQ(host_cmd(HCI_CONTROL_MESH_COMMAND_TRANSACTION, data, (uint32_t)(p - data)), WICED_FALSE);
+    HOST_CHECK_EQ(host_cmd(HCI_CONTROL_MESH_COMMAND_TRANSACTION, data, 3), WICED_FALSE);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_cmd_unknown),
+    HOST_TEST(test_cmd_index),
+    HOST_TEST(test_cmd_min_length),
+    HOST_TEST(test_cmd_decode),
+    HOST_TEST(test_cmd_decode_model),
+    HOST_TEST(test_batch),
+    HOST_TEST(test_batch_bad_length),
+    HOST_TEST(test_transaction),
+    HOST_TEST(test_transaction_untagged_first),
+    HOST_TEST(test_transaction_group),
+    HOST_TEST(test_transaction_vendor),
+    HOST_TEST(test_transaction_free),
+    HOST_TEST(test_transaction_nested),
+    { NULL, NULL }
+};
@@ -0,0 +1,148 @@
+/*
+ * Unit tests of mesh_provision_oob.c
+ */
+#include "host.h"
+
+#define OOB_MAX_ENTRIES     48
+
+static uint8_t *oob_entry(uint8_t *p, uint8_t uuid0, uint8_t len, uint8_t value)
+{
+    memset(p, 0, MESH_DEVICE_UUID_LEN);
+    p[0] = uuid0;
+    p += MESH_DEVICE_UUID_LEN;
+    *p++ = len;
+    memset(p, value, len);
+    return p + len;
+}
+
+static host_sent_t *oob_stats_get(uint8_t reset)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_STATS_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_STATIC_OOB_STATS, -1);
+}
+
+static void test_oob_add_and_get(void)
+{
+    uint8_t data[1 + 3 * (MESH_DEVICE_UUID_LEN + 1 + 32)];
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 0 };
+    uint8_t *p_oob;
+    uint8_t *p = data;
+    host_sent_t *p_sent;
+
+    *p++ = 1;   // clear
+    p = oob_entry(p, 0x30, 16, 0x33);
+    p = oob_entry(p, 0x10, 32, 0x11);
+    p = oob_entry(p, 0x20, 16, 0x22);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    oob_stats_get(1);
+
+    uuid[0] = 0x10;
+    HOST_CHECK_EQ(mesh_app_static_oob_get(uuid, &p_oob), 32);
+    HOST_CHECK_EQ(p_oob[31], 0x11);
+    uuid[0] = 0x30;
+    HOST_CHECK_EQ(mesh_app_static_oob_get(uuid, &p_oob), 16);
+    HOST_CHECK_EQ(p_oob[0], 0x33);
+    uuid[0] = 0x25;
+    HOST_CHECK_EQ(mesh_app_static_oob_get(uuid, &p_oob), 0);
+
+    // Entry with the same UUID replaces the value
+    p = data;
+    *p++ = 0;
+    p = oob_entry(p, 0x20, 16, 0x44);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+    uuid[0] = 0x20;
+    HOST_CHECK_EQ(mesh_app_static_oob_get(uuid, &p_oob), 16);
+    HOST_CHECK_EQ(p_oob[0], 0x44);
+
+    p_sent = oob_stats_get(1);
+    HOST_CHECK_EQ(p_sent->data[0], 3);
+    HOST_CHECK_EQ(p_sent->data[1], 3);
+    HOST_CHECK_EQ(p_sent->data[5], 1);
+}
+
+static void test_oob_add_invalid(void)
+{
+    uint8_t data[1 + 2 * (MESH_DEVICE_UUID_LEN + 1) + 16 + 33];
+    uint8_t uuid[MESH_DEVICE_UUID_LEN] = { 0 };
+    uint8_t num_entries = oob_stats_get(0)->data[0];
+    uint8_t *p_oob;
+    uint8_t *p = data;
+
+    *p++ = 1;
+    p = oob_entry(p, 0x10, 33, 0);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    p = data + 1;
+    p = oob_entry(p, 0x10, 16, 0);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data) - 1);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+
+    // Valid entry before the invalid one is not added and the table is not cleared
+    p = data + 1;
+    p = oob_entry(p, 0x50, 16, 0x55);
+    p = oob_entry(p, 0x51, 33, 0);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    HOST_CHECK_EQ(oob_stats_get(0)->data[0], num_entries);
+    uuid[0] = 0x50;
+    HOST_CHECK_EQ(mesh_app_static_oob_get(uuid, &p_oob), 0);
+}
+
+static void test_oob_table_full(void)
+{
+    uint8_t data[1 + MESH_DEVICE_UUID_LEN + 1 + 16];
+    uint8_t *p;
+    uint32_t i;
+
+    for (i = 0; i <= OOB_MAX_ENTRIES; i++)
+    {
+        data[0] = (i == 0);
+        p = oob_entry(data + 1, (uint8_t)i, 16, 0);
+        host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+    }
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    HOST_CHECK_EQ(oob_stats_get(0)->data[0], OOB_MAX_ENTRIES);
+}
+
+static void test_oob_request_supplied(void)
+{
+    wiced_bt_mesh_provision_device_oob_request_data_t oob_request = { 0x40, WICED_BT_MESH_PROVISION_GET_OOB_TYPE_ENTER_STATIC, 16, 0 };
+    uint8_t data[1 + MESH_DEVICE_UUID_LEN + 1 + 16];
+    uint8_t connect[MESH_DEVICE_UUID_LEN + 3] = { 0 };
+    host_request_t *p_request;
+    uint8_t *p;
+
+    data[0] = 1;
+    p = oob_entry(data + 1, 0x77, 16, 0x99);
+    host_cmd(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, data, (uint32_t)(p - data));
+
+    connect[0] = 0x77;
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_PROVISION_CONNECT, 0x40, connect, sizeof(connect));
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_connect"), 1);
+
+    host_reset();
+    host_reply(WICED_BT_MESH_PROVISION_GET_OOB_DATA, 0x40, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &oob_request);
+    p_request = host_request_find("wiced_bt_mesh_provision_client_set_oob", 0);
+    HOST_CHECK(p_request != NULL);
+    HOST_CHECK_EQ(p_request->dst, 0x40);
+    HOST_CHECK_EQ(p_request->data[0], 0x99);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_OOB_DATA), 0);
+    HOST_CHECK_EQ(host_buffers_in_use, 0);
+
+    // Device of another server is not in the table, request goes to the MCU
+    oob_request.provisioner_addr = 0x41;
+    host_reply(WICED_BT_MESH_PROVISION_GET_OOB_DATA, 0x41, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &oob_request);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_OOB_DATA), 1);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_oob_add_and_get),
+    HOST_TEST(test_oob_add_invalid),
+    HOST_TEST(test_oob_table_full),
+    HOST_TEST(test_oob_request_supplied),
+    { NULL, NULL }
+};
@@ -0,0 +1,101 @@
+/*
+ * Unit tests of mesh_provision_phase.c
+ */
+#include "host.h"
+
+#define PHASE_STATS_LEN     10
+
+static void phase_events_set(uint8_t enable)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_SET, &enable, 1);
+}
+
+static host_sent_t *phase_stats_get(uint8_t reset)
+{
+    host_cmd(HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_STATS_GET, &reset, 1);
+    return host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE_STATS, -1);
+}
+
+static uint32_t phase_stat(host_sent_t *p_sent, uint8_t phase, uint8_t field)
+{
+    uint8_t *p = &p_sent->data[1 + phase * PHASE_STATS_LEN];
+
+    if (field == 0)
+        return p[0] + (p[1] << 8);
+    p += 2 + (field - 1) * 4;
+    return p[0] + (p[1] << 8) + (p[2] << 16) + ((uint32_t)p[3] << 24);
+}
+
+static void test_phase_events(void)
+{
+    wiced_bt_mesh_provision_device_capabilities_data_t caps;
+    host_sent_t *p_sent;
+
+    phase_events_set(1);
+    phase_stats_get(1);
+    host_reset();
+
+    mesh_app_provision_phase(0x50, MESH_APP_PROVISION_PHASE_CONNECT, 0);
+    host_advance(100);
+    memset(&caps, 0, sizeof(caps));
+    caps.elements_num = 2;
+    host_reply(WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES, 0x50, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &caps);
+
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE), 2);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE, 1);
+    HOST_CHECK_EQ(p_sent->data[0] + (p_sent->data[1] << 8), 0x50);
+    HOST_CHECK_EQ(p_sent->data[2], MESH_APP_PROVISION_PHASE_CAPABILITIES);
+    HOST_CHECK_EQ(p_sent->data[3], 2);
+    HOST_CHECK_EQ(p_sent->data[4] + (p_sent->data[5] << 8), (uint16_t)host_now());
+
+    host_advance(50);
+    mesh_app_provision_phase(0x50, MESH_APP_PROVISION_PHASE_START, 0);
+    p_sent = phase_stats_get(1);
+    HOST_CHECK_EQ(p_sent->data[0], MESH_APP_PROVISION_NUM_PHASES);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_CONNECT, 0), 0);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_CAPABILITIES, 0), 1);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_CAPABILITIES, 1), 100);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_START, 2), 50);
+
+    host_reset();
+    phase_events_set(0);
+    mesh_app_provision_phase(0x50, MESH_APP_PROVISION_PHASE_END, 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE), 0);
+}
+
+static void test_phase_unknown_link(void)
+{
+    host_sent_t *p_sent;
+
+    phase_stats_get(1);
+    mesh_app_provision_phase(0x60, MESH_APP_PROVISION_PHASE_END, 0);
+    p_sent = phase_stats_get(1);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_END, 0), 0);
+}
+
+static void test_phase_links_replaced(void)
+{
+    host_sent_t *p_sent;
+    uint16_t addr;
+
+    phase_stats_get(1);
+    for (addr = 0x70; addr < 0x75; addr++)
+    {
+        mesh_app_provision_phase(addr, MESH_APP_PROVISION_PHASE_CONNECT, 0);
+        host_advance(10);
+    }
+    // Link with the oldest phase change was taken by the last server
+    mesh_app_provision_phase(0x70, MESH_APP_PROVISION_PHASE_LINK, 0);
+    mesh_app_provision_phase(0x74, MESH_APP_PROVISION_PHASE_LINK, 0);
+    p_sent = phase_stats_get(1);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_LINK, 0), 1);
+    HOST_CHECK_EQ(phase_stat(p_sent, MESH_APP_PROVISION_PHASE_LINK, 1), 10);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_phase_events),
+    HOST_TEST(test_phase_unknown_link),
+    HOST_TEST(test_phase_links_replaced),
+    { NULL, NULL }
+};
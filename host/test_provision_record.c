@@ -0,0 +1,203 @@
+/*
+ * Unit tests of mesh_provision_record.c
+ */
+#include "host.h"
+
+#define RECORD_CHUNK_LEN        128
+#define RECORD_STATUS_TIMEOUT   0xFF
+
+static void record_fetch(uint16_t dst, uint16_t record_id, uint16_t fragment_size, uint8_t uuid0, uint8_t key_len)
+{
+    uint8_t data[21];
+    uint8_t *p = data;
+
+    UINT16_TO_BE_STREAM(p, record_id);
+    UINT16_TO_BE_STREAM(p, fragment_size);
+    memset(p, uuid0, MESH_DEVICE_UUID_LEN);
+    p[MESH_DEVICE_UUID_LEN - 1] = dst;
+    p += MESH_DEVICE_UUID_LEN;
+    UINT8_TO_STREAM(p, key_len);
+    host_cmd_to(HCI_CONTROL_MESH_COMMAND_PROVISION_RECORD_FETCH, dst, data, sizeof(data));
+}
+
+static void record_fragment(uint16_t src, uint16_t record_id, uint8_t status, uint16_t offset, uint16_t total_len, uint16_t size)
+{
+    wiced_bt_mesh_core_provisioning_record_t record;
+    uint16_t i;
+
+    memset(&record, 0, sizeof(record));
+    record.status                    = status;
+    record.u.response.record_id      = record_id;
+    record.u.response.fragment_offset = offset;
+    record.u.response.total_length   = total_len;
+    record.size                      = size;
+    for (i = 0; i < size; i++)
+        record.data[i] = (uint8_t)(offset + i);
+    host_reply(WICED_BT_MESH_DEVICE_PROVISIONING_RECORD_RESP, src, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &record);
+}
+
+static uint16_t record_u16(host_sent_t *p_sent, uint8_t offset)
+{
+    return (p_sent->data[offset] << 8) + p_sent->data[offset + 1];
+}
+
+static void test_record_fetch_and_cache(void)
+{
+    wiced_bt_mesh_provision_device_record_fragment_data_t *p_fragment;
+    host_sent_t *p_sent;
+
+    record_fetch(0x10, 2, 100, 0xC0, 4);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 1);
+    p_fragment = (wiced_bt_mesh_provision_device_record_fragment_data_t *)host_request_find("wiced_bt_mesh_provision_retrieve_record", 0)->data;
+    HOST_CHECK_EQ(p_fragment->record_id, 2);
+    HOST_CHECK_EQ(p_fragment->fragment_offset, 0);
+    HOST_CHECK_EQ(p_fragment->total_length, 100);
+
+    record_fragment(0x10, 2, 0, 0, 250, 100);
+    record_fragment(0x10, 2, 0, 100, 250, 100);
+    record_fragment(0x10, 2, 0, 200, 250, 50);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 3);
+    p_fragment = (wiced_bt_mesh_provision_device_record_fragment_data_t *)host_request_find("wiced_bt_mesh_provision_retrieve_record", 2)->data;
+    HOST_CHECK_EQ(p_fragment->fragment_offset, 200);
+
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 3);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, 2);
+    HOST_CHECK_EQ(p_sent->data[0], 0);
+    HOST_CHECK_EQ(record_u16(p_sent, 1), 2);
+    HOST_CHECK_EQ(record_u16(p_sent, 3), 200);
+    HOST_CHECK_EQ(record_u16(p_sent, 5), 250);
+    HOST_CHECK_EQ(p_sent->length, 7 + 50);
+    HOST_CHECK_EQ(p_sent->data[7], 200);
+
+    // Device with the same UUID prefix gets the record from the cache
+    host_reset();
+    record_fetch(0x11, 2, 100, 0xC0, 4);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 2);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, 1);
+    HOST_CHECK_EQ(record_u16(p_sent, 3), RECORD_CHUNK_LEN);
+    HOST_CHECK_EQ(p_sent->length, 7 + 250 - RECORD_CHUNK_LEN);
+    HOST_CHECK_EQ(p_sent->data[7], RECORD_CHUNK_LEN);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+
+    // Without the cache the record is retrieved
+    host_reset();
+    record_fetch(0x11, 2, 100, 0xC0, 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 1);
+    record_fragment(0x11, 2, 0, 0, 50, 50);
+}
+
+static void test_record_busy(void)
+{
+    record_fetch(0x20, 3, 100, 0xD0, 0);
+    host_reset();
+    record_fetch(0x21, 4, 100, 0xD0, 0);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_ERROR);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 0);
+
+    // Fragments of other devices and records are sent to the MCU as received
+    record_fragment(0x21, 3, 0, 0, 10, 10);
+    record_fragment(0x20, 4, 0, 0, 10, 10);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_RESPONSE), 2);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 0);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 0);
+
+    record_fragment(0x20, 3, 0, 0, 10, 10);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 1);
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+static void test_record_timeout(void)
+{
+    host_sent_t *p_sent;
+
+    record_fetch(0x50, 7, 100, 0xF0, 4);
+    record_fragment(0x50, 7, 0, 0, 300, 100);
+    host_advance(9999);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 1);
+    host_advance(1);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, 1);
+    HOST_CHECK(p_sent != NULL);
+    HOST_CHECK_EQ(p_sent->data[0], RECORD_STATUS_TIMEOUT);
+    HOST_CHECK_EQ(record_u16(p_sent, 1), 7);
+    HOST_CHECK_EQ(record_u16(p_sent, 3), 100);
+    HOST_CHECK_EQ(p_sent->length, 7);
+
+    // Next record can be retrieved, the partial one is not cached
+    host_reset();
+    record_fetch(0x51, 7, 100, 0xF0, 4);
+    HOST_CHECK_EQ(host_last_status(), HCI_CONTROL_MESH_STATUS_SUCCESS);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 1);
+    record_fragment(0x51, 7, 0, 0, 10, 10);
+    host_advance(10000);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 1);
+}
+
+static void test_record_error(void)
+{
+    host_sent_t *p_sent;
+
+    record_fetch(0x30, 5, 100, 0xE0, 4);
+    record_fragment(0x30, 5, 0, 0, 300, 100);
+    record_fragment(0x30, 5, 3, 100, 300, 0);
+    p_sent = host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, 1);
+    HOST_CHECK_EQ(p_sent->data[0], 3);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 2);
+
+    // Partial record is not cached
+    host_reset();
+    record_fetch(0x31, 5, 100, 0xE0, 4);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 1);
+    record_fragment(0x31, 5, 0, 0, 10, 10);
+
+    // Fragments are sent to the MCU when no record is retrieved
+    host_reset();
+    record_fragment(0x31, 5, 0, 0, 10, 10);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 0);
+}
+
+static void record_retrieve(uint16_t dst, uint16_t record_id, uint8_t uuid0, uint16_t total_len)
+{
+    uint16_t offset;
+
+    record_fetch(dst, record_id, 120, uuid0, 4);
+    for (offset = 0; offset < total_len; offset += 120)
+        record_fragment(dst, record_id, 0, offset, total_len, (total_len - offset > 120) ? 120 : total_len - offset);
+}
+
+static void test_record_cache_eviction(void)
+{
+    uint8_t i;
+
+    // Arena holds three records of 600 bytes, the least recently used is dropped for the fourth
+    for (i = 0; i < 3; i++)
+        record_retrieve(0x40, 6, 0x80 + i, 600);
+    host_reset();
+    record_fetch(0x40, 6, 120, 0x80, 4);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 0);
+
+    record_retrieve(0x40, 6, 0x83, 600);
+    host_reset();
+    record_fetch(0x40, 6, 120, 0x81, 4);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 1);
+    record_fragment(0x40, 6, 1, 0, 0, 0);
+
+    host_reset();
+    record_fetch(0x40, 6, 120, 0x80, 4);
+    record_fetch(0x40, 6, 120, 0x83, 4);
+    HOST_CHECK_EQ(host_request_count("wiced_bt_mesh_provision_retrieve_record"), 0);
+    HOST_CHECK_EQ(host_sent_count(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA), 10);
+    HOST_CHECK_EQ(host_sent_find(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, 9)->data[7], (uint8_t)(4 * RECORD_CHUNK_LEN));
+    HOST_CHECK_EQ(host_events_in_use, 0);
+}
+
+const host_test_t host_tests[] =
+{
+    HOST_TEST(test_record_fetch_and_cache),
+    HOST_TEST(test_record_busy),
+    HOST_TEST(test_record_error),
+    HOST_TEST(test_record_timeout),
+    HOST_TEST(test_record_cache_eviction),
+    { NULL, NULL }
+};
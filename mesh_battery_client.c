@@ -48,6 +48,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 
 /******************************************************
@@ -75,8 +76,8 @@ void mesh_battery_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -86,7 +87,7 @@ void mesh_battery_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *
                 p_data->presence, p_data->charging, p_data->level_inidicator, p_data->servicability);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_battery_hci_event_send(p_hci_event, p_data);
 #endif
         break;
@@ -126,6 +127,18 @@ uint32_t mesh_battery_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint3
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_battery_client_proc_rx_cmd
+ */
+static const uint16_t mesh_battery_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_BATTERY_GET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_battery_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_BATTERY_CLNT, mesh_battery_client_hci_opcodes, mesh_battery_client_proc_rx_cmd);
+#endif
+
 #ifdef HCI_CONTROL
 /*
  * Send Battery Get event over transport
@@ -142,7 +155,7 @@ void mesh_battery_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, mesh_ba
     UINT8_TO_STREAM(p, p_data->level_inidicator);
     UINT8_TO_STREAM(p, p_data->servicability);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_BATTERY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_BATTERY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
@@ -0,0 +1,354 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file keeps the composition data pages received from the nodes in a small cache keyed
+ * by the company ID, product ID and version ID of the node. The MCU which knows the product of
+ * a new node can get its composition data from the cache without the segmented exchange with
+ * the node. Each page is stored with its hash, and a node of the same product reporting
+ * different composition data replaces the cached page.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_COMPOSITION_CACHE_ARENA_SIZE   2048    // Memory for the cached pages
+#define MESH_COMPOSITION_CACHE_MAX_ENTRIES  8       // Max number of cached pages
+#define MESH_COMPOSITION_CACHE_MAX_NODES    8       // Nodes for which page 0 was received recently
+
+#define MESH_COMPOSITION_PAGE0_HEADER_LEN   6       // CID, PID and VID at the start of page 0
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t    company_id;
+    uint16_t    product_id;
+    uint16_t    version_id;
+    uint8_t     page;
+    uint8_t     in_use;
+    uint32_t    hash;                       // Hash of the page
+    uint16_t    offset;                     // Offset of the page in the arena
+    uint16_t    len;
+    uint32_t    last_used;                  // Value of the use counter when the page was last used
+} mesh_composition_cache_entry_t;
+
+// Product of the node, used to cache pages other than 0 which do not contain the CID, PID and VID
+typedef struct
+{
+    uint16_t    addr;
+    uint16_t    company_id;
+    uint16_t    product_id;
+    uint16_t    version_id;
+} mesh_composition_cache_node_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static uint32_t mesh_composition_cache_hash(uint8_t *p_data, uint16_t len);
+static mesh_composition_cache_entry_t *mesh_composition_cache_find(uint16_t company_id, uint16_t product_id, uint16_t version_id, uint8_t page);
+static mesh_composition_cache_entry_t *mesh_composition_cache_alloc(uint16_t len);
+static void mesh_composition_cache_store(uint16_t company_id, uint16_t product_id, uint16_t version_id, uint8_t page, uint8_t *p_data, uint16_t len);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static uint8_t                          mesh_composition_cache_arena[MESH_COMPOSITION_CACHE_ARENA_SIZE];
+static mesh_composition_cache_entry_t   mesh_composition_cache[MESH_COMPOSITION_CACHE_MAX_ENTRIES];
+static mesh_composition_cache_node_t    mesh_composition_cache_nodes[MESH_COMPOSITION_CACHE_MAX_NODES];
+static uint8_t                          mesh_composition_cache_next_node = 0;
+static uint32_t                         mesh_composition_cache_use_count = 0;
+
+// Counters of the pages sent from the cache, requested from the node, and replaced because of
+// different content
+static uint32_t                         mesh_composition_cache_hits = 0;
+static uint32_t                         mesh_composition_cache_misses = 0;
+static uint32_t                         mesh_composition_cache_mismatches = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * FNV-1a hash of the page
+ */
+uint32_t mesh_composition_cache_hash(uint8_t *p_data, uint16_t len)
+{
+    uint32_t hash = 2166136261u;
+    uint16_t i;
+
+    for (i = 0; i < len; i++)
+        hash = (hash ^ p_data[i]) * 16777619u;
+    return hash;
+}
+
+/*
+ * Find the page of the product in the cache
+ */
+mesh_composition_cache_entry_t *mesh_composition_cache_find(uint16_t company_id, uint16_t product_id, uint16_t version_id, uint8_t page)
+{
+    mesh_composition_cache_entry_t *p_entry;
+    uint8_t i;
+
+    for (i = 0; i < MESH_COMPOSITION_CACHE_MAX_ENTRIES; i++)
+    {
+        p_entry = &mesh_composition_cache[i];
+        if (p_entry->in_use && (p_entry->company_id == company_id) && (p_entry->product_id == product_id) &&
+            (p_entry->version_id == version_id) && (p_entry->page == page))
+            return p_entry;
+    }
+    return NULL;
+}
+
+/*
+ * Allocate space for the page in the arena. Least recently used pages are dropped until there
+ * is enough space, and the remaining pages are moved to the start of the arena.
+ */
+mesh_composition_cache_entry_t *mesh_composition_cache_alloc(uint16_t len)
+{
+    mesh_composition_cache_entry_t *p_entry, *p_lru, *p_free;
+    uint16_t used;
+    uint8_t  i, j;
+
+    if (len > MESH_COMPOSITION_CACHE_ARENA_SIZE)
+        return NULL;
+
+    while (1)
+    {
+        used   = 0;
+        p_lru  = NULL;
+        p_free = NULL;
+        for (i = 0; i < MESH_COMPOSITION_CACHE_MAX_ENTRIES; i++)
+        {
+            p_entry = &mesh_composition_cache[i];
+            if (!p_entry->in_use)
+            {
+                p_free = p_entry;
+                continue;
+            }
+            used += p_entry->len;
+            if ((p_lru == NULL) || (p_entry->last_used < p_lru->last_used))
+                p_lru = p_entry;
+        }
+        if ((p_free != NULL) && (used + len <= MESH_COMPOSITION_CACHE_ARENA_SIZE))
+            break;
+        p_lru->in_use = WICED_FALSE;
+    }
+
+    // Compact the arena in the order of the offsets
+    used = 0;
+    for (i = 0; i < MESH_COMPOSITION_CACHE_MAX_ENTRIES; i++)
+    {
+        p_lru = NULL;
+        for (j = 0; j < MESH_COMPOSITION_CACHE_MAX_ENTRIES; j++)
+        {
+            p_entry = &mesh_composition_cache[j];
+            if (p_entry->in_use && (p_entry->offset >= used) && ((p_lru == NULL) || (p_entry->offset < p_lru->offset)))
+                p_lru = p_entry;
+        }
+        if (p_lru == NULL)
+            break;
+        memmove(&mesh_composition_cache_arena[used], &mesh_composition_cache_arena[p_lru->offset], p_lru->len);
+        p_lru->offset = used;
+        used += p_lru->len;
+    }
+    p_free->offset = used;
+    p_free->len    = len;
+    return p_free;
+}
+
+/*
+ * Save the page received from a node of the product. The page already in the cache is kept if
+ * the hash is the same.
+ */
+void mesh_composition_cache_store(uint16_t company_id, uint16_t product_id, uint16_t version_id, uint8_t page, uint8_t *p_data, uint16_t len)
+{
+    mesh_composition_cache_entry_t *p_entry;
+    uint32_t hash = mesh_composition_cache_hash(p_data, len);
+
+    if ((p_entry = mesh_composition_cache_find(company_id, product_id, version_id, page)) != NULL)
+    {
+        if ((p_entry->hash == hash) && (p_entry->len == len))
+        {
+            p_entry->last_used = ++mesh_composition_cache_use_count;
+            return;
+        }
+        WICED_BT_TRACE("comp cache mismatch cid:%x pid:%x vid:%x page:%d\n", company_id, product_id, version_id, page);
+        mesh_composition_cache_mismatches++;
+        p_entry->in_use = WICED_FALSE;
+    }
+    if ((p_entry = mesh_composition_cache_alloc(len)) == NULL)
+        return;
+
+    p_entry->company_id = company_id;
+    p_entry->product_id = product_id;
+    p_entry->version_id = version_id;
+    p_entry->page       = page;
+    p_entry->hash       = hash;
+    p_entry->in_use     = WICED_TRUE;
+    p_entry->last_used  = ++mesh_composition_cache_use_count;
+    memcpy(&mesh_composition_cache_arena[p_entry->offset], p_data, len);
+}
+
+/*
+ * Save the composition data received from the node in the cache. Called for all config client
+ * events, including the events consumed by the application.
+ */
+void mesh_app_composition_cache_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    wiced_bt_mesh_config_composition_data_status_data_t *p_comp = (wiced_bt_mesh_config_composition_data_status_data_t *)p_data;
+    mesh_composition_cache_node_t *p_node = NULL;
+    uint8_t i;
+
+    if ((event != WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS) || (p_comp->data_len == 0))
+        return;
+
+    for (i = 0; i < MESH_COMPOSITION_CACHE_MAX_NODES; i++)
+    {
+        if (mesh_composition_cache_nodes[i].addr == p_event->src)
+            p_node = &mesh_composition_cache_nodes[i];
+    }
+    if (p_comp->page_number == 0)
+    {
+        if (p_comp->data_len < MESH_COMPOSITION_PAGE0_HEADER_LEN)
+            return;
+
+        if (p_node == NULL)
+        {
+            p_node = &mesh_composition_cache_nodes[mesh_composition_cache_next_node];
+            mesh_composition_cache_next_node = (mesh_composition_cache_next_node + 1) % MESH_COMPOSITION_CACHE_MAX_NODES;
+        }
+        p_node->addr       = p_event->src;
+        p_node->company_id = p_comp->data[0] + (p_comp->data[1] << 8);
+        p_node->product_id = p_comp->data[2] + (p_comp->data[3] << 8);
+        p_node->version_id = p_comp->data[4] + (p_comp->data[5] << 8);
+    }
+    // Other pages can be saved only if page 0 of the node was received before
+    else if (p_node == NULL)
+    {
+        return;
+    }
+    mesh_composition_cache_store(p_node->company_id, p_node->product_id, p_node->version_id, p_comp->page_number, p_comp->data, p_comp->data_len);
+}
+
+/*
+ * Process command from MCU to get composition data of the node of the known product. The command
+ * contains company ID (2 bytes), product ID (2 bytes), version ID (2 bytes) and page (1 byte).
+ * If the page is in the cache, the composition data status event is sent without the exchange
+ * with the node, otherwise the composition data is requested from the node.
+ */
+uint8_t mesh_app_process_composition_cache_get(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
+{
+    wiced_bt_mesh_config_composition_data_get_data_t data;
+    mesh_composition_cache_entry_t *p_entry;
+    wiced_bt_mesh_hci_event_t *p_hci_event;
+    uint16_t company_id, product_id, version_id;
+    uint8_t *p;
+
+    STREAM_TO_UINT16(company_id, p_data);
+    STREAM_TO_UINT16(product_id, p_data);
+    STREAM_TO_UINT16(version_id, p_data);
+    STREAM_TO_UINT8(data.page_number, p_data);
+
+    if ((p_entry = mesh_composition_cache_find(company_id, product_id, version_id, data.page_number)) == NULL)
+    {
+        mesh_composition_cache_misses++;
+        return wiced_bt_mesh_config_composition_data_get(p_event, &data) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
+    }
+
+    // Event is sent as if it was received from the node
+    p_event->src = p_event->dst;
+    p_hci_event = mesh_app_create_hci_event(p_event);
+    wiced_bt_mesh_release_event(p_event);
+    if (p_hci_event == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_composition_cache_hits++;
+    p_entry->last_used = ++mesh_composition_cache_use_count;
+
+    p = p_hci_event->data;
+    UINT8_TO_STREAM(p, data.page_number);
+    ARRAY_TO_STREAM(p, &mesh_composition_cache_arena[p_entry->offset], p_entry->len);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the number of cached pages and the cache counters, and to
+ * reset the counters if requested
+ */
+uint8_t mesh_app_process_composition_cache_stats_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t num_entries = 0;
+    uint8_t i;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    for (i = 0; i < MESH_COMPOSITION_CACHE_MAX_ENTRIES; i++)
+    {
+        if (mesh_composition_cache[i].in_use)
+            num_entries++;
+    }
+    p = p_buffer;
+    UINT8_TO_STREAM(p, num_entries);
+    UINT32_TO_STREAM(p, mesh_composition_cache_hits);
+    UINT32_TO_STREAM(p, mesh_composition_cache_misses);
+    UINT32_TO_STREAM(p, mesh_composition_cache_mismatches);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_COMPOSITION_CACHE_STATS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (p_data[0] != 0)
+    {
+        mesh_composition_cache_hits       = 0;
+        mesh_composition_cache_misses     = 0;
+        mesh_composition_cache_mismatches = 0;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
@@ -0,0 +1,333 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file parses composition data page 0 of each node once and keeps an index of the models
+ * of the node. Models are kept in an array sorted by the model ID, so the elements hosting a
+ * model are found with a binary search. The MCU and the application can find the elements of a
+ * node, or of all indexed nodes, which host a model without parsing the composition data.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_COMPOSITION_INDEX_MAX_NODES    32      // Max number of indexed nodes
+#define MESH_COMPOSITION_INDEX_MAX_MODELS   512     // Max number of models of all indexed nodes
+#define MESH_COMPOSITION_INDEX_MAX_RESULTS  48      // Max number of elements in one event
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+// Models of the node are at the index first to first + num_models - 1 of the model arrays.
+// Nodes are kept in the order of their models in the arrays.
+typedef struct
+{
+    uint16_t    addr;
+    uint16_t    first;
+    uint16_t    num_models;
+    uint32_t    last_used;
+} mesh_composition_index_node_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_composition_index_remove(uint8_t node_idx);
+static mesh_composition_index_node_t *mesh_composition_index_node_find(uint16_t addr);
+static void mesh_composition_index_add(uint16_t addr, uint8_t *p_data, uint16_t len);
+static uint16_t mesh_composition_index_search(mesh_composition_index_node_t *p_node, uint32_t model);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_composition_index_node_t    mesh_composition_index_nodes[MESH_COMPOSITION_INDEX_MAX_NODES];
+static uint8_t                          mesh_composition_index_num_nodes = 0;
+static uint16_t                         mesh_composition_index_num_models = 0;
+static uint32_t                         mesh_composition_index_use_count = 0;
+
+// Company ID in the high and model ID in the low 16 bits, and the index of the element hosting the model
+static uint32_t                         mesh_composition_index_models[MESH_COMPOSITION_INDEX_MAX_MODELS];
+static uint8_t                          mesh_composition_index_elements[MESH_COMPOSITION_INDEX_MAX_MODELS];
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Remove the node and its models from the index
+ */
+void mesh_composition_index_remove(uint8_t node_idx)
+{
+    mesh_composition_index_node_t *p_node = &mesh_composition_index_nodes[node_idx];
+    uint16_t first = p_node->first;
+    uint16_t num   = p_node->num_models;
+    uint8_t  i;
+
+    memmove(&mesh_composition_index_models[first], &mesh_composition_index_models[first + num],
+            (mesh_composition_index_num_models - first - num) * sizeof(uint32_t));
+    memmove(&mesh_composition_index_elements[first], &mesh_composition_index_elements[first + num],
+            mesh_composition_index_num_models - first - num);
+    mesh_composition_index_num_models -= num;
+
+    for (i = node_idx + 1; i < mesh_composition_index_num_nodes; i++)
+        mesh_composition_index_nodes[i].first -= num;
+
+    memmove(p_node, p_node + 1, (mesh_composition_index_num_nodes - node_idx - 1) * sizeof(mesh_composition_index_node_t));
+    mesh_composition_index_num_nodes--;
+}
+
+/*
+ * Find the node in the index
+ */
+mesh_composition_index_node_t *mesh_composition_index_node_find(uint16_t addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < mesh_composition_index_num_nodes; i++)
+    {
+        if (mesh_composition_index_nodes[i].addr == addr)
+            return &mesh_composition_index_nodes[i];
+    }
+    return NULL;
+}
+
+/*
+ * Parse composition data page 0 of the node and add its models to the index. Each element has
+ * location (2 bytes), number of SIG models (1 byte), number of vendor models (1 byte), SIG model
+ * IDs (2 bytes each) and vendor company and model IDs (4 bytes each). Least recently used nodes
+ * are removed from the index if there is not enough space.
+ */
+void mesh_composition_index_add(uint16_t addr, uint8_t *p_data, uint16_t len)
+{
+    mesh_composition_index_node_t *p_node;
+    uint16_t num_models = 0;
+    uint16_t first, i, j;
+    uint16_t company_id, model_id;
+    uint32_t model;
+    uint8_t  num_sig, num_vendor;
+    uint8_t  element, lru;
+    uint8_t  *p;
+
+    // Skip CID, PID, VID, CRPL and features, then count the models to make space for them
+    if (len < 10)
+        return;
+    p_data += 10;
+    len    -= 10;
+
+    for (p = p_data, i = len; i >= 4; )
+    {
+        num_sig    = p[2];
+        num_vendor = p[3];
+        if (i - 4 < num_sig * 2 + num_vendor * 4)
+            break;
+        num_models += num_sig + num_vendor;
+        p += 4 + num_sig * 2 + num_vendor * 4;
+        i -= 4 + num_sig * 2 + num_vendor * 4;
+    }
+    if (num_models > MESH_COMPOSITION_INDEX_MAX_MODELS)
+        return;
+
+    while ((mesh_composition_index_num_nodes == MESH_COMPOSITION_INDEX_MAX_NODES) ||
+           (mesh_composition_index_num_models + num_models > MESH_COMPOSITION_INDEX_MAX_MODELS))
+    {
+        for (lru = 0, i = 1; i < mesh_composition_index_num_nodes; i++)
+        {
+            if (mesh_composition_index_nodes[i].last_used < mesh_composition_index_nodes[lru].last_used)
+                lru = (uint8_t)i;
+        }
+        mesh_composition_index_remove(lru);
+    }
+
+    p_node = &mesh_composition_index_nodes[mesh_composition_index_num_nodes++];
+    p_node->addr       = addr;
+    p_node->first      = first = mesh_composition_index_num_models;
+    p_node->num_models = num_models;
+    p_node->last_used  = ++mesh_composition_index_use_count;
+
+    // Insert each model in the sorted position
+    for (element = 0; num_models != 0; element++)
+    {
+        p_data += 2;
+        STREAM_TO_UINT8(num_sig, p_data);
+        STREAM_TO_UINT8(num_vendor, p_data);
+
+        for (i = 0; i < num_sig + num_vendor; i++)
+        {
+            if (i < num_sig)
+            {
+                company_id = MESH_COMPANY_ID_BT_SIG;
+                STREAM_TO_UINT16(model_id, p_data);
+            }
+            else
+            {
+                STREAM_TO_UINT16(company_id, p_data);
+                STREAM_TO_UINT16(model_id, p_data);
+            }
+            model = ((uint32_t)company_id << 16) | model_id;
+
+            for (j = mesh_composition_index_num_models; (j > first) && (mesh_composition_index_models[j - 1] > model); j--)
+            {
+                mesh_composition_index_models[j]   = mesh_composition_index_models[j - 1];
+                mesh_composition_index_elements[j] = mesh_composition_index_elements[j - 1];
+            }
+            mesh_composition_index_models[j]   = model;
+            mesh_composition_index_elements[j] = element;
+            mesh_composition_index_num_models++;
+        }
+        num_models -= num_sig + num_vendor;
+    }
+}
+
+/*
+ * Binary search of the first entry of the model in the models of the node. Returns the index
+ * of the entry, or the index after the models of the node if the model is not found.
+ */
+uint16_t mesh_composition_index_search(mesh_composition_index_node_t *p_node, uint32_t model)
+{
+    uint16_t low  = p_node->first;
+    uint16_t high = p_node->first + p_node->num_models;
+    uint16_t mid;
+
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (mesh_composition_index_models[mid] < model)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return ((low < p_node->first + p_node->num_models) && (mesh_composition_index_models[low] == model)) ?
+           low : p_node->first + p_node->num_models;
+}
+
+/*
+ * Find the elements of the node which host the model. Returns the number of element addresses
+ * written to p_element_addrs.
+ */
+uint8_t mesh_app_composition_index_find(uint16_t node_addr, uint16_t company_id, uint16_t model_id, uint16_t *p_element_addrs, uint8_t max)
+{
+    mesh_composition_index_node_t *p_node;
+    uint32_t model = ((uint32_t)company_id << 16) | model_id;
+    uint16_t i;
+    uint8_t  num = 0;
+
+    if ((p_node = mesh_composition_index_node_find(node_addr)) == NULL)
+        return 0;
+
+    p_node->last_used = ++mesh_composition_index_use_count;
+    for (i = mesh_composition_index_search(p_node, model);
+         (i < p_node->first + p_node->num_models) && (mesh_composition_index_models[i] == model) && (num < max); i++)
+        p_element_addrs[num++] = node_addr + mesh_composition_index_elements[i];
+    return num;
+}
+
+/*
+ * Index composition data page 0 received from the node, and remove the node which has been
+ * reset. Other pages and empty page 0 do not change the index. Called for all config client
+ * events, including the events consumed by the application.
+ */
+void mesh_app_composition_index_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    wiced_bt_mesh_config_composition_data_status_data_t *p_comp = (wiced_bt_mesh_config_composition_data_status_data_t *)p_data;
+    mesh_composition_index_node_t *p_node;
+
+    if ((event != WICED_BT_MESH_CONFIG_NODE_RESET_STATUS) &&
+        ((event != WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS) || (p_comp->page_number != 0) || (p_comp->data_len == 0)))
+        return;
+
+    if ((p_node = mesh_composition_index_node_find(p_event->src)) != NULL)
+        mesh_composition_index_remove((uint8_t)(p_node - mesh_composition_index_nodes));
+
+    if (event == WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS)
+        mesh_composition_index_add(p_event->src, p_comp->data, p_comp->data_len);
+}
+
+/*
+ * Process command from MCU to find the elements which host the model. The command contains node
+ * address (2 bytes), company ID (2 bytes) and model ID (2 bytes). If the node address is 0, all
+ * indexed nodes are searched. The event contains company ID, model ID, number of elements and
+ * the node address and the element address of each element.
+ */
+uint8_t mesh_app_process_composition_model_find(uint8_t *p_data, uint32_t length)
+{
+    uint16_t element_addrs[MESH_COMPOSITION_INDEX_MAX_RESULTS];
+    uint16_t node_addr, company_id, model_id;
+    uint8_t *p_buffer;
+    uint8_t *p, *p_num;
+    uint8_t num = 0, found, i, j;
+
+    STREAM_TO_UINT16(node_addr, p_data);
+    STREAM_TO_UINT16(company_id, p_data);
+    STREAM_TO_UINT16(model_id, p_data);
+
+    if ((node_addr != 0) && (mesh_composition_index_node_find(node_addr) == NULL))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT16_TO_STREAM(p, company_id);
+    UINT16_TO_STREAM(p, model_id);
+    p_num = p++;
+
+    for (i = 0; (i < mesh_composition_index_num_nodes) && (num < MESH_COMPOSITION_INDEX_MAX_RESULTS); i++)
+    {
+        if ((node_addr != 0) && (mesh_composition_index_nodes[i].addr != node_addr))
+            continue;
+
+        found = mesh_app_composition_index_find(mesh_composition_index_nodes[i].addr, company_id, model_id,
+                                                element_addrs, MESH_COMPOSITION_INDEX_MAX_RESULTS - num);
+        for (j = 0; j < found; j++)
+        {
+            UINT16_TO_STREAM(p, mesh_composition_index_nodes[i].addr);
+            UINT16_TO_STREAM(p, element_addrs[j]);
+        }
+        num += found;
+    }
+    *p_num = num;
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_COMPOSITION_MODEL_ELEMENTS, p_buffer, (uint16_t)(p - p_buffer));
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
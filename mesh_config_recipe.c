@@ -0,0 +1,554 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file configures each newly provisioned node with the recipe set by the MCU. The recipe
+ * is the application key to add and, for each model, whether to bind the key, the subscription
+ * address and the publication. The models of the node are found in its composition data.
+ * Several nodes are configured at the same time and one event is sent to the MCU for each node.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_memory.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_CONFIG_RECIPE_MAX_RULES        8       // Max number of models in the recipe
+#define MESH_CONFIG_RECIPE_RULE_LEN         14      // Length of a rule in the recipe set command
+#define MESH_CONFIG_RECIPE_MAX_SESSIONS     4       // Max number of nodes configured at the same time
+#define MESH_CONFIG_RECIPE_MAX_PENDING      16      // Max number of nodes waiting for a session
+#define MESH_CONFIG_RECIPE_MAX_OPS          32      // Max number of messages sent to one node
+#define MESH_CONFIG_RECIPE_TIMEOUT          10      // Time to wait for the status of the node. Value is seconds.
+#define MESH_CONFIG_RECIPE_MAX_RETRIES      3       // Number of times a message is sent again after the timeout
+
+// Actions of the rule
+#define MESH_CONFIG_RECIPE_FLAG_BIND        0x01    // Bind the application key to the model
+#define MESH_CONFIG_RECIPE_FLAG_SUBSCRIBE   0x02    // Add the subscription address to the model
+#define MESH_CONFIG_RECIPE_FLAG_PUBLISH     0x04    // Set the publication of the model
+
+// Messages sent to the node
+#define MESH_CONFIG_RECIPE_OP_COMPOSITION   0
+#define MESH_CONFIG_RECIPE_OP_APPKEY_ADD    1
+#define MESH_CONFIG_RECIPE_OP_BIND          2
+#define MESH_CONFIG_RECIPE_OP_SUBSCRIBE     3
+#define MESH_CONFIG_RECIPE_OP_PUBLISH       4
+
+// Result of the configuration of the node
+#define MESH_CONFIG_RECIPE_RESULT_SUCCESS   0
+#define MESH_CONFIG_RECIPE_RESULT_PARTIAL   1       // Node rejected some of the messages
+#define MESH_CONFIG_RECIPE_RESULT_TIMEOUT   2       // Node did not reply
+#define MESH_CONFIG_RECIPE_RESULT_NO_MEM    3
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t    company_id;
+    uint16_t    model_id;
+    uint8_t     flags;
+    uint8_t     publish_ttl;
+    uint16_t    subscription_addr;
+    uint16_t    publish_addr;
+    uint32_t    publish_period;
+} mesh_config_recipe_rule_t;
+
+typedef struct
+{
+    uint8_t                     num_rules;  // 0 if the recipe is not set
+    uint16_t                    net_key_idx;
+    uint16_t                    app_key_idx;
+    uint8_t                     app_key[WICED_BT_MESH_KEY_LEN];
+    mesh_config_recipe_rule_t   rules[MESH_CONFIG_RECIPE_MAX_RULES];
+} mesh_config_recipe_t;
+
+typedef struct
+{
+    uint8_t     type;
+    uint8_t     rule;                       // Index of the rule for the model messages
+    uint16_t    element_addr;
+} mesh_config_recipe_op_t;
+
+typedef struct
+{
+    uint16_t                    addr;       // 0 if the session is not used
+    uint8_t                     num_ops;
+    uint8_t                     op;         // Index of the message waiting for the status
+    uint8_t                     retries;    // Retries of the current message
+    uint8_t                     total_retries;
+    uint8_t                     num_failed;
+    mesh_config_recipe_op_t     ops[MESH_CONFIG_RECIPE_MAX_OPS];
+    wiced_timer_t               timer;
+} mesh_config_recipe_session_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_config_recipe_start(uint16_t addr);
+static void mesh_config_recipe_send(mesh_config_recipe_session_t *p_session);
+static void mesh_config_recipe_next(mesh_config_recipe_session_t *p_session, wiced_bool_t success);
+static void mesh_config_recipe_done(mesh_config_recipe_session_t *p_session, uint8_t result);
+static void mesh_config_recipe_parse(mesh_config_recipe_session_t *p_session, uint8_t *p_data, uint16_t len);
+static void mesh_config_recipe_model_add(mesh_config_recipe_session_t *p_session, uint16_t element_addr, uint16_t company_id, uint16_t model_id);
+static void mesh_config_recipe_timer_callback(TIMER_PARAM_TYPE arg);
+static mesh_config_recipe_session_t *mesh_config_recipe_session_find(uint16_t addr);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_config_recipe_t         mesh_config_recipe;
+static mesh_config_recipe_session_t mesh_config_recipe_sessions[MESH_CONFIG_RECIPE_MAX_SESSIONS];
+static wiced_bool_t                 mesh_config_recipe_timers_ready = WICED_FALSE;
+
+// Nodes provisioned while all sessions are used
+static uint16_t                     mesh_config_recipe_pending[MESH_CONFIG_RECIPE_MAX_PENDING];
+static uint8_t                      mesh_config_recipe_num_pending = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Find the session configuring the node
+ */
+mesh_config_recipe_session_t *mesh_config_recipe_session_find(uint16_t addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < MESH_CONFIG_RECIPE_MAX_SESSIONS; i++)
+    {
+        if ((addr != 0) && (mesh_config_recipe_sessions[i].addr == addr))
+            return &mesh_config_recipe_sessions[i];
+    }
+    return NULL;
+}
+
+/*
+ * Start configuration of the node in a free session, or queue the node if all sessions are used.
+ * The composition data of the node is read first to find its models.
+ */
+void mesh_config_recipe_start(uint16_t addr)
+{
+    mesh_config_recipe_session_t *p_session;
+
+    for (p_session = &mesh_config_recipe_sessions[0]; p_session < &mesh_config_recipe_sessions[MESH_CONFIG_RECIPE_MAX_SESSIONS]; p_session++)
+    {
+        if (p_session->addr == 0)
+            break;
+    }
+    if (p_session == &mesh_config_recipe_sessions[MESH_CONFIG_RECIPE_MAX_SESSIONS])
+    {
+        if (mesh_config_recipe_num_pending < MESH_CONFIG_RECIPE_MAX_PENDING)
+            mesh_config_recipe_pending[mesh_config_recipe_num_pending++] = addr;
+        else
+            WICED_BT_TRACE("recipe queue full addr:%x\n", addr);
+        return;
+    }
+    memset(p_session->ops, 0, sizeof(p_session->ops));
+    p_session->addr          = addr;
+    p_session->ops[0].type   = MESH_CONFIG_RECIPE_OP_COMPOSITION;
+    p_session->num_ops       = 1;
+    p_session->op            = 0;
+    p_session->retries       = 0;
+    p_session->total_retries = 0;
+    p_session->num_failed    = 0;
+    mesh_config_recipe_send(p_session);
+}
+
+/*
+ * Send the current message of the session to the node and wait for the status
+ */
+void mesh_config_recipe_send(mesh_config_recipe_session_t *p_session)
+{
+    mesh_config_recipe_op_t *p_op = &p_session->ops[p_session->op];
+    mesh_config_recipe_rule_t *p_rule = &mesh_config_recipe.rules[p_op->rule];
+    wiced_bt_mesh_config_composition_data_get_data_t composition;
+    wiced_bt_mesh_config_appkey_change_data_t appkey;
+    wiced_bt_mesh_config_model_app_bind_data_t bind;
+    wiced_bt_mesh_config_model_subscription_change_data_t subscription;
+    wiced_bt_mesh_config_model_publication_set_data_t publication;
+    wiced_bt_mesh_event_t *p_event;
+    wiced_bool_t sent = WICED_FALSE;
+    uint8_t *p;
+
+    if ((p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_session->addr, 0)) == NULL)
+    {
+        mesh_config_recipe_done(p_session, MESH_CONFIG_RECIPE_RESULT_NO_MEM);
+        return;
+    }
+    switch (p_op->type)
+    {
+    case MESH_CONFIG_RECIPE_OP_COMPOSITION:
+        composition.page_number = 0;
+        sent = wiced_bt_mesh_config_composition_data_get(p_event, &composition);
+        break;
+
+    case MESH_CONFIG_RECIPE_OP_APPKEY_ADD:
+        appkey.operation   = OPERATION_ADD;
+        appkey.net_key_idx = mesh_config_recipe.net_key_idx;
+        appkey.app_key_idx = mesh_config_recipe.app_key_idx;
+        memcpy(appkey.app_key, mesh_config_recipe.app_key, WICED_BT_MESH_KEY_LEN);
+        sent = wiced_bt_mesh_config_appkey_change(p_event, &appkey);
+        break;
+
+    case MESH_CONFIG_RECIPE_OP_BIND:
+        bind.operation    = OPERATION_ADD;
+        bind.element_addr = p_op->element_addr;
+        bind.company_id   = p_rule->company_id;
+        bind.model_id     = p_rule->model_id;
+        bind.app_key_idx  = mesh_config_recipe.app_key_idx;
+        sent = wiced_bt_mesh_config_model_app_bind(p_event, &bind);
+        break;
+
+    case MESH_CONFIG_RECIPE_OP_SUBSCRIBE:
+        memset(&subscription, 0, sizeof(subscription));
+        subscription.operation    = OPERATION_ADD;
+        subscription.element_addr = p_op->element_addr;
+        subscription.company_id   = p_rule->company_id;
+        subscription.model_id     = p_rule->model_id;
+        p = subscription.addr;
+        UINT16_TO_STREAM(p, p_rule->subscription_addr);
+        sent = wiced_bt_mesh_config_model_subscription_change(p_event, &subscription);
+        break;
+
+    case MESH_CONFIG_RECIPE_OP_PUBLISH:
+        memset(&publication, 0, sizeof(publication));
+        publication.element_addr   = p_op->element_addr;
+        publication.company_id     = p_rule->company_id;
+        publication.model_id       = p_rule->model_id;
+        publication.app_key_idx    = mesh_config_recipe.app_key_idx;
+        publication.publish_ttl    = p_rule->publish_ttl;
+        publication.publish_period = p_rule->publish_period;
+        p = publication.publish_addr;
+        UINT16_TO_STREAM(p, p_rule->publish_addr);
+        sent = wiced_bt_mesh_config_model_publication_set(p_event, &publication);
+        break;
+    }
+    if (!sent)
+    {
+        mesh_config_recipe_next(p_session, WICED_FALSE);
+        return;
+    }
+    wiced_start_timer(&p_session->timer, MESH_CONFIG_RECIPE_TIMEOUT * 1000);
+}
+
+/*
+ * Go to the next message of the session, or finish the node after the last one
+ */
+void mesh_config_recipe_next(mesh_config_recipe_session_t *p_session, wiced_bool_t success)
+{
+    if (wiced_is_timer_in_use(&p_session->timer))
+        wiced_stop_timer(&p_session->timer);
+
+    if (!success)
+        p_session->num_failed++;
+
+    p_session->retries = 0;
+    if (++p_session->op < p_session->num_ops)
+        mesh_config_recipe_send(p_session);
+    else
+        mesh_config_recipe_done(p_session, (p_session->num_failed == 0) ? MESH_CONFIG_RECIPE_RESULT_SUCCESS : MESH_CONFIG_RECIPE_RESULT_PARTIAL);
+}
+
+/*
+ * Send the result of the configuration of the node to the MCU and start the next queued node
+ */
+void mesh_config_recipe_done(mesh_config_recipe_session_t *p_session, uint8_t result)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    WICED_BT_TRACE("recipe done addr:%x result:%d ops:%d failed:%d\n", p_session->addr, result, p_session->num_ops, p_session->num_failed);
+
+    if (wiced_is_timer_in_use(&p_session->timer))
+        wiced_stop_timer(&p_session->timer);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) != NULL)
+    {
+        p = p_buffer;
+        UINT16_TO_STREAM(p, p_session->addr);
+        UINT8_TO_STREAM(p, result);
+        UINT8_TO_STREAM(p, p_session->num_ops);
+        UINT8_TO_STREAM(p, p_session->num_failed);
+        UINT8_TO_STREAM(p, p_session->total_retries);
+        mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE, p_buffer, (uint16_t)(p - p_buffer));
+    }
+    p_session->addr = 0;
+
+    if (mesh_config_recipe_num_pending != 0)
+    {
+        uint16_t addr = mesh_config_recipe_pending[0];
+
+        mesh_config_recipe_num_pending--;
+        memmove(&mesh_config_recipe_pending[0], &mesh_config_recipe_pending[1], mesh_config_recipe_num_pending * sizeof(uint16_t));
+        mesh_config_recipe_start(addr);
+    }
+}
+
+/*
+ * Add messages for the model if it is in the recipe
+ */
+void mesh_config_recipe_model_add(mesh_config_recipe_session_t *p_session, uint16_t element_addr, uint16_t company_id, uint16_t model_id)
+{
+    mesh_config_recipe_rule_t *p_rule;
+    uint8_t i, type;
+
+    for (i = 0; i < mesh_config_recipe.num_rules; i++)
+    {
+        p_rule = &mesh_config_recipe.rules[i];
+        if ((p_rule->company_id != company_id) || (p_rule->model_id != model_id))
+            continue;
+
+        for (type = MESH_CONFIG_RECIPE_OP_BIND; type <= MESH_CONFIG_RECIPE_OP_PUBLISH; type++)
+        {
+            if (!(p_rule->flags & (1 << (type - MESH_CONFIG_RECIPE_OP_BIND))))
+                continue;
+
+            if (p_session->num_ops == MESH_CONFIG_RECIPE_MAX_OPS)
+            {
+                WICED_BT_TRACE("recipe too many ops addr:%x\n", p_session->addr);
+                return;
+            }
+            p_session->ops[p_session->num_ops].type         = type;
+            p_session->ops[p_session->num_ops].rule         = i;
+            p_session->ops[p_session->num_ops].element_addr = element_addr;
+            p_session->num_ops++;
+        }
+    }
+}
+
+/*
+ * Create the list of messages from the composition data page 0 of the node. Each element has
+ * location (2 bytes), number of SIG models (1 byte), number of vendor models (1 byte), SIG model
+ * IDs (2 bytes each) and vendor company and model IDs (4 bytes each).
+ */
+void mesh_config_recipe_parse(mesh_config_recipe_session_t *p_session, uint8_t *p_data, uint16_t len)
+{
+    uint16_t element_addr = p_session->addr;
+    uint16_t company_id, model_id;
+    uint8_t  num_sig, num_vendor;
+
+    p_session->ops[p_session->num_ops++].type = MESH_CONFIG_RECIPE_OP_APPKEY_ADD;
+
+    // Skip CID, PID, VID, CRPL and features
+    if (len < 10)
+        return;
+    p_data += 10;
+    len    -= 10;
+
+    while (len >= 4)
+    {
+        p_data += 2;
+        STREAM_TO_UINT8(num_sig, p_data);
+        STREAM_TO_UINT8(num_vendor, p_data);
+        len -= 4;
+        if (len < num_sig * 2 + num_vendor * 4)
+            break;
+        len -= num_sig * 2 + num_vendor * 4;
+
+        while (num_sig-- != 0)
+        {
+            STREAM_TO_UINT16(model_id, p_data);
+            mesh_config_recipe_model_add(p_session, element_addr, MESH_COMPANY_ID_BT_SIG, model_id);
+        }
+        while (num_vendor-- != 0)
+        {
+            STREAM_TO_UINT16(company_id, p_data);
+            STREAM_TO_UINT16(model_id, p_data);
+            mesh_config_recipe_model_add(p_session, element_addr, company_id, model_id);
+        }
+        element_addr++;
+    }
+}
+
+/*
+ * Node did not reply, send the message again or give up the node
+ */
+void mesh_config_recipe_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_config_recipe_session_t *p_session = &mesh_config_recipe_sessions[(uint32_t)arg];
+
+    if (p_session->addr == 0)
+        return;
+
+    if (p_session->retries++ < MESH_CONFIG_RECIPE_MAX_RETRIES)
+    {
+        p_session->total_retries++;
+        mesh_config_recipe_send(p_session);
+    }
+    else
+    {
+        mesh_config_recipe_done(p_session, MESH_CONFIG_RECIPE_RESULT_TIMEOUT);
+    }
+}
+
+/*
+ * Process events of the config client. Configuration of a node is started when it is provisioned.
+ * Returns WICED_TRUE if the event is the status of a message sent by the recipe and should not
+ * be sent to the MCU.
+ */
+wiced_bool_t mesh_app_config_recipe_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    mesh_config_recipe_session_t *p_session;
+    wiced_bt_mesh_config_composition_data_status_data_t *p_composition;
+    wiced_bt_mesh_provision_status_data_t *p_provision;
+    wiced_bt_mesh_set_dev_key_data_t dev_key;
+    uint8_t expected;
+    uint8_t status;
+
+    if (mesh_config_recipe.num_rules == 0)
+        return WICED_FALSE;
+
+    if (event == WICED_BT_MESH_PROVISION_END)
+    {
+        p_provision = (wiced_bt_mesh_provision_status_data_t *)p_data;
+        if (p_provision->result == WICED_BT_MESH_PROVISION_RESULT_SUCCESS)
+        {
+            // Messages to the node are secured with its device key
+            dev_key.dst         = p_provision->addr;
+            dev_key.net_key_idx = p_provision->net_key_idx;
+            memcpy(dev_key.dev_key, p_provision->dev_key, WICED_BT_MESH_KEY_LEN);
+            wiced_bt_mesh_provision_set_dev_key(&dev_key);
+
+            mesh_config_recipe_start(p_provision->addr);
+        }
+        return WICED_FALSE;
+    }
+    if ((p_session = mesh_config_recipe_session_find(p_event->src)) == NULL)
+        return WICED_FALSE;
+
+    switch (event)
+    {
+    case WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS:
+        expected = MESH_CONFIG_RECIPE_OP_COMPOSITION;
+        status   = 0;
+        break;
+    case WICED_BT_MESH_CONFIG_APPKEY_STATUS:
+        expected = MESH_CONFIG_RECIPE_OP_APPKEY_ADD;
+        status   = ((wiced_bt_mesh_config_appkey_status_data_t *)p_data)->status;
+        break;
+    case WICED_BT_MESH_CONFIG_MODEL_APP_BIND_STATUS:
+        expected = MESH_CONFIG_RECIPE_OP_BIND;
+        status   = ((wiced_bt_mesh_config_model_app_bind_status_data_t *)p_data)->status;
+        break;
+    case WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS:
+        expected = MESH_CONFIG_RECIPE_OP_SUBSCRIBE;
+        status   = ((wiced_bt_mesh_config_model_subscription_status_data_t *)p_data)->status;
+        break;
+    case WICED_BT_MESH_CONFIG_MODEL_PUBLICATION_STATUS:
+        expected = MESH_CONFIG_RECIPE_OP_PUBLISH;
+        status   = ((wiced_bt_mesh_config_model_publication_status_data_t *)p_data)->status;
+        break;
+    default:
+        return WICED_FALSE;
+    }
+    if (p_session->ops[p_session->op].type != expected)
+        return WICED_FALSE;
+
+    if (event == WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS)
+    {
+        p_composition = (wiced_bt_mesh_config_composition_data_status_data_t *)p_data;
+        mesh_config_recipe_parse(p_session, p_composition->data, p_composition->data_len);
+        wiced_bt_free_buffer(p_composition);
+    }
+    mesh_config_recipe_next(p_session, status == 0);
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to set the recipe applied to each provisioned node. The command
+ * contains net key index (2 bytes), app key index (2 bytes), app key (16 bytes) and the rules.
+ * Each rule has company ID (2 bytes), model ID (2 bytes), flags (1 byte), subscription address
+ * (2 bytes), publication address (2 bytes), publication TTL (1 byte) and publication period
+ * (4 bytes). A command without rules clears the recipe.
+ */
+uint8_t mesh_app_process_config_recipe_set(uint8_t *p_data, uint32_t length)
+{
+    mesh_config_recipe_rule_t *p_rule;
+    uint8_t i;
+
+    // Nodes being configured with the previous recipe are dropped
+    for (i = 0; i < MESH_CONFIG_RECIPE_MAX_SESSIONS; i++)
+    {
+        if (mesh_config_recipe_timers_ready && wiced_is_timer_in_use(&mesh_config_recipe_sessions[i].timer))
+            wiced_stop_timer(&mesh_config_recipe_sessions[i].timer);
+        mesh_config_recipe_sessions[i].addr = 0;
+    }
+    mesh_config_recipe_num_pending = 0;
+
+    memset(&mesh_config_recipe, 0, sizeof(mesh_config_recipe));
+    if (length == 0)
+        return HCI_CONTROL_MESH_STATUS_SUCCESS;
+
+    if ((length < 20) || ((length - 20) % MESH_CONFIG_RECIPE_RULE_LEN != 0) || ((length - 20) / MESH_CONFIG_RECIPE_RULE_LEN > MESH_CONFIG_RECIPE_MAX_RULES))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    STREAM_TO_UINT16(mesh_config_recipe.net_key_idx, p_data);
+    STREAM_TO_UINT16(mesh_config_recipe.app_key_idx, p_data);
+    STREAM_TO_ARRAY(mesh_config_recipe.app_key, p_data, WICED_BT_MESH_KEY_LEN);
+
+    for (i = 0; i < (length - 20) / MESH_CONFIG_RECIPE_RULE_LEN; i++)
+    {
+        p_rule = &mesh_config_recipe.rules[i];
+        STREAM_TO_UINT16(p_rule->company_id, p_data);
+        STREAM_TO_UINT16(p_rule->model_id, p_data);
+        STREAM_TO_UINT8(p_rule->flags, p_data);
+        STREAM_TO_UINT16(p_rule->subscription_addr, p_data);
+        STREAM_TO_UINT16(p_rule->publish_addr, p_data);
+        STREAM_TO_UINT8(p_rule->publish_ttl, p_data);
+        STREAM_TO_UINT32(p_rule->publish_period, p_data);
+    }
+    mesh_config_recipe.num_rules = i;
+
+    if (!mesh_config_recipe_timers_ready)
+    {
+        for (i = 0; i < MESH_CONFIG_RECIPE_MAX_SESSIONS; i++)
+            wiced_init_timer(&mesh_config_recipe_sessions[i].timer, mesh_config_recipe_timer_callback, (TIMER_PARAM_TYPE)(uint32_t)i, WICED_MILLI_SECONDS_TIMER);
+        mesh_config_recipe_timers_ready = WICED_TRUE;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
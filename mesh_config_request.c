@@ -0,0 +1,485 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file queues config client commands received from the MCU and sends them to the nodes
+ * without the MCU waiting for each status. The number of commands waiting for the status is
+ * limited per node and overall. A status received from the node completes the oldest command
+ * sent to that node which expects that status. Commands without the status are sent again with
+ * the timeout doubled each time, and the MCU is told the result of each command.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_CONFIG_REQUEST_MAX_CMD_LEN     40      // Max length of the command payload
+#define MESH_CONFIG_REQUEST_ITEM_HDR_LEN    6       // Request ID, length of opcode and payload, opcode
+#define MESH_CONFIG_REQUEST_MAX_BACKOFF     4       // Timeout is doubled for the first retries only
+
+// Default configuration, can be changed by the MCU
+#define MESH_CONFIG_REQUEST_WINDOW          8       // Max number of commands waiting for the status
+#define MESH_CONFIG_REQUEST_WINDOW_PER_DST  1       // Max number of commands to one node waiting for the status
+#define MESH_CONFIG_REQUEST_TIMEOUT         4000    // Time to wait for the first status. Value is milliseconds.
+#define MESH_CONFIG_REQUEST_MAX_RETRIES     3       // Number of times a command is sent again after the timeout
+
+// State of the request
+#define MESH_CONFIG_REQUEST_STATE_IDLE      0
+#define MESH_CONFIG_REQUEST_STATE_QUEUED    1
+#define MESH_CONFIG_REQUEST_STATE_SENT      2
+
+// Result of the request
+#define MESH_CONFIG_REQUEST_RESULT_SUCCESS  0
+#define MESH_CONFIG_REQUEST_RESULT_ERROR    1       // Command could not be sent
+#define MESH_CONFIG_REQUEST_RESULT_TIMEOUT  2       // Node did not reply
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+// Config client event with the status of the command
+typedef struct
+{
+    uint16_t    opcode;
+    uint16_t    status_event;
+} mesh_config_request_status_t;
+
+typedef struct
+{
+    uint8_t     state;
+    uint8_t     len;
+    uint8_t     retries;
+    uint16_t    id;                         // Request ID set by the MCU
+    uint16_t    opcode;
+    uint16_t    status_event;
+    uint16_t    dst;
+    uint32_t    seq;                        // Order in which commands have been queued
+    uint32_t    deadline;                   // Time when the command is sent again
+    uint8_t     data[MESH_CONFIG_REQUEST_MAX_CMD_LEN];
+} mesh_config_request_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_config_request_send(mesh_config_request_t *p_req);
+static void mesh_config_request_done(mesh_config_request_t *p_req, uint8_t result);
+static void mesh_config_request_pump(void);
+static void mesh_config_request_timer_update(void);
+static void mesh_config_request_timer_callback(TIMER_PARAM_TYPE arg);
+static uint8_t mesh_config_request_num_sent(uint16_t dst);
+static wiced_bool_t mesh_config_request_status_find(uint16_t opcode, uint16_t *p_status_event);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static const mesh_config_request_status_t mesh_config_request_statuses[] =
+{
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_RESET,                   WICED_BT_MESH_CONFIG_NODE_RESET_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_GET,                   WICED_BT_MESH_CONFIG_BEACON_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_SET,                   WICED_BT_MESH_CONFIG_BEACON_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_COMPOSITION_DATA_GET,         WICED_BT_MESH_CONFIG_COMPOSITION_DATA_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET,              WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET,              WICED_BT_MESH_CONFIG_DEFAULT_TTL_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_GET,               WICED_BT_MESH_CONFIG_GATT_PROXY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_SET,               WICED_BT_MESH_CONFIG_GATT_PROXY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_GET,                    WICED_BT_MESH_CONFIG_RELAY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_SET,                    WICED_BT_MESH_CONFIG_RELAY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_GET,                   WICED_BT_MESH_CONFIG_FRIEND_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_SET,                   WICED_BT_MESH_CONFIG_FRIEND_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_GET,        WICED_BT_MESH_CONFIG_KEY_REFRESH_PHASE_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_SET,        WICED_BT_MESH_CONFIG_KEY_REFRESH_PHASE_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_GET,            WICED_BT_MESH_CONFIG_NODE_IDENTITY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_SET,            WICED_BT_MESH_CONFIG_NODE_IDENTITY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_GET,        WICED_BT_MESH_CONFIG_MODEL_PUBLICATION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET,        WICED_BT_MESH_CONFIG_MODEL_PUBLICATION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_ADD,       WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE,    WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_OVERWRITE, WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE_ALL, WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_GET,       WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_LIST },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_ADD,                  WICED_BT_MESH_CONFIG_NETKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_DELETE,               WICED_BT_MESH_CONFIG_NETKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_UPDATE,               WICED_BT_MESH_CONFIG_NETKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_GET,                  WICED_BT_MESH_CONFIG_NETKEY_LIST },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_ADD,                  WICED_BT_MESH_CONFIG_APPKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_DELETE,               WICED_BT_MESH_CONFIG_APPKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_UPDATE,               WICED_BT_MESH_CONFIG_APPKEY_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_GET,                  WICED_BT_MESH_CONFIG_APPKEY_LIST },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND,               WICED_BT_MESH_CONFIG_MODEL_APP_BIND_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_UNBIND,             WICED_BT_MESH_CONFIG_MODEL_APP_BIND_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_GET,                WICED_BT_MESH_CONFIG_MODEL_APP_BIND_LIST },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_GET,    WICED_BT_MESH_CONFIG_HEARBEAT_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_SET,    WICED_BT_MESH_CONFIG_HEARBEAT_SUBSCRIPTION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_GET,     WICED_BT_MESH_CONFIG_HEARBEAT_PUBLICATION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_SET,     WICED_BT_MESH_CONFIG_HEARBEAT_PUBLICATION_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_GET,         WICED_BT_MESH_CONFIG_NETWORK_TRANSMIT_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_SET,         WICED_BT_MESH_CONFIG_NETWORK_TRANSMIT_STATUS },
+    { HCI_CONTROL_MESH_COMMAND_CONFIG_LPN_POLL_TIMEOUT_GET,         WICED_BT_MESH_CONFIG_LPN_POLL_TIMEOUT_STATUS },
+};
+#define MESH_CONFIG_REQUEST_NUM_STATUSES    (sizeof(mesh_config_request_statuses) / sizeof(mesh_config_request_statuses[0]))
+
+static mesh_config_request_t    mesh_config_requests[MESH_APP_CONFIG_REQUEST_MAX_REQUESTS];
+static uint32_t                 mesh_config_request_seq = 0;
+static wiced_timer_t            mesh_config_request_timer;
+static wiced_bool_t             mesh_config_request_timer_ready = WICED_FALSE;
+
+static uint8_t                  mesh_config_request_window = MESH_CONFIG_REQUEST_WINDOW;
+static uint8_t                  mesh_config_request_window_per_dst = MESH_CONFIG_REQUEST_WINDOW_PER_DST;
+static uint16_t                 mesh_config_request_timeout = MESH_CONFIG_REQUEST_TIMEOUT;
+static uint8_t                  mesh_config_request_max_retries = MESH_CONFIG_REQUEST_MAX_RETRIES;
+
+// Counters of the commands
+static uint8_t                  mesh_config_request_num_queued = 0;
+static uint8_t                  mesh_config_request_num_in_flight = 0;
+static uint32_t                 mesh_config_request_completed = 0;
+static uint32_t                 mesh_config_request_retried = 0;
+static uint32_t                 mesh_config_request_failed = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Find the config client event with the status of the command
+ */
+wiced_bool_t mesh_config_request_status_find(uint16_t opcode, uint16_t *p_status_event)
+{
+    uint8_t i;
+
+    for (i = 0; i < MESH_CONFIG_REQUEST_NUM_STATUSES; i++)
+    {
+        if (mesh_config_request_statuses[i].opcode == opcode)
+        {
+            *p_status_event = mesh_config_request_statuses[i].status_event;
+            return WICED_TRUE;
+        }
+    }
+    return WICED_FALSE;
+}
+
+/*
+ * Number of commands to the node waiting for the status
+ */
+uint8_t mesh_config_request_num_sent(uint16_t dst)
+{
+    uint8_t num = 0;
+    uint8_t i;
+
+    for (i = 0; i < MESH_APP_CONFIG_REQUEST_MAX_REQUESTS; i++)
+    {
+        if ((mesh_config_requests[i].state == MESH_CONFIG_REQUEST_STATE_SENT) && (mesh_config_requests[i].dst == dst))
+            num++;
+    }
+    return num;
+}
+
+/*
+ * Send the command to the node. The timeout is doubled for each of the first retries.
+ */
+void mesh_config_request_send(mesh_config_request_t *p_req)
+{
+    if (p_req->state == MESH_CONFIG_REQUEST_STATE_QUEUED)
+    {
+        mesh_config_request_num_queued--;
+        mesh_config_request_num_in_flight++;
+    }
+    p_req->state    = MESH_CONFIG_REQUEST_STATE_SENT;
+    p_req->deadline = (uint32_t)wiced_bt_mesh_core_get_tick_count() + ((uint32_t)mesh_config_request_timeout <<
+                      ((p_req->retries < MESH_CONFIG_REQUEST_MAX_BACKOFF) ? p_req->retries : MESH_CONFIG_REQUEST_MAX_BACKOFF));
+
+    if (mesh_app_config_cmd_execute(p_req->opcode, p_req->data, p_req->len) != HCI_CONTROL_MESH_STATUS_SUCCESS)
+        mesh_config_request_done(p_req, MESH_CONFIG_REQUEST_RESULT_ERROR);
+}
+
+/*
+ * Send the result of the command to the MCU and free the request
+ */
+void mesh_config_request_done(mesh_config_request_t *p_req, uint8_t result)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    WICED_BT_TRACE("config req:%d dst:%x result:%d retries:%d\n", p_req->id, p_req->dst, result, p_req->retries);
+
+    if (p_req->state == MESH_CONFIG_REQUEST_STATE_SENT)
+        mesh_config_request_num_in_flight--;
+    else if (p_req->state == MESH_CONFIG_REQUEST_STATE_QUEUED)
+        mesh_config_request_num_queued--;
+    p_req->state = MESH_CONFIG_REQUEST_STATE_IDLE;
+
+    if (result == MESH_CONFIG_REQUEST_RESULT_SUCCESS)
+        mesh_config_request_completed++;
+    else
+        mesh_config_request_failed++;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return;
+
+    p = p_buffer;
+    UINT16_TO_STREAM(p, p_req->id);
+    UINT16_TO_STREAM(p, p_req->dst);
+    UINT8_TO_STREAM(p, result);
+    UINT8_TO_STREAM(p, p_req->retries);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Send queued commands in the order they have been queued while the windows are not full.
+ * Commands to the node with the full window wait and do not block commands to other nodes.
+ */
+void mesh_config_request_pump(void)
+{
+    mesh_config_request_t *p_next;
+    uint8_t i;
+
+    while (mesh_config_request_num_in_flight < mesh_config_request_window)
+    {
+        p_next = NULL;
+        for (i = 0; i < MESH_APP_CONFIG_REQUEST_MAX_REQUESTS; i++)
+        {
+            if ((mesh_config_requests[i].state == MESH_CONFIG_REQUEST_STATE_QUEUED) &&
+                ((p_next == NULL) || (mesh_config_requests[i].seq < p_next->seq)) &&
+                (mesh_config_request_num_sent(mesh_config_requests[i].dst) < mesh_config_request_window_per_dst))
+                p_next = &mesh_config_requests[i];
+        }
+        if (p_next == NULL)
+            break;
+        mesh_config_request_send(p_next);
+    }
+    mesh_config_request_timer_update();
+}
+
+/*
+ * Start the timer for the command which times out first
+ */
+void mesh_config_request_timer_update(void)
+{
+    uint32_t now = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    int32_t  delay, min_delay = 0x7FFFFFFF;
+    uint8_t  i;
+
+    if (!mesh_config_request_timer_ready)
+    {
+        wiced_init_timer(&mesh_config_request_timer, mesh_config_request_timer_callback, 0, WICED_MILLI_SECONDS_TIMER);
+        mesh_config_request_timer_ready = WICED_TRUE;
+    }
+    if (wiced_is_timer_in_use(&mesh_config_request_timer))
+        wiced_stop_timer(&mesh_config_request_timer);
+
+    for (i = 0; i < MESH_APP_CONFIG_REQUEST_MAX_REQUESTS; i++)
+    {
+        if (mesh_config_requests[i].state != MESH_CONFIG_REQUEST_STATE_SENT)
+            continue;
+        delay = (int32_t)(mesh_config_requests[i].deadline - now);
+        if (delay < min_delay)
+            min_delay = delay;
+    }
+    if (min_delay != 0x7FFFFFFF)
+        wiced_start_timer(&mesh_config_request_timer, (min_delay > 0) ? (uint32_t)min_delay : 1);
+}
+
+/*
+ * Send again the commands which timed out, or give them up after the max number of retries
+ */
+void mesh_config_request_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    uint32_t now = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    mesh_config_request_t *p_req;
+    uint8_t i;
+
+    for (i = 0; i < MESH_APP_CONFIG_REQUEST_MAX_REQUESTS; i++)
+    {
+        p_req = &mesh_config_requests[i];
+        if ((p_req->state != MESH_CONFIG_REQUEST_STATE_SENT) || ((int32_t)(p_req->deadline - now) > 0))
+            continue;
+
+        if (p_req->retries < mesh_config_request_max_retries)
+        {
+            p_req->retries++;
+            mesh_config_request_retried++;
+            mesh_config_request_send(p_req);
+        }
+        else
+        {
+            mesh_config_request_done(p_req, MESH_CONFIG_REQUEST_RESULT_TIMEOUT);
+        }
+    }
+    mesh_config_request_pump();
+}
+
+/*
+ * Complete the oldest command sent to the node which replied with the status of the command.
+ * Called for the config client events sent to the MCU.
+ */
+void mesh_app_config_request_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    mesh_config_request_t *p_req = NULL;
+    uint8_t i;
+
+    if (mesh_config_request_num_in_flight == 0)
+        return;
+
+    for (i = 0; i < MESH_APP_CONFIG_REQUEST_MAX_REQUESTS; i++)
+    {
+        if ((mesh_config_requests[i].state == MESH_CONFIG_REQUEST_STATE_SENT) && (mesh_config_requests[i].dst == p_event->src) &&
+            (mesh_config_requests[i].status_event == event) && ((p_req == NULL) || (mesh_config_requests[i].seq < p_req->seq)))
+            p_req = &mesh_config_requests[i];
+    }
+    if (p_req == NULL)
+        return;
+
+    mesh_config_request_done(p_req, MESH_CONFIG_REQUEST_RESULT_SUCCESS);
+    mesh_config_request_pump();
+}
+
+/*
+ * Process command from MCU to queue config client commands. Each command is preceded by the
+ * request ID (2 bytes), its length (opcode and payload, 2 bytes) and opcode (2 bytes). The
+ * payload is the same as when the command is sent alone. Only config client commands with
+ * a status can be queued. Either all commands are queued or, if any command is not valid or
+ * there is no space, none.
+ */
+uint8_t mesh_app_process_config_request_queue(uint8_t *p_data, uint32_t length)
+{
+    mesh_config_request_t *p_req;
+    uint8_t  *p = p_data;
+    uint32_t len = length;
+    uint16_t cmd_len, cmd_opcode, status_event;
+    uint8_t  num_cmds = 0;
+    uint8_t  i = 0;
+
+    // Check all commands first
+    while (len != 0)
+    {
+        if (len < MESH_CONFIG_REQUEST_ITEM_HDR_LEN)
+            return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+        cmd_len    = p[2] + (p[3] << 8);
+        cmd_opcode = p[4] + (p[5] << 8);
+        if ((cmd_len < 4) || (cmd_len - 2 > MESH_CONFIG_REQUEST_MAX_CMD_LEN) || (cmd_len - 2 > len - MESH_CONFIG_REQUEST_ITEM_HDR_LEN))
+            return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+        if (!mesh_app_config_cmd_check(cmd_opcode) || !mesh_config_request_status_find(cmd_opcode, &status_event))
+            return HCI_CONTROL_MESH_STATUS_ERROR;
+        p   += MESH_CONFIG_REQUEST_ITEM_HDR_LEN + cmd_len - 2;
+        len -= MESH_CONFIG_REQUEST_ITEM_HDR_LEN + cmd_len - 2;
+        num_cmds++;
+    }
+    if (mesh_config_request_num_queued + mesh_config_request_num_in_flight + num_cmds > MESH_APP_CONFIG_REQUEST_MAX_REQUESTS)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    while (num_cmds-- != 0)
+    {
+        while (mesh_config_requests[i].state != MESH_CONFIG_REQUEST_STATE_IDLE)
+            i++;
+        p_req = &mesh_config_requests[i];
+
+        STREAM_TO_UINT16(p_req->id, p_data);
+        STREAM_TO_UINT16(cmd_len, p_data);
+        STREAM_TO_UINT16(p_req->opcode, p_data);
+        mesh_config_request_status_find(p_req->opcode, &p_req->status_event);
+        p_req->len     = (uint8_t)(cmd_len - 2);
+        STREAM_TO_ARRAY(p_req->data, p_data, p_req->len);
+        p_req->dst     = p_req->data[0] + (p_req->data[1] << 8);
+        p_req->retries = 0;
+        p_req->seq     = mesh_config_request_seq++;
+        p_req->state   = MESH_CONFIG_REQUEST_STATE_QUEUED;
+        mesh_config_request_num_queued++;
+    }
+    mesh_config_request_pump();
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to configure the windows, the timeout and the number of retries. The
+ * command contains the window (1 byte), the window per node (1 byte), the timeout in milliseconds
+ * (2 bytes) and the number of retries (1 byte).
+ */
+uint8_t mesh_app_process_config_request_set(uint8_t *p_data, uint32_t length)
+{
+    uint8_t  window, window_per_dst;
+    uint16_t timeout;
+
+    STREAM_TO_UINT8(window, p_data);
+    STREAM_TO_UINT8(window_per_dst, p_data);
+    STREAM_TO_UINT16(timeout, p_data);
+
+    if ((window == 0) || (window_per_dst == 0) || (timeout == 0))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_config_request_window         = window;
+    mesh_config_request_window_per_dst = window_per_dst;
+    mesh_config_request_timeout        = timeout;
+    STREAM_TO_UINT8(mesh_config_request_max_retries, p_data);
+
+    mesh_config_request_pump();
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the request counters, and to reset them if requested
+ */
+uint8_t mesh_app_process_config_request_stats_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, mesh_config_request_num_queued);
+    UINT8_TO_STREAM(p, mesh_config_request_num_in_flight);
+    UINT32_TO_STREAM(p, mesh_config_request_completed);
+    UINT32_TO_STREAM(p, mesh_config_request_retried);
+    UINT32_TO_STREAM(p, mesh_config_request_failed);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_STATS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (p_data[0] != 0)
+    {
+        mesh_config_request_completed = 0;
+        mesh_config_request_retried   = 0;
+        mesh_config_request_failed    = 0;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
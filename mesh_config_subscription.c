@@ -0,0 +1,319 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file changes the subscription of the same model on a list of nodes with one command from
+ * the MCU. Several nodes are configured at the same time, and the MCU receives one event with
+ * the result of each node in a bitmap when all nodes are done.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_CONFIG_SUBSCRIPTION_HDR_LEN        23      // Operation, sessions, company ID, model ID, address, element
+#define MESH_CONFIG_SUBSCRIPTION_MAX_NODES      ((TRANSPORT_BUFFER_SIZE - MESH_CONFIG_SUBSCRIPTION_HDR_LEN) / 2)   // Nodes which fit in the command
+#define MESH_CONFIG_SUBSCRIPTION_MAX_SESSIONS   8       // Max number of nodes configured at the same time
+#define MESH_CONFIG_SUBSCRIPTION_SESSIONS       4       // Number of nodes configured at the same time if not set by the MCU
+#define MESH_CONFIG_SUBSCRIPTION_TIMEOUT        10      // Time to wait for the status of the node. Value is seconds.
+#define MESH_CONFIG_SUBSCRIPTION_MAX_RETRIES    2       // Number of times a message is sent again after the timeout
+
+// Operation set by the MCU
+#define MESH_CONFIG_SUBSCRIPTION_OP_ADD         0
+#define MESH_CONFIG_SUBSCRIPTION_OP_DELETE      1
+#define MESH_CONFIG_SUBSCRIPTION_OP_OVERWRITE   2
+
+// Element index which means the element hosting the model is found in the composition data of the node
+#define MESH_CONFIG_SUBSCRIPTION_ELEMENT_FIND   0xFF
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t        node;                   // Index of the node in the list, 0xFFFF if the session is not used
+    uint8_t         retries;
+    wiced_timer_t   timer;
+} mesh_config_subscription_session_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_config_subscription_next(mesh_config_subscription_session_t *p_session);
+static wiced_bool_t mesh_config_subscription_send(mesh_config_subscription_session_t *p_session);
+static void mesh_config_subscription_save(mesh_config_subscription_session_t *p_session, wiced_bool_t success);
+static void mesh_config_subscription_result(mesh_config_subscription_session_t *p_session, wiced_bool_t success);
+static void mesh_config_subscription_timer_callback(TIMER_PARAM_TYPE arg);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_config_subscription_session_t   mesh_config_subscription_sessions[MESH_CONFIG_SUBSCRIPTION_MAX_SESSIONS];
+static wiced_bool_t                         mesh_config_subscription_timers_ready = WICED_FALSE;
+
+// Parameters of the command and the progress
+static uint16_t     mesh_config_subscription_nodes[MESH_CONFIG_SUBSCRIPTION_MAX_NODES];
+static uint8_t      mesh_config_subscription_bitmap[(MESH_CONFIG_SUBSCRIPTION_MAX_NODES + 7) / 8];
+static uint16_t     mesh_config_subscription_num_nodes = 0;     // 0 if the command is not executed
+static uint16_t     mesh_config_subscription_next_node;
+static uint16_t     mesh_config_subscription_num_done;
+static uint16_t     mesh_config_subscription_num_failed;
+static uint8_t      mesh_config_subscription_num_sessions;
+static uint8_t      mesh_config_subscription_operation;
+static uint8_t      mesh_config_subscription_element;
+static uint16_t     mesh_config_subscription_company_id;
+static uint16_t     mesh_config_subscription_model_id;
+static uint8_t      mesh_config_subscription_addr[16];
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Start the next node of the list in the session. Nodes to which the message cannot be sent
+ * fail right away and the loop goes on with the following node. When all nodes are done, the
+ * result is sent to the MCU.
+ */
+void mesh_config_subscription_next(mesh_config_subscription_session_t *p_session)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    while (mesh_config_subscription_next_node < mesh_config_subscription_num_nodes)
+    {
+        p_session->node    = mesh_config_subscription_next_node++;
+        p_session->retries = 0;
+        if (mesh_config_subscription_send(p_session))
+            return;
+        mesh_config_subscription_save(p_session, WICED_FALSE);
+    }
+    p_session->node = 0xFFFF;
+    if (mesh_config_subscription_num_done != mesh_config_subscription_num_nodes)
+        return;
+
+    WICED_BT_TRACE("subs done nodes:%d failed:%d\n", mesh_config_subscription_num_nodes, mesh_config_subscription_num_failed);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) != NULL)
+    {
+        p = p_buffer;
+        UINT16_TO_STREAM(p, mesh_config_subscription_num_nodes);
+        UINT16_TO_STREAM(p, mesh_config_subscription_num_failed);
+        ARRAY_TO_STREAM(p, mesh_config_subscription_bitmap, (mesh_config_subscription_num_nodes + 7) / 8);
+        mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE, p_buffer, (uint16_t)(p - p_buffer));
+    }
+    mesh_config_subscription_num_nodes = 0;
+}
+
+/*
+ * Send the subscription message to the node of the session and wait for the status. Returns
+ * WICED_FALSE if the message cannot be sent.
+ */
+wiced_bool_t mesh_config_subscription_send(mesh_config_subscription_session_t *p_session)
+{
+    wiced_bt_mesh_config_model_subscription_change_data_t data;
+    wiced_bt_mesh_event_t *p_event;
+    uint16_t addr = mesh_config_subscription_nodes[p_session->node];
+
+    data.element_addr = addr + mesh_config_subscription_element;
+    if ((mesh_config_subscription_element == MESH_CONFIG_SUBSCRIPTION_ELEMENT_FIND) &&
+        (mesh_app_composition_index_find(addr, mesh_config_subscription_company_id, mesh_config_subscription_model_id, &data.element_addr, 1) == 0))
+        return WICED_FALSE;
+
+    switch (mesh_config_subscription_operation)
+    {
+    case MESH_CONFIG_SUBSCRIPTION_OP_DELETE:
+        data.operation = OPERATION_DELETE;
+        break;
+    case MESH_CONFIG_SUBSCRIPTION_OP_OVERWRITE:
+        data.operation = OPERATION_OVERWRITE;
+        break;
+    default:
+        data.operation = OPERATION_ADD;
+        break;
+    }
+    data.company_id = mesh_config_subscription_company_id;
+    data.model_id   = mesh_config_subscription_model_id;
+    memcpy(data.addr, mesh_config_subscription_addr, sizeof(data.addr));
+
+    if (((p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, addr, 0)) == NULL) ||
+        !wiced_bt_mesh_config_model_subscription_change(p_event, &data))
+        return WICED_FALSE;
+
+    wiced_start_timer(&p_session->timer, MESH_CONFIG_SUBSCRIPTION_TIMEOUT * 1000);
+    return WICED_TRUE;
+}
+
+/*
+ * Save the result of the node of the session
+ */
+void mesh_config_subscription_save(mesh_config_subscription_session_t *p_session, wiced_bool_t success)
+{
+    if (wiced_is_timer_in_use(&p_session->timer))
+        wiced_stop_timer(&p_session->timer);
+
+    if (success)
+        mesh_config_subscription_bitmap[p_session->node / 8] |= 1 << (p_session->node % 8);
+    else
+        mesh_config_subscription_num_failed++;
+
+    mesh_config_subscription_num_done++;
+}
+
+/*
+ * Save the result of the node of the session and continue with the next node
+ */
+void mesh_config_subscription_result(mesh_config_subscription_session_t *p_session, wiced_bool_t success)
+{
+    mesh_config_subscription_save(p_session, success);
+    mesh_config_subscription_next(p_session);
+}
+
+/*
+ * Node did not reply, send the message again or give up the node
+ */
+void mesh_config_subscription_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_config_subscription_session_t *p_session = &mesh_config_subscription_sessions[(uint32_t)arg];
+
+    if (p_session->node == 0xFFFF)
+        return;
+
+    if ((p_session->retries++ >= MESH_CONFIG_SUBSCRIPTION_MAX_RETRIES) || !mesh_config_subscription_send(p_session))
+        mesh_config_subscription_result(p_session, WICED_FALSE);
+}
+
+/*
+ * Process subscription status of the node being configured. Returns WICED_TRUE if the event
+ * should not be sent to the MCU.
+ */
+wiced_bool_t mesh_app_config_subscription_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    mesh_config_subscription_session_t *p_session;
+    uint8_t i;
+
+    if ((mesh_config_subscription_num_nodes == 0) || (event != WICED_BT_MESH_CONFIG_MODEL_SUBSCRIPTION_STATUS))
+        return WICED_FALSE;
+
+    for (i = 0; i < mesh_config_subscription_num_sessions; i++)
+    {
+        p_session = &mesh_config_subscription_sessions[i];
+        if ((p_session->node != 0xFFFF) && (mesh_config_subscription_nodes[p_session->node] == p_event->src))
+        {
+            mesh_config_subscription_result(p_session, ((wiced_bt_mesh_config_model_subscription_status_data_t *)p_data)->status == 0);
+            return WICED_TRUE;
+        }
+    }
+    return WICED_FALSE;
+}
+
+/*
+ * Process command from MCU to change the subscription of the model on the list of nodes. The
+ * command contains operation (1 byte, 0 add, 1 delete, 2 overwrite), number of nodes configured
+ * at the same time (1 byte, 0 for the default), company ID (2 bytes), model ID (2 bytes), group
+ * address or virtual label (16 bytes, group address in the first 2 bytes), element index
+ * (1 byte, 0xFF to find the element hosting the model in the composition data of the node) and
+ * the addresses of the nodes (2 bytes each). A command without nodes stops the current command.
+ */
+uint8_t mesh_app_process_config_subscription_fanout(uint8_t *p_data, uint32_t length)
+{
+    uint16_t num_nodes;
+    uint16_t i;
+
+    if (length < MESH_CONFIG_SUBSCRIPTION_HDR_LEN)
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    num_nodes = (uint16_t)((length - MESH_CONFIG_SUBSCRIPTION_HDR_LEN) / 2);
+    if (((length - MESH_CONFIG_SUBSCRIPTION_HDR_LEN) % 2 != 0) || (num_nodes > MESH_CONFIG_SUBSCRIPTION_MAX_NODES))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    if (!mesh_config_subscription_timers_ready)
+    {
+        for (i = 0; i < MESH_CONFIG_SUBSCRIPTION_MAX_SESSIONS; i++)
+        {
+            wiced_init_timer(&mesh_config_subscription_sessions[i].timer, mesh_config_subscription_timer_callback, (TIMER_PARAM_TYPE)(uint32_t)i, WICED_MILLI_SECONDS_TIMER);
+            mesh_config_subscription_sessions[i].node = 0xFFFF;
+        }
+        mesh_config_subscription_timers_ready = WICED_TRUE;
+    }
+    if (num_nodes == 0)
+    {
+        for (i = 0; i < MESH_CONFIG_SUBSCRIPTION_MAX_SESSIONS; i++)
+        {
+            if (wiced_is_timer_in_use(&mesh_config_subscription_sessions[i].timer))
+                wiced_stop_timer(&mesh_config_subscription_sessions[i].timer);
+            mesh_config_subscription_sessions[i].node = 0xFFFF;
+        }
+        mesh_config_subscription_num_nodes = 0;
+        return HCI_CONTROL_MESH_STATUS_SUCCESS;
+    }
+    if (mesh_config_subscription_num_nodes != 0)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    STREAM_TO_UINT8(mesh_config_subscription_operation, p_data);
+    STREAM_TO_UINT8(mesh_config_subscription_num_sessions, p_data);
+    STREAM_TO_UINT16(mesh_config_subscription_company_id, p_data);
+    STREAM_TO_UINT16(mesh_config_subscription_model_id, p_data);
+    STREAM_TO_ARRAY(mesh_config_subscription_addr, p_data, 16);
+    STREAM_TO_UINT8(mesh_config_subscription_element, p_data);
+    for (i = 0; i < num_nodes; i++)
+        STREAM_TO_UINT16(mesh_config_subscription_nodes[i], p_data);
+
+    if ((mesh_config_subscription_num_sessions == 0) || (mesh_config_subscription_num_sessions > MESH_CONFIG_SUBSCRIPTION_MAX_SESSIONS))
+        mesh_config_subscription_num_sessions = MESH_CONFIG_SUBSCRIPTION_SESSIONS;
+
+    memset(mesh_config_subscription_bitmap, 0, sizeof(mesh_config_subscription_bitmap));
+    mesh_config_subscription_num_nodes  = num_nodes;
+    mesh_config_subscription_next_node  = 0;
+    mesh_config_subscription_num_done   = 0;
+    mesh_config_subscription_num_failed = 0;
+
+    for (i = 0; (i < mesh_config_subscription_num_sessions) && (mesh_config_subscription_num_nodes != 0); i++)
+    {
+        if (mesh_config_subscription_next_node < mesh_config_subscription_num_nodes)
+            mesh_config_subscription_next(&mesh_config_subscription_sessions[i]);
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
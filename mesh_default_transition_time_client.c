@@ -47,6 +47,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 #define MESH_DEFAULT_TRANSITION_TIME_CLIENT_ELEMENT_INDEX   0
 
@@ -89,8 +90,8 @@ void mesh_default_transition_time_client_message_handler(uint16_t event, wiced_b
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -98,7 +99,7 @@ void mesh_default_transition_time_client_message_handler(uint16_t event, wiced_b
         WICED_BT_TRACE("deftt time:%d\n", ((wiced_bt_mesh_default_transition_time_data_t *)p_data)->time);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_default_transition_time_hci_event_send(p_hci_event, (wiced_bt_mesh_default_transition_time_data_t *)p_data);
 #endif
         break;
@@ -146,6 +147,19 @@ uint32_t mesh_default_transition_time_proc_rx_cmd(uint16_t opcode, uint8_t *p_da
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_default_transition_time_proc_rx_cmd
+ */
+static const uint16_t mesh_default_transition_time_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_DEF_TRANS_TIME_GET,
+    HCI_CONTROL_MESH_COMMAND_DEF_TRANS_TIME_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_default_transition_time_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_DEFTT_CLNT, mesh_default_transition_time_client_hci_opcodes, mesh_default_transition_time_proc_rx_cmd);
+#endif
+
 /*
  * Send default_transition_time get command
  */
@@ -176,6 +190,6 @@ void mesh_default_transition_time_hci_event_send(wiced_bt_mesh_hci_event_t *p_hc
 
     UINT32_TO_STREAM(p, p_data->time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DEF_TRANS_TIME_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DEF_TRANS_TIME_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ *
+ * This file collects the time from the reception of a command from the MCU until the reply
+ * of the peer is received. Latencies are counted in log2 histograms for the most recently
+ * used opcodes and destinations.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_HCI_LATENCY_NUM_BUCKETS    16      // Bucket n counts latencies below 2^n ms, the last one all others
+#define MESH_HCI_LATENCY_NUM_OPCODES    6       // Number of opcodes with their own histogram
+#define MESH_HCI_LATENCY_NUM_DSTS       4       // Number of destinations with their own histogram
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t    count[MESH_HCI_LATENCY_NUM_BUCKETS];
+} mesh_hci_latency_histogram_t;
+
+typedef struct
+{
+    uint16_t                        key;        // Opcode or destination address, 0 if the entry is not used
+    uint32_t                        last_used;  // Value of mesh_hci_latency_seq when the entry was last updated
+    mesh_hci_latency_histogram_t    histogram;
+} mesh_hci_latency_entry_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_hci_latency_add(mesh_hci_latency_entry_t *p_table, uint8_t num_entries, uint16_t key, uint8_t bucket);
+static uint8_t *mesh_hci_latency_write(uint8_t *p, mesh_hci_latency_entry_t *p_table, uint8_t num_entries);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_hci_latency_entry_t mesh_hci_latency_opcode[MESH_HCI_LATENCY_NUM_OPCODES];
+static mesh_hci_latency_entry_t mesh_hci_latency_dst[MESH_HCI_LATENCY_NUM_DSTS];
+static uint32_t                 mesh_hci_latency_seq = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Increment the bucket in the histogram of the key. If the key does not have a histogram,
+ * the least recently used entry is reused. Counters stop at the max value.
+ */
+void mesh_hci_latency_add(mesh_hci_latency_entry_t *p_table, uint8_t num_entries, uint16_t key, uint8_t bucket)
+{
+    mesh_hci_latency_entry_t *p_entry = &p_table[0];
+    uint8_t i;
+
+    for (i = 0; i < num_entries; i++)
+    {
+        if (p_table[i].key == key)
+        {
+            p_entry = &p_table[i];
+            break;
+        }
+        if ((p_entry->key != 0) && ((p_table[i].key == 0) || (p_table[i].last_used < p_entry->last_used)))
+            p_entry = &p_table[i];
+    }
+    if (p_entry->key != key)
+    {
+        memset(p_entry, 0, sizeof(mesh_hci_latency_entry_t));
+        p_entry->key = key;
+    }
+    p_entry->last_used = ++mesh_hci_latency_seq;
+
+    if (p_entry->histogram.count[bucket] != 0xFFFF)
+        p_entry->histogram.count[bucket]++;
+}
+
+/*
+ * Count the latency of the command with the opcode sent to dst
+ */
+void mesh_app_latency_record(uint16_t opcode, uint16_t dst, uint32_t latency_ms)
+{
+    uint8_t bucket = 0;
+
+    while ((bucket < MESH_HCI_LATENCY_NUM_BUCKETS - 1) && ((latency_ms >> bucket) != 0))
+        bucket++;
+
+    mesh_hci_latency_add(mesh_hci_latency_opcode, MESH_HCI_LATENCY_NUM_OPCODES, opcode, bucket);
+    mesh_hci_latency_add(mesh_hci_latency_dst, MESH_HCI_LATENCY_NUM_DSTS, dst, bucket);
+}
+
+/*
+ * Write the number of entries followed by the key and the histogram of each entry
+ */
+uint8_t *mesh_hci_latency_write(uint8_t *p, mesh_hci_latency_entry_t *p_table, uint8_t num_entries)
+{
+    uint8_t i, j;
+
+    UINT8_TO_STREAM(p, num_entries);
+    for (i = 0; i < num_entries; i++)
+    {
+        UINT16_TO_STREAM(p, p_table[i].key);
+        for (j = 0; j < MESH_HCI_LATENCY_NUM_BUCKETS; j++)
+            UINT16_TO_STREAM(p, p_table[i].histogram.count[j]);
+    }
+    return p;
+}
+
+/*
+ * Process command from MCU to get the latency histograms, and to reset them if requested
+ */
+uint8_t mesh_app_process_latency_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t reset;
+
+    STREAM_TO_UINT8(reset, p_data);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, MESH_HCI_LATENCY_NUM_BUCKETS);
+    p = mesh_hci_latency_write(p, mesh_hci_latency_opcode, MESH_HCI_LATENCY_NUM_OPCODES);
+    p = mesh_hci_latency_write(p, mesh_hci_latency_dst, MESH_HCI_LATENCY_NUM_DSTS);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LATENCY_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (reset)
+    {
+        memset(mesh_hci_latency_opcode, 0, sizeof(mesh_hci_latency_opcode));
+        memset(mesh_hci_latency_dst, 0, sizeof(mesh_hci_latency_dst));
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
@@ -0,0 +1,361 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file filters the scan reports received during the provisioning before they are sent
+ * to the MCU. Recently seen devices are kept in a small hash table keyed by the UUID, and a
+ * report is sent only for a new device, a significant change of the RSSI, or when the refresh
+ * interval of the device expires. Reports of the devices which do not match the scan filter
+ * (UUID prefix, OOB flags, min RSSI) set with the scan start commands are dropped. AD structures
+ * of the extended scan reports can be limited to the AD types requested by the MCU.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_HCI_SCAN_CACHE_SIZE            64      // Number of devices in the cache. Must be a power of 2.
+#define MESH_HCI_SCAN_MAX_PROBE             8       // Number of slots checked for the UUID before one is replaced
+#define MESH_HCI_SCAN_RSSI_SHIFT            4       // Smoothed RSSI is kept with 4 fractional bits
+#define MESH_HCI_SCAN_RSSI_WEIGHT           2       // New RSSI is weighted 1/4 in the smoothed value
+#define MESH_HCI_SCAN_REFRESH_INTERVAL      2000    // Default time between reports of the same device. Value is milliseconds.
+#define MESH_HCI_SCAN_RSSI_DELTA            6       // Default change of the smoothed RSSI which is reported. Value is dB.
+#define MESH_HCI_SCAN_AD_TYPE_MASK_LEN      (256 / 8) // One bit for each AD type
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    wiced_bool_t    enabled;
+    int8_t          rssi_min;
+    uint16_t        oob_mask;               // OOB flags which the device shall have
+    uint8_t         uuid[MESH_DEVICE_UUID_LEN];
+    uint8_t         uuid_mask[MESH_DEVICE_UUID_LEN];
+} mesh_hci_scan_filter_t;
+
+typedef struct
+{
+    uint8_t     in_use;
+    int8_t      rssi_forwarded;             // Smoothed RSSI when the last report was sent
+    int16_t     rssi_smoothed;              // Value is dB with MESH_HCI_SCAN_RSSI_SHIFT fractional bits
+    uint32_t    last_seen;                  // Time of the last report received. Value is milliseconds.
+    uint32_t    last_forwarded;             // Time of the last report sent
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+} mesh_hci_scan_entry_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static uint32_t mesh_hci_scan_hash(uint8_t *p_uuid);
+static mesh_hci_scan_entry_t *mesh_hci_scan_entry_get(uint8_t *p_uuid, uint32_t now, wiced_bool_t *p_new);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static wiced_bool_t             mesh_hci_scan_dedup = WICED_FALSE;
+static uint16_t                 mesh_hci_scan_refresh_interval = MESH_HCI_SCAN_REFRESH_INTERVAL;
+static uint8_t                  mesh_hci_scan_rssi_delta = MESH_HCI_SCAN_RSSI_DELTA;
+static mesh_hci_scan_entry_t    mesh_hci_scan_cache[MESH_HCI_SCAN_CACHE_SIZE];
+
+static mesh_hci_scan_filter_t   mesh_hci_scan_filter;
+
+// AD types sent in the extended scan reports. All types are sent if the filter is not set.
+static wiced_bool_t             mesh_hci_scan_ad_filter = WICED_FALSE;
+static uint8_t                  mesh_hci_scan_ad_types[MESH_HCI_SCAN_AD_TYPE_MASK_LEN];
+
+// Counters reported to the MCU
+static uint32_t                 mesh_hci_scan_received = 0;
+static uint32_t                 mesh_hci_scan_forwarded = 0;
+static uint32_t                 mesh_hci_scan_suppressed = 0;
+static uint32_t                 mesh_hci_scan_replaced = 0;
+static uint32_t                 mesh_hci_scan_filtered = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * FNV-1a hash of the UUID
+ */
+uint32_t mesh_hci_scan_hash(uint8_t *p_uuid)
+{
+    uint32_t hash = 2166136261u;
+    uint8_t  i;
+
+    for (i = 0; i < MESH_DEVICE_UUID_LEN; i++)
+    {
+        hash ^= p_uuid[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*
+ * Find the cache entry of the UUID. If the UUID is not in the cache, the entry which was not
+ * seen for the longest time among the probed slots is taken for it, and *p_new is set.
+ * Entries are replaced in place and never emptied, so the probe sequence of the other
+ * UUIDs is not broken.
+ */
+mesh_hci_scan_entry_t *mesh_hci_scan_entry_get(uint8_t *p_uuid, uint32_t now, wiced_bool_t *p_new)
+{
+    mesh_hci_scan_entry_t *p_entry;
+    mesh_hci_scan_entry_t *p_oldest = NULL;
+    uint32_t index = mesh_hci_scan_hash(p_uuid);
+    uint8_t  i;
+
+    for (i = 0; i < MESH_HCI_SCAN_MAX_PROBE; i++)
+    {
+        p_entry = &mesh_hci_scan_cache[(index + i) & (MESH_HCI_SCAN_CACHE_SIZE - 1)];
+        if (!p_entry->in_use)
+        {
+            // Slots after a free one were never used by this UUID
+            p_oldest = p_entry;
+            break;
+        }
+        if (memcmp(p_entry->uuid, p_uuid, MESH_DEVICE_UUID_LEN) == 0)
+        {
+            *p_new = WICED_FALSE;
+            return p_entry;
+        }
+        if ((p_oldest == NULL) || (now - p_entry->last_seen > now - p_oldest->last_seen))
+            p_oldest = p_entry;
+    }
+    if (p_oldest->in_use)
+        mesh_hci_scan_replaced++;
+
+    memset(p_oldest, 0, sizeof(mesh_hci_scan_entry_t));
+    p_oldest->in_use = 1;
+    memcpy(p_oldest->uuid, p_uuid, MESH_DEVICE_UUID_LEN);
+    *p_new = WICED_TRUE;
+    return p_oldest;
+}
+
+/*
+ * Set the scan filter from the parameters of the scan start command: UUID (16 bytes), UUID mask
+ * (16 bytes), OOB mask (2 bytes) and min RSSI (1 byte). p_data NULL clears the filter.
+ */
+void mesh_app_scan_filter_set(uint8_t *p_data)
+{
+    memset(&mesh_hci_scan_filter, 0, sizeof(mesh_hci_scan_filter));
+    if (p_data == NULL)
+        return;
+
+    STREAM_TO_ARRAY(mesh_hci_scan_filter.uuid, p_data, MESH_DEVICE_UUID_LEN);
+    STREAM_TO_ARRAY(mesh_hci_scan_filter.uuid_mask, p_data, MESH_DEVICE_UUID_LEN);
+    STREAM_TO_UINT16(mesh_hci_scan_filter.oob_mask, p_data);
+    mesh_hci_scan_filter.rssi_min = (int8_t)*p_data;
+    mesh_hci_scan_filter.enabled  = WICED_TRUE;
+}
+
+/*
+ * Check if the device matches the scan filter. The RSSI is not checked if p_rssi is NULL.
+ */
+wiced_bool_t mesh_app_scan_filter_match(uint8_t *p_uuid, uint16_t oob, int8_t *p_rssi)
+{
+    uint8_t i;
+
+    if (!mesh_hci_scan_filter.enabled)
+        return WICED_TRUE;
+
+    if (((oob & mesh_hci_scan_filter.oob_mask) != mesh_hci_scan_filter.oob_mask) ||
+        ((p_rssi != NULL) && (*p_rssi < mesh_hci_scan_filter.rssi_min)))
+        return WICED_FALSE;
+
+    for (i = 0; i < MESH_DEVICE_UUID_LEN; i++)
+    {
+        if ((p_uuid[i] ^ mesh_hci_scan_filter.uuid[i]) & mesh_hci_scan_filter.uuid_mask[i])
+            return WICED_FALSE;
+    }
+    return WICED_TRUE;
+}
+
+/*
+ * Check if the scan report should be sent to the MCU. Reports which do not match the scan
+ * filter are dropped. *p_rssi is replaced with the smoothed RSSI of the device. Reports are
+ * sent for new devices, when the smoothed RSSI changed by more than the configured delta since
+ * the last report, or when the refresh interval expired.
+ */
+wiced_bool_t mesh_app_scan_report_check(uint8_t *p_uuid, uint16_t oob, int8_t *p_rssi)
+{
+    mesh_hci_scan_entry_t *p_entry;
+    wiced_bool_t is_new;
+    uint32_t now;
+    int16_t  rssi;
+    int16_t  delta;
+
+    mesh_hci_scan_received++;
+    if (!mesh_app_scan_filter_match(p_uuid, oob, p_rssi))
+    {
+        mesh_hci_scan_filtered++;
+        return WICED_FALSE;
+    }
+    if (!mesh_hci_scan_dedup)
+    {
+        mesh_hci_scan_forwarded++;
+        return WICED_TRUE;
+    }
+    now = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    p_entry = mesh_hci_scan_entry_get(p_uuid, now, &is_new);
+    p_entry->last_seen = now;
+
+    if (is_new)
+        p_entry->rssi_smoothed = (int16_t)(*p_rssi * (1 << MESH_HCI_SCAN_RSSI_SHIFT));
+    else
+        p_entry->rssi_smoothed += (int16_t)((*p_rssi * (1 << MESH_HCI_SCAN_RSSI_SHIFT) - p_entry->rssi_smoothed) / (1 << MESH_HCI_SCAN_RSSI_WEIGHT));
+
+    rssi  = p_entry->rssi_smoothed / (1 << MESH_HCI_SCAN_RSSI_SHIFT);
+    delta = rssi - p_entry->rssi_forwarded;
+    if (!is_new && (now - p_entry->last_forwarded < mesh_hci_scan_refresh_interval) &&
+        (delta < mesh_hci_scan_rssi_delta) && (-delta < mesh_hci_scan_rssi_delta))
+    {
+        mesh_hci_scan_suppressed++;
+        return WICED_FALSE;
+    }
+    p_entry->rssi_forwarded = (int8_t)rssi;
+    p_entry->last_forwarded = now;
+    *p_rssi = (int8_t)rssi;
+    mesh_hci_scan_forwarded++;
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to configure de-duplication of the scan reports.
+ * Changing the configuration clears the cache.
+ */
+uint8_t mesh_app_process_scan_dedup_set(uint8_t *p_data, uint32_t length)
+{
+    uint8_t enable;
+
+    STREAM_TO_UINT8(enable, p_data);
+    STREAM_TO_UINT16(mesh_hci_scan_refresh_interval, p_data);
+    STREAM_TO_UINT8(mesh_hci_scan_rssi_delta, p_data);
+
+    mesh_hci_scan_dedup = (enable != 0);
+    memset(mesh_hci_scan_cache, 0, sizeof(mesh_hci_scan_cache));
+    WICED_BT_TRACE("scan dedup:%d refresh:%d delta:%d\n", mesh_hci_scan_dedup, mesh_hci_scan_refresh_interval, mesh_hci_scan_rssi_delta);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the scan report counters, and to reset them if requested
+ */
+uint8_t mesh_app_process_scan_stats_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t reset;
+
+    STREAM_TO_UINT8(reset, p_data);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT32_TO_STREAM(p, mesh_hci_scan_received);
+    UINT32_TO_STREAM(p, mesh_hci_scan_forwarded);
+    UINT32_TO_STREAM(p, mesh_hci_scan_suppressed);
+    UINT32_TO_STREAM(p, mesh_hci_scan_replaced);
+    UINT32_TO_STREAM(p, mesh_hci_scan_filtered);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SCAN_STATS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (reset)
+    {
+        mesh_hci_scan_received   = 0;
+        mesh_hci_scan_forwarded  = 0;
+        mesh_hci_scan_suppressed = 0;
+        mesh_hci_scan_replaced   = 0;
+        mesh_hci_scan_filtered   = 0;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Copy AD structures of the advertising data to p_dst, skipping the AD types which are not
+ * requested by the MCU. The walk stops at the first zero length, which marks the padding,
+ * or at a structure which does not fit in the data. Returns the number of bytes copied.
+ */
+uint16_t mesh_app_scan_ad_copy(uint8_t *p_dst, uint8_t *p_adv_data, uint16_t adv_len)
+{
+    uint16_t offset = 0;
+    uint16_t dst_len = 0;
+    uint8_t  len;
+    uint8_t  type;
+
+    while (offset < adv_len)
+    {
+        len = p_adv_data[offset];
+        if ((len == 0) || (offset + 1 + len > adv_len))
+            break;
+
+        type = p_adv_data[offset + 1];
+        if (!mesh_hci_scan_ad_filter || (mesh_hci_scan_ad_types[type >> 3] & (1 << (type & 7))))
+        {
+            memcpy(&p_dst[dst_len], &p_adv_data[offset], 1 + len);
+            dst_len += 1 + len;
+        }
+        offset += 1 + len;
+    }
+    return dst_len;
+}
+
+/*
+ * Process command from MCU to set the AD types sent in the extended scan reports.
+ * The payload is the list of AD types. An empty list sends all AD types.
+ */
+uint8_t mesh_app_process_scan_ad_filter_set(uint8_t *p_data, uint32_t length)
+{
+    uint8_t type;
+
+    memset(mesh_hci_scan_ad_types, 0, sizeof(mesh_hci_scan_ad_types));
+    mesh_hci_scan_ad_filter = (length != 0);
+
+    while (length-- != 0)
+    {
+        STREAM_TO_UINT8(type, p_data);
+        mesh_hci_scan_ad_types[type >> 3] |= (1 << (type & 7));
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
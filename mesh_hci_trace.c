@@ -0,0 +1,147 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ *
+ * This file implements binary traces for the hot paths. A trace is a record with the trace ID,
+ * a timestamp and up to three arguments, which is saved in a ring and formatted by the MCU
+ * after HCI_CONTROL_MESH_COMMAND_TRACE_GET.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#ifndef MESH_BIN_TRACE_RING_SIZE
+#define MESH_BIN_TRACE_RING_SIZE        32      // Number of records. When the ring is full the oldest record is dropped
+#endif
+#define MESH_BIN_TRACE_MAX_RECORDS      20      // Max number of 18 byte records in one HCI_CONTROL_MESH_EVENT_TRACE_DATA
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t    id;
+    uint32_t    timestamp;
+    uint32_t    arg[3];
+} mesh_bin_trace_record_t;
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+// Records are added and read only in the application thread, so the ring does not need a lock
+static mesh_bin_trace_record_t  mesh_bin_trace_ring[MESH_BIN_TRACE_RING_SIZE];
+static uint8_t                  mesh_bin_trace_first = 0;
+static uint8_t                  mesh_bin_trace_count = 0;
+static uint16_t                 mesh_bin_trace_dropped = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Save the trace record. Use the MESH_BIN_TRACE macro which filters on the module level.
+ */
+void mesh_app_bin_trace(uint16_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2)
+{
+    mesh_bin_trace_record_t *p_record;
+
+    if (mesh_bin_trace_count == MESH_BIN_TRACE_RING_SIZE)
+    {
+        mesh_bin_trace_first = (mesh_bin_trace_first + 1) % MESH_BIN_TRACE_RING_SIZE;
+        mesh_bin_trace_count--;
+        if (mesh_bin_trace_dropped != 0xFFFF)
+            mesh_bin_trace_dropped++;
+    }
+    p_record = &mesh_bin_trace_ring[(mesh_bin_trace_first + mesh_bin_trace_count) % MESH_BIN_TRACE_RING_SIZE];
+    p_record->id        = id;
+    p_record->timestamp = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    p_record->arg[0]    = arg0;
+    p_record->arg[1]    = arg1;
+    p_record->arg[2]    = arg2;
+    mesh_bin_trace_count++;
+}
+
+/*
+ * Process command from MCU to read the trace records. The records are sent in one or more events,
+ * each with the number of records dropped since the previous read and the number of records.
+ */
+uint8_t mesh_app_process_trace_get(uint8_t *p_data, uint32_t length)
+{
+    mesh_bin_trace_record_t *p_record;
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t num_records;
+
+    do
+    {
+        if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+            return HCI_CONTROL_MESH_STATUS_ERROR;
+
+        num_records = (mesh_bin_trace_count > MESH_BIN_TRACE_MAX_RECORDS) ? MESH_BIN_TRACE_MAX_RECORDS : mesh_bin_trace_count;
+
+        p = p_buffer;
+        UINT16_TO_STREAM(p, mesh_bin_trace_dropped);
+        UINT8_TO_STREAM(p, num_records);
+        mesh_bin_trace_dropped = 0;
+
+        while (num_records-- != 0)
+        {
+            p_record = &mesh_bin_trace_ring[mesh_bin_trace_first];
+            UINT16_TO_STREAM(p, p_record->id);
+            UINT32_TO_STREAM(p, p_record->timestamp);
+            UINT32_TO_STREAM(p, p_record->arg[0]);
+            UINT32_TO_STREAM(p, p_record->arg[1]);
+            UINT32_TO_STREAM(p, p_record->arg[2]);
+
+            mesh_bin_trace_first = (mesh_bin_trace_first + 1) % MESH_BIN_TRACE_RING_SIZE;
+            mesh_bin_trace_count--;
+        }
+        mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TRACE_DATA, p_buffer, (uint16_t)(p - p_buffer));
+    } while (mesh_bin_trace_count != 0);
+
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
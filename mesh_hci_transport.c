@@ -0,0 +1,363 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ *
+ * This file implements the events sent by the provisioner client to the MCU over the transport.
+ * In coalescing mode command statuses are collected and sent in a single event. In multiplexing
+ * mode small events are packed together and sent in a single transport buffer.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_HCI_STATUS_RING_SIZE           16      // Max number of command statuses collected before the flush
+#define MESH_HCI_STATUS_MAX_LEN             3       // Status (1 byte) and optional transaction ID (2 bytes)
+#define MESH_HCI_STATUS_COALESCE_DEADLINE   2000    // Default deadline. Value is microseconds.
+
+#define MESH_HCI_MUX_EVENT_HDR_LEN          4       // Opcode (2 bytes) and length (2 bytes) of each event in the frame
+#define MESH_HCI_MUX_FRAME_SIZE             (TRANSPORT_BUFFER_SIZE - 16) // Leave room for the transport header
+#define MESH_HCI_MUX_MAX_EVENT_LEN          64      // Larger events are sent in their own buffer
+#define MESH_HCI_MUX_TIMEOUT                5       // Default time to wait for more events. Value is milliseconds.
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint8_t len;
+    uint8_t data[MESH_HCI_STATUS_MAX_LEN];
+} mesh_hci_status_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_hci_timers_init(void);
+static void mesh_hci_status_timer_callback(TIMER_PARAM_TYPE arg);
+static void mesh_hci_mux_timer_callback(TIMER_PARAM_TYPE arg);
+static void mesh_hci_mux_send(uint16_t opcode, uint8_t *p_data, uint16_t length);
+static void mesh_hci_mux_flush(void);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static wiced_bool_t         mesh_hci_timers_ready = WICED_FALSE;
+
+static wiced_bool_t         mesh_hci_status_coalesce = WICED_FALSE;
+static uint32_t             mesh_hci_status_deadline = MESH_HCI_STATUS_COALESCE_DEADLINE;
+static wiced_timer_t        mesh_hci_status_timer;
+static uint8_t              mesh_hci_status_first = 0;
+static uint8_t              mesh_hci_status_count = 0;
+static mesh_hci_status_t    mesh_hci_status_ring[MESH_HCI_STATUS_RING_SIZE];
+
+static wiced_bool_t         mesh_hci_mux_enabled = WICED_FALSE;
+static uint16_t             mesh_hci_mux_timeout = MESH_HCI_MUX_TIMEOUT;
+static wiced_timer_t        mesh_hci_mux_timer;
+static uint8_t              *p_mesh_hci_mux_frame = NULL;
+static uint16_t             mesh_hci_mux_len = 0;
+static uint8_t              mesh_hci_mux_count = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Initialize timers the first time coalescing or multiplexing is configured
+ */
+void mesh_hci_timers_init(void)
+{
+    if (mesh_hci_timers_ready)
+        return;
+
+    wiced_init_timer(&mesh_hci_status_timer, mesh_hci_status_timer_callback, 0, WICED_MILLI_SECONDS_TIMER);
+    wiced_init_timer(&mesh_hci_mux_timer, mesh_hci_mux_timer_callback, 0, WICED_MILLI_SECONDS_TIMER);
+    mesh_hci_timers_ready = WICED_TRUE;
+}
+
+/*
+ * Send the multiplexed frame. A frame with a single event is sent as that event.
+ */
+void mesh_hci_mux_flush(void)
+{
+    uint8_t  *p;
+    uint16_t opcode;
+    uint16_t length;
+
+    if (p_mesh_hci_mux_frame == NULL)
+        return;
+
+    if (wiced_is_timer_in_use(&mesh_hci_mux_timer))
+        wiced_stop_timer(&mesh_hci_mux_timer);
+
+    if (mesh_hci_mux_count == 1)
+    {
+        p = p_mesh_hci_mux_frame;
+        STREAM_TO_UINT16(opcode, p);
+        STREAM_TO_UINT16(length, p);
+        memmove(p_mesh_hci_mux_frame, p, length);
+        mesh_transport_send_data(opcode, p_mesh_hci_mux_frame, length);
+    }
+    else
+    {
+        mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MULTIPLEXED, p_mesh_hci_mux_frame, mesh_hci_mux_len);
+    }
+    p_mesh_hci_mux_frame = NULL;
+    mesh_hci_mux_len     = 0;
+    mesh_hci_mux_count   = 0;
+}
+
+/*
+ * Send the multiplexed frame when no more events are received before the timeout
+ */
+void mesh_hci_mux_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_hci_mux_flush();
+}
+
+/*
+ * Send event to the MCU, or add it to the multiplexed frame. Each event in the frame is
+ * preceded by its opcode and length. The first event buffer is reused for the frame,
+ * buffers of the following events are released after the copy.
+ */
+void mesh_hci_mux_send(uint16_t opcode, uint8_t *p_data, uint16_t length)
+{
+    uint8_t *p;
+
+    if (!mesh_hci_mux_enabled || (length > MESH_HCI_MUX_MAX_EVENT_LEN))
+    {
+        mesh_hci_mux_flush();
+        mesh_transport_send_data(opcode, p_data, length);
+        return;
+    }
+    if ((p_mesh_hci_mux_frame != NULL) && (mesh_hci_mux_len + MESH_HCI_MUX_EVENT_HDR_LEN + length > MESH_HCI_MUX_FRAME_SIZE))
+        mesh_hci_mux_flush();
+
+    if (p_mesh_hci_mux_frame == NULL)
+    {
+        memmove(p_data + MESH_HCI_MUX_EVENT_HDR_LEN, p_data, length);
+        p_mesh_hci_mux_frame = p_data;
+        wiced_start_timer(&mesh_hci_mux_timer, mesh_hci_mux_timeout);
+    }
+    p = p_mesh_hci_mux_frame + mesh_hci_mux_len;
+    UINT16_TO_STREAM(p, opcode);
+    UINT16_TO_STREAM(p, length);
+    if (p_data != p_mesh_hci_mux_frame)
+    {
+        memcpy(p, p_data, length);
+        wiced_transport_free_buffer(p_data);
+    }
+    mesh_hci_mux_len += MESH_HCI_MUX_EVENT_HDR_LEN + length;
+    mesh_hci_mux_count++;
+}
+
+/*
+ * Enable or disable multiplexing of the events. Events are collected until the frame is full
+ * or timeout_ms expires.
+ */
+void mesh_app_hci_mux_set(wiced_bool_t enable, uint16_t timeout_ms)
+{
+    WICED_BT_TRACE("event mux:%d timeout:%d\n", enable, timeout_ms);
+
+    mesh_hci_timers_init();
+    if (!enable)
+        mesh_hci_mux_flush();
+
+    mesh_hci_mux_enabled = enable;
+    mesh_hci_mux_timeout = (timeout_ms != 0) ? timeout_ms : MESH_HCI_MUX_TIMEOUT;
+}
+
+/*
+ * Process command from MCU to enable or disable multiplexing of the events
+ */
+uint8_t mesh_app_process_event_mux_set(uint8_t *p_data, uint32_t length)
+{
+    uint8_t  enable;
+    uint16_t timeout_ms;
+
+    STREAM_TO_UINT8(enable, p_data);
+    STREAM_TO_UINT16(timeout_ms, p_data);
+
+    mesh_app_hci_mux_set(enable != 0, timeout_ms);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Send all collected command statuses in one event. Each status is preceded by its length.
+ */
+void mesh_app_hci_status_flush(void)
+{
+    mesh_hci_status_t *p_status;
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    if (mesh_hci_status_count == 0)
+        return;
+
+    if (wiced_is_timer_in_use(&mesh_hci_status_timer))
+        wiced_stop_timer(&mesh_hci_status_timer);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+    {
+        WICED_BT_TRACE("status flush no mem, dropped:%d\n", mesh_hci_status_count);
+        mesh_hci_status_count = 0;
+        return;
+    }
+    p = p_buffer;
+    UINT8_TO_STREAM(p, mesh_hci_status_count);
+    while (mesh_hci_status_count != 0)
+    {
+        p_status = &mesh_hci_status_ring[mesh_hci_status_first];
+        UINT8_TO_STREAM(p, p_status->len);
+        ARRAY_TO_STREAM(p, p_status->data, p_status->len);
+
+        mesh_hci_status_first = (mesh_hci_status_first + 1) % MESH_HCI_STATUS_RING_SIZE;
+        mesh_hci_status_count--;
+    }
+    mesh_hci_mux_send(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Flush command statuses when the deadline expires
+ */
+void mesh_hci_status_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_app_hci_status_flush();
+}
+
+/*
+ * Send command status to the MCU, or collect it if coalescing is enabled
+ */
+void mesh_app_hci_status_send(uint8_t *p_data, uint8_t length)
+{
+    mesh_hci_status_t *p_status;
+    uint8_t *p_buffer;
+    uint32_t timeout;
+
+    if (!mesh_hci_status_coalesce)
+    {
+        if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+            return;
+
+        memcpy(p_buffer, p_data, length);
+        mesh_hci_mux_send(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, p_buffer, length);
+        return;
+    }
+    p_status = &mesh_hci_status_ring[(mesh_hci_status_first + mesh_hci_status_count) % MESH_HCI_STATUS_RING_SIZE];
+    p_status->len = (length > MESH_HCI_STATUS_MAX_LEN) ? MESH_HCI_STATUS_MAX_LEN : length;
+    memcpy(p_status->data, p_data, p_status->len);
+
+    if (++mesh_hci_status_count == MESH_HCI_STATUS_RING_SIZE)
+    {
+        mesh_app_hci_status_flush();
+    }
+    else if (mesh_hci_status_count == 1)
+    {
+        // Timer resolution is one millisecond
+        timeout = (mesh_hci_status_deadline + 999) / 1000;
+        wiced_start_timer(&mesh_hci_status_timer, timeout == 0 ? 1 : timeout);
+    }
+}
+
+/*
+ * Enable or disable coalescing of the command statuses. Collected statuses are sent
+ * when the ring is full, when deadline_us expires or before any other event.
+ */
+void mesh_app_hci_status_coalesce_set(wiced_bool_t enable, uint32_t deadline_us)
+{
+    WICED_BT_TRACE("status coalesce:%d deadline:%d\n", enable, deadline_us);
+
+    mesh_hci_timers_init();
+    if (!enable)
+        mesh_app_hci_status_flush();
+
+    mesh_hci_status_coalesce = enable;
+    mesh_hci_status_deadline = (deadline_us != 0) ? deadline_us : MESH_HCI_STATUS_COALESCE_DEADLINE;
+}
+
+/*
+ * Process command from MCU to enable or disable coalescing of the command statuses
+ */
+uint8_t mesh_app_process_status_coalesce_set(uint8_t *p_data, uint32_t length)
+{
+    uint8_t  enable;
+    uint32_t deadline_us;
+
+    STREAM_TO_UINT8(enable, p_data);
+    STREAM_TO_UINT32(deadline_us, p_data);
+
+    mesh_app_hci_status_coalesce_set(enable != 0, deadline_us);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Send event to the MCU. Collected command statuses are sent first to keep the order of events.
+ * p_data is a buffer allocated from the host_trans_pool, or the HCI event created with
+ * mesh_app_create_hci_event.
+ */
+void mesh_app_transport_send_data(uint16_t opcode, uint8_t *p_data, uint16_t length)
+{
+    p_data = mesh_app_transaction_tag(&opcode, p_data, &length);
+
+    mesh_app_hci_status_flush();
+    mesh_hci_mux_send(opcode, p_data, length);
+}
+
+/*
+ * The library would send the tx complete event directly to the transport, where it could
+ * overtake the events waiting in the multiplexed frame. The event is built here in the same
+ * format and sent through the common send path instead. The format must follow
+ * wiced_bt_mesh_send_hci_tx_complete: the event header, tx_flag(1) and dst(2).
+ */
+void mesh_app_send_hci_tx_complete(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_event_t *p_event)
+{
+    uint8_t *p = p_hci_event->data;
+
+    UINT8_TO_STREAM(p, p_event->status.tx_flag);
+    UINT16_TO_STREAM(p, p_event->dst);
+
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TX_COMPLETE, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+}
+
+#endif // HCI_CONTROL
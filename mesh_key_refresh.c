@@ -0,0 +1,452 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file executes the key refresh procedure of the network key on a list of nodes with one
+ * command from the MCU. The new network key and application keys are sent to all nodes, then
+ * all nodes are moved to phase 2 and finally to phase 3. Several nodes are configured at the
+ * same time, and each step starts only when every node has confirmed the previous one. Nodes
+ * which do not reply are tried again at the end of the step. The MCU receives an event for each
+ * node and each step.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_KEY_REFRESH_HDR_LEN            20      // Sessions, net key index, net key, number of app keys
+#define MESH_KEY_REFRESH_APP_KEY_LEN        18      // App key index and app key
+#define MESH_KEY_REFRESH_MAX_NODES          ((TRANSPORT_BUFFER_SIZE - MESH_KEY_REFRESH_HDR_LEN) / 2)   // Nodes which fit in the command
+#define MESH_KEY_REFRESH_MAX_APP_KEYS       4       // Max number of application keys bound to the network key
+#define MESH_KEY_REFRESH_MAX_SESSIONS       8       // Max number of nodes configured at the same time
+#define MESH_KEY_REFRESH_SESSIONS           4       // Number of nodes configured at the same time if not set by the MCU
+#define MESH_KEY_REFRESH_TIMEOUT            10      // Time to wait for the status of the node. Value is seconds.
+#define MESH_KEY_REFRESH_MAX_RETRIES        2       // Number of times a message is sent again after the timeout
+#define MESH_KEY_REFRESH_MAX_PASSES         2       // Number of times the nodes which did not confirm are tried in one step
+
+// Steps of the procedure
+#define MESH_KEY_REFRESH_STEP_UPDATE        0       // New keys are sent, nodes are in phase 1
+#define MESH_KEY_REFRESH_STEP_PHASE2        1       // Nodes use the new keys
+#define MESH_KEY_REFRESH_STEP_PHASE3        2       // Nodes revoke the old keys
+#define MESH_KEY_REFRESH_STEP_DONE          3
+
+// State of the node
+#define MESH_KEY_REFRESH_NODE_CONFIRMED     0x01    // Node confirmed the current step
+#define MESH_KEY_REFRESH_NODE_FAILED        0x02    // Node did not confirm a step and is not configured any more
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t        node;                   // Index of the node in the list, 0xFFFF if the session is not used
+    uint8_t         op;                     // Message of the update step, 0 for the net key, then the app keys
+    uint8_t         retries;
+    wiced_timer_t   timer;
+} mesh_key_refresh_session_t;
+
+typedef struct
+{
+    uint16_t        app_key_idx;
+    uint8_t         app_key[WICED_BT_MESH_KEY_LEN];
+} mesh_key_refresh_app_key_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_key_refresh_step_start(void);
+static void mesh_key_refresh_fill(void);
+static void mesh_key_refresh_send(mesh_key_refresh_session_t *p_session);
+static void mesh_key_refresh_node_done(mesh_key_refresh_session_t *p_session, wiced_bool_t success);
+static void mesh_key_refresh_progress(uint16_t addr, uint8_t status);
+static void mesh_key_refresh_timer_callback(TIMER_PARAM_TYPE arg);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_key_refresh_session_t   mesh_key_refresh_sessions[MESH_KEY_REFRESH_MAX_SESSIONS];
+static wiced_bool_t                 mesh_key_refresh_timers_ready = WICED_FALSE;
+
+// Parameters of the command
+static uint16_t                     mesh_key_refresh_net_key_idx;
+static uint8_t                      mesh_key_refresh_net_key[WICED_BT_MESH_KEY_LEN];
+static mesh_key_refresh_app_key_t   mesh_key_refresh_app_keys[MESH_KEY_REFRESH_MAX_APP_KEYS];
+static uint8_t                      mesh_key_refresh_num_app_keys;
+static uint8_t                      mesh_key_refresh_num_sessions;
+static uint16_t                     mesh_key_refresh_nodes[MESH_KEY_REFRESH_MAX_NODES];
+static uint8_t                      mesh_key_refresh_node_state[MESH_KEY_REFRESH_MAX_NODES];
+static uint16_t                     mesh_key_refresh_num_nodes = 0;     // 0 if the procedure is not executed
+
+// Progress of the procedure
+static uint8_t                      mesh_key_refresh_step;
+static uint8_t                      mesh_key_refresh_pass;
+static uint16_t                     mesh_key_refresh_next_node;
+static wiced_bool_t                 mesh_key_refresh_first_done;        // First node of the list is done in this pass
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Send the progress to the MCU. The address is 0 when the step is finished.
+ */
+void mesh_key_refresh_progress(uint16_t addr, uint8_t status)
+{
+    uint16_t num_confirmed = 0, num_failed = 0;
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint16_t i;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return;
+
+    for (i = 0; i < mesh_key_refresh_num_nodes; i++)
+    {
+        if (mesh_key_refresh_node_state[i] & MESH_KEY_REFRESH_NODE_FAILED)
+            num_failed++;
+        else if (mesh_key_refresh_node_state[i] & MESH_KEY_REFRESH_NODE_CONFIRMED)
+            num_confirmed++;
+    }
+    p = p_buffer;
+    UINT8_TO_STREAM(p, mesh_key_refresh_step);
+    UINT16_TO_STREAM(p, addr);
+    UINT8_TO_STREAM(p, status);
+    UINT16_TO_STREAM(p, num_confirmed);
+    UINT16_TO_STREAM(p, num_failed);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Start the step on all nodes which have not failed
+ */
+void mesh_key_refresh_step_start(void)
+{
+    uint16_t i;
+
+    WICED_BT_TRACE("key refresh step:%d\n", mesh_key_refresh_step);
+
+    for (i = 0; i < mesh_key_refresh_num_nodes; i++)
+        mesh_key_refresh_node_state[i] &= ~MESH_KEY_REFRESH_NODE_CONFIRMED;
+
+    mesh_key_refresh_pass       = 0;
+    mesh_key_refresh_next_node  = 0;
+    mesh_key_refresh_first_done = WICED_FALSE;
+    mesh_key_refresh_fill();
+}
+
+/*
+ * Start the nodes which have not confirmed the step in the free sessions. The first node of the
+ * list, normally the provisioner itself, finishes the step before the other nodes are started.
+ * When all nodes are done, the nodes which did not confirm are tried again, or the procedure
+ * continues with the next step without them.
+ */
+void mesh_key_refresh_fill(void)
+{
+    mesh_key_refresh_session_t *p_session;
+    uint16_t num_pending = 0, num_failed = 0;
+    uint16_t i;
+    uint8_t  num_active = 0;
+    uint8_t  s;
+
+    for (s = 0; s < mesh_key_refresh_num_sessions; s++)
+    {
+        if (mesh_key_refresh_sessions[s].node != 0xFFFF)
+            num_active++;
+    }
+    for (s = 0; s < mesh_key_refresh_num_sessions; s++)
+    {
+        p_session = &mesh_key_refresh_sessions[s];
+        if (p_session->node != 0xFFFF)
+            continue;
+
+        while ((mesh_key_refresh_next_node < mesh_key_refresh_num_nodes) && (mesh_key_refresh_node_state[mesh_key_refresh_next_node] != 0))
+        {
+            if (mesh_key_refresh_next_node++ == 0)
+                mesh_key_refresh_first_done = WICED_TRUE;
+        }
+        // Other nodes wait until the first node of the list is done
+        if ((mesh_key_refresh_next_node == mesh_key_refresh_num_nodes) ||
+            ((mesh_key_refresh_next_node != 0) && !mesh_key_refresh_first_done))
+            break;
+
+        p_session->node    = mesh_key_refresh_next_node++;
+        p_session->op      = 0;
+        p_session->retries = 0;
+        num_active++;
+        mesh_key_refresh_send(p_session);
+    }
+    if ((num_active != 0) || (mesh_key_refresh_next_node < mesh_key_refresh_num_nodes))
+        return;
+
+    // All nodes are done, try again the nodes which did not confirm the step
+    for (i = 0; i < mesh_key_refresh_num_nodes; i++)
+    {
+        if (mesh_key_refresh_node_state[i] == 0)
+            num_pending++;
+    }
+    if ((num_pending != 0) && (++mesh_key_refresh_pass < MESH_KEY_REFRESH_MAX_PASSES))
+    {
+        mesh_key_refresh_next_node  = 0;
+        mesh_key_refresh_first_done = WICED_FALSE;
+        mesh_key_refresh_fill();
+        return;
+    }
+    for (i = 0; i < mesh_key_refresh_num_nodes; i++)
+    {
+        if (mesh_key_refresh_node_state[i] == 0)
+            mesh_key_refresh_node_state[i] = MESH_KEY_REFRESH_NODE_FAILED;
+        if (mesh_key_refresh_node_state[i] & MESH_KEY_REFRESH_NODE_FAILED)
+            num_failed++;
+    }
+    mesh_key_refresh_progress(0, (num_pending == 0) ? 0 : 1);
+
+    if (++mesh_key_refresh_step < MESH_KEY_REFRESH_STEP_DONE)
+    {
+        mesh_key_refresh_step_start();
+        return;
+    }
+    mesh_key_refresh_progress(0, (num_failed == 0) ? 0 : 1);
+    mesh_key_refresh_num_nodes = 0;
+}
+
+/*
+ * Send the current message of the step to the node of the session and wait for the status
+ */
+void mesh_key_refresh_send(mesh_key_refresh_session_t *p_session)
+{
+    wiced_bt_mesh_config_netkey_change_data_t netkey;
+    wiced_bt_mesh_config_appkey_change_data_t appkey;
+    wiced_bt_mesh_config_key_refresh_phase_set_data_t phase;
+    mesh_key_refresh_app_key_t *p_app_key;
+    wiced_bt_mesh_event_t *p_event;
+    wiced_bool_t sent;
+
+    // Message which could not be sent is sent again after the timeout
+    if ((p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, mesh_key_refresh_nodes[p_session->node], 0)) == NULL)
+    {
+        wiced_start_timer(&p_session->timer, MESH_KEY_REFRESH_TIMEOUT * 1000);
+        return;
+    }
+    if (mesh_key_refresh_step != MESH_KEY_REFRESH_STEP_UPDATE)
+    {
+        phase.net_key_idx = mesh_key_refresh_net_key_idx;
+        phase.transition  = (mesh_key_refresh_step == MESH_KEY_REFRESH_STEP_PHASE2) ? 2 : 3;
+        sent = wiced_bt_mesh_config_key_refresh_phase_set(p_event, &phase);
+    }
+    else if (p_session->op == 0)
+    {
+        netkey.operation   = OPERATION_OVERWRITE;
+        netkey.net_key_idx = mesh_key_refresh_net_key_idx;
+        memcpy(netkey.net_key, mesh_key_refresh_net_key, WICED_BT_MESH_KEY_LEN);
+        sent = wiced_bt_mesh_config_netkey_change(p_event, &netkey);
+    }
+    else
+    {
+        p_app_key = &mesh_key_refresh_app_keys[p_session->op - 1];
+        memset(&appkey, 0, sizeof(appkey));
+        appkey.operation   = OPERATION_OVERWRITE;
+        appkey.net_key_idx = mesh_key_refresh_net_key_idx;
+        appkey.app_key_idx = p_app_key->app_key_idx;
+        memcpy(appkey.app_key, p_app_key->app_key, WICED_BT_MESH_KEY_LEN);
+        sent = wiced_bt_mesh_config_appkey_change(p_event, &appkey);
+    }
+    if (!sent)
+        WICED_BT_TRACE("key refresh send failed addr:%x\n", mesh_key_refresh_nodes[p_session->node]);
+
+    wiced_start_timer(&p_session->timer, MESH_KEY_REFRESH_TIMEOUT * 1000);
+}
+
+/*
+ * Save the result of the step on the node of the session and start the next nodes
+ */
+void mesh_key_refresh_node_done(mesh_key_refresh_session_t *p_session, wiced_bool_t success)
+{
+    uint16_t node = p_session->node;
+
+    if (wiced_is_timer_in_use(&p_session->timer))
+        wiced_stop_timer(&p_session->timer);
+
+    if (success)
+        mesh_key_refresh_node_state[node] |= MESH_KEY_REFRESH_NODE_CONFIRMED;
+    if (node == 0)
+        mesh_key_refresh_first_done = WICED_TRUE;
+
+    p_session->node = 0xFFFF;
+    mesh_key_refresh_progress(mesh_key_refresh_nodes[node], success ? 0 : 1);
+    mesh_key_refresh_fill();
+}
+
+/*
+ * Node did not reply, send the message again or give up the node in this pass
+ */
+void mesh_key_refresh_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_key_refresh_session_t *p_session = &mesh_key_refresh_sessions[(uint32_t)arg];
+
+    if (p_session->node == 0xFFFF)
+        return;
+
+    if (p_session->retries++ < MESH_KEY_REFRESH_MAX_RETRIES)
+        mesh_key_refresh_send(p_session);
+    else
+        mesh_key_refresh_node_done(p_session, WICED_FALSE);
+}
+
+/*
+ * Process status of the node being configured. Returns WICED_TRUE if the event should not be
+ * sent to the MCU.
+ */
+wiced_bool_t mesh_app_key_refresh_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    mesh_key_refresh_session_t *p_session = NULL;
+    uint8_t status;
+    uint8_t i;
+
+    if (mesh_key_refresh_num_nodes == 0)
+        return WICED_FALSE;
+
+    for (i = 0; i < mesh_key_refresh_num_sessions; i++)
+    {
+        if ((mesh_key_refresh_sessions[i].node != 0xFFFF) && (mesh_key_refresh_nodes[mesh_key_refresh_sessions[i].node] == p_event->src))
+            p_session = &mesh_key_refresh_sessions[i];
+    }
+    if (p_session == NULL)
+        return WICED_FALSE;
+
+    if ((event == WICED_BT_MESH_CONFIG_NETKEY_STATUS) && (mesh_key_refresh_step == MESH_KEY_REFRESH_STEP_UPDATE) && (p_session->op == 0))
+        status = ((wiced_bt_mesh_config_netkey_status_data_t *)p_data)->status;
+    else if ((event == WICED_BT_MESH_CONFIG_APPKEY_STATUS) && (mesh_key_refresh_step == MESH_KEY_REFRESH_STEP_UPDATE) && (p_session->op != 0))
+        status = ((wiced_bt_mesh_config_appkey_status_data_t *)p_data)->status;
+    else if ((event == WICED_BT_MESH_CONFIG_KEY_REFRESH_PHASE_STATUS) && (mesh_key_refresh_step != MESH_KEY_REFRESH_STEP_UPDATE))
+        status = ((wiced_bt_mesh_config_key_refresh_phase_status_data_t *)p_data)->status;
+    else
+        return WICED_FALSE;
+
+    if ((status == 0) && (mesh_key_refresh_step == MESH_KEY_REFRESH_STEP_UPDATE) && (p_session->op < mesh_key_refresh_num_app_keys))
+    {
+        if (wiced_is_timer_in_use(&p_session->timer))
+            wiced_stop_timer(&p_session->timer);
+        p_session->op++;
+        p_session->retries = 0;
+        mesh_key_refresh_send(p_session);
+    }
+    else
+    {
+        mesh_key_refresh_node_done(p_session, status == 0);
+    }
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to start the key refresh procedure. The command contains number of
+ * nodes configured at the same time (1 byte, 0 for the default), net key index (2 bytes), new
+ * net key (16 bytes), number of app keys (1 byte), app key index (2 bytes) and new app key
+ * (16 bytes) of each app key, and the addresses of the nodes (2 bytes each). The provisioner
+ * should be the first node of the list. A command without nodes stops the procedure.
+ */
+uint8_t mesh_app_process_key_refresh_start(uint8_t *p_data, uint32_t length)
+{
+    uint16_t num_nodes;
+    uint8_t  num_app_keys;
+    uint16_t i;
+
+    if (!mesh_key_refresh_timers_ready)
+    {
+        for (i = 0; i < MESH_KEY_REFRESH_MAX_SESSIONS; i++)
+        {
+            wiced_init_timer(&mesh_key_refresh_sessions[i].timer, mesh_key_refresh_timer_callback, (TIMER_PARAM_TYPE)(uint32_t)i, WICED_MILLI_SECONDS_TIMER);
+            mesh_key_refresh_sessions[i].node = 0xFFFF;
+        }
+        mesh_key_refresh_timers_ready = WICED_TRUE;
+    }
+    if (length == 0)
+    {
+        for (i = 0; i < MESH_KEY_REFRESH_MAX_SESSIONS; i++)
+        {
+            if (wiced_is_timer_in_use(&mesh_key_refresh_sessions[i].timer))
+                wiced_stop_timer(&mesh_key_refresh_sessions[i].timer);
+            mesh_key_refresh_sessions[i].node = 0xFFFF;
+        }
+        mesh_key_refresh_num_nodes = 0;
+        return HCI_CONTROL_MESH_STATUS_SUCCESS;
+    }
+    if (length < MESH_KEY_REFRESH_HDR_LEN)
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    num_app_keys = p_data[MESH_KEY_REFRESH_HDR_LEN - 1];
+    if ((num_app_keys > MESH_KEY_REFRESH_MAX_APP_KEYS) ||
+        (length < MESH_KEY_REFRESH_HDR_LEN + num_app_keys * MESH_KEY_REFRESH_APP_KEY_LEN + 2))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    length   -= MESH_KEY_REFRESH_HDR_LEN + num_app_keys * MESH_KEY_REFRESH_APP_KEY_LEN;
+    num_nodes = (uint16_t)(length / 2);
+    if ((length % 2 != 0) || (num_nodes > MESH_KEY_REFRESH_MAX_NODES))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    if (mesh_key_refresh_num_nodes != 0)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    STREAM_TO_UINT8(mesh_key_refresh_num_sessions, p_data);
+    STREAM_TO_UINT16(mesh_key_refresh_net_key_idx, p_data);
+    STREAM_TO_ARRAY(mesh_key_refresh_net_key, p_data, WICED_BT_MESH_KEY_LEN);
+    STREAM_TO_UINT8(mesh_key_refresh_num_app_keys, p_data);
+    for (i = 0; i < num_app_keys; i++)
+    {
+        STREAM_TO_UINT16(mesh_key_refresh_app_keys[i].app_key_idx, p_data);
+        STREAM_TO_ARRAY(mesh_key_refresh_app_keys[i].app_key, p_data, WICED_BT_MESH_KEY_LEN);
+    }
+    for (i = 0; i < num_nodes; i++)
+        STREAM_TO_UINT16(mesh_key_refresh_nodes[i], p_data);
+
+    if ((mesh_key_refresh_num_sessions == 0) || (mesh_key_refresh_num_sessions > MESH_KEY_REFRESH_MAX_SESSIONS))
+        mesh_key_refresh_num_sessions = MESH_KEY_REFRESH_SESSIONS;
+
+    memset(mesh_key_refresh_node_state, 0, sizeof(mesh_key_refresh_node_state));
+    mesh_key_refresh_num_nodes = num_nodes;
+    mesh_key_refresh_step      = MESH_KEY_REFRESH_STEP_UPDATE;
+    mesh_key_refresh_step_start();
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Structures
@@ -86,8 +87,8 @@ void mesh_level_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -96,7 +97,7 @@ void mesh_level_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
             p_data->present_level, p_data->target_level, p_data->remaining_time);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_level_hci_event_send(p_hci_event, p_data);
 #endif
         break;
@@ -154,6 +155,21 @@ uint32_t mesh_level_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_level_client_proc_rx_cmd
+ */
+static const uint16_t mesh_level_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LEVEL_GET,
+    HCI_CONTROL_MESH_COMMAND_LEVEL_SET,
+    HCI_CONTROL_MESH_COMMAND_LEVEL_DELTA_SET,
+    HCI_CONTROL_MESH_COMMAND_LEVEL_MOVE_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_level_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LEVEL_CLNT, mesh_level_client_hci_opcodes, mesh_level_client_proc_rx_cmd);
+#endif
+
 /*
  * Send level get command
  */
@@ -220,7 +236,7 @@ void mesh_level_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_
     UINT16_TO_STREAM(p, p_data->target_level);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LEVEL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LEVEL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 #define MESH_LIGHT_CTL_CLIENT_ELEMENT_INDEX   0
 
@@ -96,8 +97,8 @@ void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -107,7 +108,7 @@ void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
                 p_status->present.lightness, p_status->present.temperature,
                 p_status->target.lightness, p_status->target.temperature, p_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_ctl_hci_event_send_status(p_hci_event, p_status);
 #endif
         break;
@@ -118,7 +119,7 @@ void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
                 p_default_status->default_status.lightness, p_default_status->default_status.temperature,
                 p_default_status->default_status.delta_uv);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_ctl_hci_event_send_default_status(p_hci_event, p_default_status);
 #endif
         break;
@@ -130,7 +131,7 @@ void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
                 p_status->target.temperature, p_status->target.delta_uv,
                 p_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_ctl_hci_event_send_temperature_status(p_hci_event, p_status);
 #endif
         break;
@@ -140,7 +141,7 @@ void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("temp range status: status %d min/max:%d/%d\n", p_temperature_range_status->status,
                 p_temperature_range_status->min_level, p_temperature_range_status->max_level);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_ctl_hci_event_send_temperature_range_status(p_hci_event, p_temperature_range_status);
 #endif
         break;
@@ -215,10 +216,30 @@ uint32_t mesh_light_ctl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uin
         mesh_light_ctl_client_default_set(p_event, p_data, length);
         break;
 }
+
 #endif
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_light_ctl_client_proc_rx_cmd
+ */
+static const uint16_t mesh_light_ctl_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_RANGE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_TEMPERATURE_RANGE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_DEFAULT_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_CTL_DEFAULT_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_light_ctl_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_LIGHT_CTL_CLNT, mesh_light_ctl_client_hci_opcodes, mesh_light_ctl_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Light CTL get command
  */
@@ -323,7 +344,7 @@ void mesh_light_ctl_hci_event_send_status(wiced_bt_mesh_hci_event_t *p_hci_event
     UINT16_TO_STREAM(p, p_data->target.temperature);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -339,7 +360,7 @@ void mesh_light_ctl_hci_event_send_temperature_status(wiced_bt_mesh_hci_event_t
     UINT16_TO_STREAM(p, p_data->target.delta_uv);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -353,7 +374,7 @@ void mesh_light_ctl_hci_event_send_temperature_range_status(wiced_bt_mesh_hci_ev
     UINT16_TO_STREAM(p, p_data->min_level);
     UINT16_TO_STREAM(p, p_data->max_level);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_TEMPERATURE_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -367,7 +388,7 @@ void mesh_light_ctl_hci_event_send_default_status(wiced_bt_mesh_hci_event_t *p_h
     UINT16_TO_STREAM(p, p_data->default_status.temperature);
     UINT16_TO_STREAM(p, p_data->default_status.delta_uv);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_CTL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
@@ -49,9 +49,17 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 #define MESH_LIGHT_HSL_CLIENT_ELEMENT_INDEX   0
 
+// Payload length of the set commands
+#define MESH_LIGHT_HSL_SET_LEN                12
+#define MESH_LIGHT_HSL_HUE_SET_LEN            8
+#define MESH_LIGHT_HSL_SATURATION_SET_LEN     8
+#define MESH_LIGHT_HSL_DEFAULT_SET_LEN        6
+#define MESH_LIGHT_HSL_RANGE_SET_LEN          8
+
 /******************************************************
  *          Structures
  ******************************************************/
@@ -104,8 +112,8 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -114,7 +122,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status present light:%d hue:%d saturation:%d remain time:%d\n",
                 p_status->present.lightness, p_status->present.hue, p_status->present.saturation, p_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_status(p_hci_event, p_status);
 #endif
         break;
@@ -124,7 +132,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status target light:%d hue:%d saturation:%d remain time:%d\n",
             p_target_status->target.lightness, p_target_status->target.hue, p_target_status->target.saturation, p_target_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_target_status(p_hci_event, p_target_status);
 #endif
         break;
@@ -134,7 +142,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status hue present:%d target:%d remain time:%d\n",
             p_hue_status->present_hue, p_hue_status->target_hue, p_hue_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_hue_status(p_hci_event, p_hue_status);
 #endif
         break;
@@ -144,7 +152,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status saturation present:%d target:%d remain time:%d\n",
             p_saturation_status->present_saturation, p_saturation_status->target_saturation, p_saturation_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_saturation_status(p_hci_event, p_saturation_status);
 #endif
         break;
@@ -154,7 +162,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("default lightness:%d hue:%d saturation:%d\n",
             p_default_status->default_status.lightness, p_default_status->default_status.hue, p_default_status->default_status.saturation);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_default_status(p_hci_event, p_default_status);
 #endif
         break;
@@ -164,7 +172,7 @@ void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("range status:%d hue min/max:%d/%d saturation:%d/%d\n", p_range_status->status,
             p_range_status->hue_min, p_range_status->hue_max, p_range_status->saturation_min, p_range_status->saturation_max);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_hsl_hci_event_send_range_status(p_hci_event, p_range_status);
 #endif
         break;
@@ -257,6 +265,28 @@ uint32_t mesh_light_hsl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uin
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_light_hsl_client_proc_rx_cmd
+ */
+static const uint16_t mesh_light_hsl_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_TARGET_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_RANGE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_RANGE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_DEFAULT_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_DEFAULT_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_HUE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_HUE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SATURATION_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_HSL_SATURATION_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_light_hsl_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_LIGHT_HSL_CLNT, mesh_light_hsl_client_hci_opcodes, mesh_light_hsl_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Light HSL get command
  */
@@ -272,6 +302,9 @@ void mesh_light_hsl_client_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data,
 {
     wiced_bt_mesh_light_hsl_set_t set_data;
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_LIGHT_HSL_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.target.lightness, p_data);
     STREAM_TO_UINT16(set_data.target.hue, p_data);
     STREAM_TO_UINT16(set_data.target.saturation, p_data);
@@ -304,6 +337,9 @@ void mesh_light_hsl_client_hue_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_da
 {
     wiced_bt_mesh_light_hsl_hue_set_t set_data;
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_LIGHT_HSL_HUE_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.level, p_data);
     STREAM_TO_UINT32(set_data.transition_time, p_data);
     STREAM_TO_UINT16(set_data.delay, p_data);
@@ -326,6 +362,9 @@ void mesh_light_hsl_client_saturation_set(wiced_bt_mesh_event_t *p_event, uint8_
 {
     wiced_bt_mesh_light_hsl_saturation_set_t set_data;
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_LIGHT_HSL_SATURATION_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.level, p_data);
     STREAM_TO_UINT32(set_data.transition_time, p_data);
     STREAM_TO_UINT16(set_data.delay, p_data);
@@ -348,6 +387,9 @@ void mesh_light_hsl_client_default_set(wiced_bt_mesh_event_t *p_event, uint8_t *
 {
     wiced_bt_mesh_light_hsl_default_data_t set_data;
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_LIGHT_HSL_DEFAULT_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.default_status.lightness, p_data);
     STREAM_TO_UINT16(set_data.default_status.hue, p_data);
     STREAM_TO_UINT16(set_data.default_status.saturation, p_data);
@@ -370,6 +412,9 @@ void mesh_light_hsl_client_range_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_
 {
     wiced_bt_mesh_light_hsl_range_set_data_t set_data;
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_LIGHT_HSL_RANGE_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.hue_min, p_data);
     STREAM_TO_UINT16(set_data.hue_max, p_data);
     STREAM_TO_UINT16(set_data.saturation_min, p_data);
@@ -391,7 +436,7 @@ void mesh_light_hsl_hci_event_send_status(wiced_bt_mesh_hci_event_t *p_hci_event
     UINT16_TO_STREAM(p, p_data->present.saturation);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -406,7 +451,7 @@ void mesh_light_hsl_hci_event_send_target_status(wiced_bt_mesh_hci_event_t *p_hc
     UINT16_TO_STREAM(p, p_data->target.saturation);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_TARGET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_TARGET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -420,7 +465,7 @@ void mesh_light_hsl_hci_event_send_hue_status(wiced_bt_mesh_hci_event_t *p_hci_e
     UINT16_TO_STREAM(p, p_data->target_hue);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_HUE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_HUE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -434,7 +479,7 @@ void mesh_light_hsl_hci_event_send_saturation_status(wiced_bt_mesh_hci_event_t *
     UINT16_TO_STREAM(p, p_data->target_saturation);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_SATURATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_SATURATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -450,7 +495,7 @@ void mesh_light_hsl_hci_event_send_range_status(wiced_bt_mesh_hci_event_t *p_hci
     UINT16_TO_STREAM(p, p_data->saturation_min);
     UINT16_TO_STREAM(p, p_data->saturation_max);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -464,7 +509,7 @@ void mesh_light_hsl_hci_event_send_default_status(wiced_bt_mesh_hci_event_t *p_h
     UINT16_TO_STREAM(p, p_data->default_status.hue);
     UINT16_TO_STREAM(p, p_data->default_status.saturation);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_HSL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
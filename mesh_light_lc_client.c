@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Function Prototypes
@@ -92,8 +93,8 @@ void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -101,7 +102,7 @@ void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         p_mode = (wiced_bt_mesh_light_lc_mode_set_data_t *)p_data;
         WICED_BT_TRACE("light lc mode:%d\n", p_mode->mode);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lc_hci_event_send_mode_status(p_hci_event, p_mode);
 #endif
         break;
@@ -110,7 +111,7 @@ void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         p_occupancy_mode = (wiced_bt_mesh_light_lc_occupancy_mode_set_data_t *)p_data;
         WICED_BT_TRACE("light lc occupany mode:%d\n", p_occupancy_mode->mode);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lc_hci_event_send_occupancy_mode_status(p_hci_event, p_occupancy_mode);
 #endif
         break;
@@ -120,7 +121,7 @@ void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light onoff status present:%d target:%d remain time:%d\n",
             p_onoff_status->present_onoff, p_onoff_status->target_onoff, p_onoff_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lc_hci_event_send_light_onoff_status(p_hci_event, p_onoff_status);
 #endif
         break;
@@ -129,7 +130,7 @@ void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         p_property_status = (wiced_bt_mesh_light_lc_property_status_data_t *)p_data;
         WICED_BT_TRACE("light property status ID:%d len:%d\n", p_property_status->id, p_property_status->len);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lc_hci_event_send_property_status(p_hci_event, p_property_status);
 #endif
         break;
@@ -207,6 +208,25 @@ uint32_t mesh_light_lc_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_light_lc_client_proc_rx_cmd
+ */
+static const uint16_t mesh_light_lc_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_MODE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_MODE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_OCCUPANCY_MODE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_OCCUPANCY_MODE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_ONOFF_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_ONOFF_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_PROPERTY_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LC_PROPERTY_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_light_lc_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LC_CLNT, mesh_light_lc_client_hci_opcodes, mesh_light_lc_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Light LC Mode Get command
  */
@@ -307,7 +327,7 @@ void mesh_light_lc_hci_event_send_mode_status(wiced_bt_mesh_hci_event_t *p_hci_e
 
     UINT8_TO_STREAM(p, p_data->mode);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_MODE_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_MODE_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -319,7 +339,7 @@ void mesh_light_lc_hci_event_send_occupancy_mode_status(wiced_bt_mesh_hci_event_
 
     UINT8_TO_STREAM(p, p_data->mode);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_OCCUPANCY_MODE_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_OCCUPANCY_MODE_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -333,7 +353,7 @@ void mesh_light_lc_hci_event_send_light_onoff_status(wiced_bt_mesh_hci_event_t *
     UINT8_TO_STREAM(p, p_data->target_onoff);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_ONOFF_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_ONOFF_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -347,7 +367,7 @@ void mesh_light_lc_hci_event_send_property_status(wiced_bt_mesh_hci_event_t *p_h
     memcpy(p, p_data->value, p_data->len);
     p += p_data->len;
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_PROPERTY_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LC_PROPERTY_CLIENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
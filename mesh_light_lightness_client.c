@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 #define MESH_LIGHT_LIGHTNESS_CLIENT_ELEMENT_INDEX   0
 
@@ -109,8 +110,8 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -120,7 +121,7 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
                 p_status_data->present, p_status_data->target, p_status_data->remaining_time);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lightness_hci_event_send(p_hci_event, p_status_data);
 #endif
         break;
@@ -131,7 +132,7 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
                 p_status_data->present, p_status_data->target, p_status_data->remaining_time);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lightness_linear_hci_event_send(p_hci_event, p_status_data);
 #endif
         break;
@@ -141,7 +142,7 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
         WICED_BT_TRACE("last light:%d\n", p_last_status_data->last_level);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lightness_last_hci_event_send(p_hci_event, p_last_status_data);
 #endif
         break;
@@ -151,7 +152,7 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
         WICED_BT_TRACE("default light:%d\n", p_default_status_data->default_level);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lightness_default_hci_event_send(p_hci_event, p_default_status_data);
 #endif
         break;
@@ -161,7 +162,7 @@ void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_e
         WICED_BT_TRACE("status:%d min light:%d max:%d\n", p_range_status_data->status, p_range_status_data->min_level, p_range_status_data->max_level);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_lightness_range_hci_event_status_send(p_hci_event, p_range_status_data);
 #endif
         break;
@@ -242,6 +243,26 @@ uint32_t mesh_light_lightness_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_dat
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_light_lightness_client_proc_rx_cmd
+ */
+static const uint16_t mesh_light_lightness_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LINEAR_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LINEAR_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_LAST_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_DEFAULT_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_DEFAULT_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_RANGE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_LIGHTNESS_RANGE_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_light_lightness_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_LIGHT_LIGHTNESS_CLNT, mesh_light_lightness_client_hci_opcodes, mesh_light_lightness_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Light Lightness Get command
  */
@@ -347,7 +368,7 @@ void mesh_light_lightness_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
     UINT16_TO_STREAM(p, p_data->target);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -361,7 +382,7 @@ void mesh_light_lightness_linear_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci
     UINT16_TO_STREAM(p, p_data->target);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LINEAR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LINEAR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -373,7 +394,7 @@ void mesh_light_lightness_last_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_e
 
     UINT16_TO_STREAM(p, p_data->last_level);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LAST_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_LAST_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -385,7 +406,7 @@ void mesh_light_lightness_default_hci_event_send(wiced_bt_mesh_hci_event_t *p_hc
 
     UINT16_TO_STREAM(p, p_data->default_level);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -399,7 +420,7 @@ void mesh_light_lightness_range_hci_event_status_send(wiced_bt_mesh_hci_event_t
     UINT16_TO_STREAM(p, p_data->min_level);
     UINT16_TO_STREAM(p, p_data->max_level);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_LIGHTNESS_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
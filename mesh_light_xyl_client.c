@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Structures
@@ -95,8 +96,8 @@ void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -105,7 +106,7 @@ void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status present light:%d x:%d y:%d remain time:%d\n",
                 p_status->present.lightness, p_status->present.x, p_status->present.y, p_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_xyl_hci_event_send_status(p_hci_event, p_status);
 #endif
         break;
@@ -115,7 +116,7 @@ void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("light status target light:%d x:%d y:%d remain time:%d\n",
             p_target_status->target.lightness, p_target_status->target.x, p_target_status->target.y, p_target_status->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_xyl_hci_event_send_target_status(p_hci_event, p_target_status);
 #endif
         break;
@@ -125,7 +126,7 @@ void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("default lightness:%d x:%d y:%d\n",
             p_default_status->default_status.lightness, p_default_status->default_status.x, p_default_status->default_status.y);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_xyl_hci_event_send_default_status(p_hci_event, p_default_status);
 #endif
         break;
@@ -135,7 +136,7 @@ void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("range status:%d x min/max:%d/%d y:%d/%d\n", p_range_status->status,
             p_range_status->x_min, p_range_status->x_max, p_range_status->y_min, p_range_status->y_max);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_light_xyl_hci_event_send_range_status(p_hci_event, p_range_status);
 #endif
         break;
@@ -209,6 +210,24 @@ uint32_t mesh_light_xyl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uin
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_light_xyl_client_proc_rx_cmd
+ */
+static const uint16_t mesh_light_xyl_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_TARGET_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_RANGE_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_RANGE_SET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_DEFAULT_GET,
+    HCI_CONTROL_MESH_COMMAND_LIGHT_XYL_DEFAULT_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_light_xyl_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_LIGHT_XYL_CLNT, mesh_light_xyl_client_hci_opcodes, mesh_light_xyl_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Light xyL get command
  */
@@ -299,7 +318,7 @@ void mesh_light_xyl_hci_event_send_status(wiced_bt_mesh_hci_event_t *p_hci_event
     UINT16_TO_STREAM(p, p_data->present.y);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -314,7 +333,7 @@ void mesh_light_xyl_hci_event_send_target_status(wiced_bt_mesh_hci_event_t *p_hc
     UINT16_TO_STREAM(p, p_data->target.y);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_TARGET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_TARGET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -330,7 +349,7 @@ void mesh_light_xyl_hci_event_send_range_status(wiced_bt_mesh_hci_event_t *p_hci
     UINT16_TO_STREAM(p, p_data->y_min);
     UINT16_TO_STREAM(p, p_data->y_max);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -344,7 +363,7 @@ void mesh_light_xyl_hci_event_send_default_status(wiced_bt_mesh_hci_event_t *p_h
     UINT16_TO_STREAM(p, p_data->default_status.x);
     UINT16_TO_STREAM(p, p_data->default_status.y);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LIGHT_XYL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
@@ -50,6 +50,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Structures
@@ -88,8 +89,8 @@ void mesh_location_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -99,7 +100,7 @@ void mesh_location_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
                 p_global->global_latitude, p_global->global_longitude, p_global->global_altitude);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_location_global_hci_event_send(p_hci_event, p_global);
 #endif
         break;
@@ -111,7 +112,7 @@ void mesh_location_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
                 p_local->is_mobile, p_local->update_time, p_local->precision);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_location_local_hci_event_send(p_hci_event, p_local);
 #endif
         break;
@@ -171,6 +172,21 @@ uint32_t mesh_location_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_location_client_proc_rx_cmd
+ */
+static const uint16_t mesh_location_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_LOCATION_GLOBAL_GET,
+    HCI_CONTROL_MESH_COMMAND_LOCATION_LOCAL_GET,
+    HCI_CONTROL_MESH_COMMAND_LOCATION_GLOBAL_SET,
+    HCI_CONTROL_MESH_COMMAND_LOCATION_LOCAL_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_location_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_LOCATION_CLNT, mesh_location_client_hci_opcodes, mesh_location_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Location Get message
  */
@@ -235,7 +251,7 @@ void mesh_location_global_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
     UINT32_TO_STREAM(p, p_data->global_longitude);
     UINT16_TO_STREAM(p, p_data->global_altitude);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LOCATION_GLOBAL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LOCATION_GLOBAL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -253,7 +269,7 @@ void mesh_location_local_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
     UINT8_TO_STREAM(p, p_data->update_time);
     UINT8_TO_STREAM(p, p_data->precision);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LOCATION_LOCAL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LOCATION_LOCAL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
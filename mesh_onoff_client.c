@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 #define MESH_ONOFF_CLIENT_ELEMENT_INDEX   0
 
@@ -94,8 +95,8 @@ void mesh_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -105,7 +106,7 @@ void mesh_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
             p_onoff_status->present_onoff, p_onoff_status->target_onoff, p_onoff_status->remaining_time);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_onoff_hci_event_send(p_hci_event, p_onoff_status);
 #endif
         break;
@@ -153,6 +154,19 @@ uint32_t mesh_onoff_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_onoff_client_proc_rx_cmd
+ */
+static const uint16_t mesh_onoff_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_ONOFF_GET,
+    HCI_CONTROL_MESH_COMMAND_ONOFF_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_onoff_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_ONOFF_CLNT, mesh_onoff_client_hci_opcodes, mesh_onoff_client_proc_rx_cmd);
+#endif
+
 /*
  * Send onoff get command
  */
@@ -189,7 +203,7 @@ void mesh_onoff_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_
     UINT8_TO_STREAM(p, p_data->target_onoff);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_ONOFF_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_ONOFF_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Structures
@@ -92,8 +93,8 @@ void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -103,7 +104,7 @@ void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event
                 ((wiced_bt_mesh_power_level_status_data_t *)p_data)->target_power,
                 ((wiced_bt_mesh_power_level_status_data_t *)p_data)->remaining_time);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_power_level_hci_event_send_status(p_hci_event, (wiced_bt_mesh_power_level_status_data_t *)p_data);
 #endif
         break;
@@ -111,7 +112,7 @@ void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event
     case WICED_BT_MESH_POWER_LEVEL_LAST_STATUS:
         WICED_BT_TRACE("last:%d\n", ((wiced_bt_mesh_power_level_last_data_t *)p_data)->power);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_power_level_hci_event_send_last_status(p_hci_event, (wiced_bt_mesh_power_level_last_data_t *)p_data);
 #endif
         break;
@@ -119,7 +120,7 @@ void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event
     case WICED_BT_MESH_POWER_LEVEL_DEFAULT_STATUS:
         WICED_BT_TRACE("default:%d\n", ((wiced_bt_mesh_power_default_data_t *)p_data)->power);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_power_level_hci_event_send_default_status(p_hci_event, (wiced_bt_mesh_power_default_data_t *)p_data);
 #endif
         break;
@@ -129,7 +130,7 @@ void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event
                 ((wiced_bt_mesh_power_range_status_data_t *)p_data)->power_min,
                 ((wiced_bt_mesh_power_range_status_data_t *)p_data)->power_max);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_power_level_hci_event_send_range_status(p_hci_event, (wiced_bt_mesh_power_range_status_data_t *)p_data);
 #endif
         break;
@@ -205,6 +206,24 @@ uint32_t mesh_power_level_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, u
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_power_level_client_proc_rx_cmd
+ */
+static const uint16_t mesh_power_level_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_GET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_SET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_LAST_GET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_DEFAULT_GET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_DEFAULT_SET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_RANGE_GET,
+    HCI_CONTROL_MESH_COMMAND_POWER_LEVEL_RANGE_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_power_level_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_LEVEL_CLNT, mesh_power_level_client_hci_opcodes, mesh_power_level_client_proc_rx_cmd);
+#endif
+
 /*
  * Send power onoff get command
  */
@@ -288,7 +307,7 @@ void mesh_power_level_hci_event_send_status(wiced_bt_mesh_hci_event_t *p_hci_eve
     UINT16_TO_STREAM(p, p_data->target_power);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -300,7 +319,7 @@ void mesh_power_level_hci_event_send_last_status(wiced_bt_mesh_hci_event_t *p_hc
 
     UINT16_TO_STREAM(p, p_data->power);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_LAST_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_LAST_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -312,7 +331,7 @@ void mesh_power_level_hci_event_send_default_status(wiced_bt_mesh_hci_event_t *p
 
     UINT16_TO_STREAM(p, p_data->power);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_DEFAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -326,7 +345,7 @@ void mesh_power_level_hci_event_send_range_status(wiced_bt_mesh_hci_event_t *p_h
     UINT16_TO_STREAM(p, p_data->power_min);
     UINT16_TO_STREAM(p, p_data->power_max);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_LEVEL_RANGE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
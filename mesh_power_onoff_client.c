@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Function Prototypes
@@ -79,8 +80,8 @@ void mesh_power_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -89,7 +90,7 @@ void mesh_power_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event
         WICED_BT_TRACE("pwr onoff on_power_up:%d\n", p_power_onoff_status->on_power_up);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_power_onoff_hci_event_send(p_hci_event, p_power_onoff_status);
 #endif
         break;
@@ -138,6 +139,19 @@ uint32_t mesh_power_onoff_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, u
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_power_onoff_client_proc_rx_cmd
+ */
+static const uint16_t mesh_power_onoff_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_ONPOWERUP_GET,
+    HCI_CONTROL_MESH_COMMAND_ONPOWERUP_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_power_onoff_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_POWER_ONOFF_CLNT, mesh_power_onoff_client_hci_opcodes, mesh_power_onoff_client_proc_rx_cmd);
+#endif
+
 /*
  * Send power onoff get command
  */
@@ -169,7 +183,7 @@ void mesh_power_onoff_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wic
 
     UINT8_TO_STREAM(p, p_data->on_power_up);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_ONOFF_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_POWER_ONOFF_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
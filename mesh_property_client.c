@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Function Prototypes
@@ -81,8 +82,8 @@ void mesh_property_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -94,7 +95,7 @@ void mesh_property_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("properties type:%d num:%d\n", p_properties_status->type, p_properties_status->properties_num);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_properties_hci_event_send(p_hci_event, p_properties_status);
 #endif
         break;
@@ -106,7 +107,7 @@ void mesh_property_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
         WICED_BT_TRACE("property type:%d id:%04x len:%d\n", p_property_status->type, p_property_status->id, p_property_status->len);
 
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_property_hci_event_send(p_hci_event, p_property_status);
 #endif
         break;
@@ -160,6 +161,20 @@ uint32_t mesh_property_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_property_client_proc_rx_cmd
+ */
+static const uint16_t mesh_property_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_PROPERTIES_GET,
+    HCI_CONTROL_MESH_COMMAND_PROPERTY_GET,
+    HCI_CONTROL_MESH_COMMAND_PROPERTY_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_property_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_GENERIC_PROPERTY_CLNT, mesh_property_client_hci_opcodes, mesh_property_client_proc_rx_cmd);
+#endif
+
 /*
  * Send properties get command
  */
@@ -229,7 +244,7 @@ void mesh_properties_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wice
     for (i = 0; i < p_data->properties_num; i++)
         UINT16_TO_STREAM(p, p_data->id[i]);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROPERTIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROPERTIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -244,7 +259,7 @@ void mesh_property_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_
     UINT16_TO_STREAM(p, p_data->id);
     ARRAY_TO_STREAM(p, p_data->value, p_data->len);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROPERTY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROPERTY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
@@ -0,0 +1,457 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file implements provisioning of a list of devices without the MCU taking part in each
+ * step. For every UUID of the list the provisioning link is established, provisioning is started
+ * with the next free unicast address when the device capabilities are received, the static OOB
+ * value is supplied if requested, and one result is sent to the MCU when provisioning ends.
+ * With several Remote Provisioning Servers, one session per server provisions devices of the
+ * list at the same time.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_timer.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_PROVISION_BATCH_MAX_DEVICES    16      // Max number of UUIDs in one command
+#define MESH_PROVISION_BATCH_MAX_OOB_LEN    32      // Static OOB value can be up to 32 bytes
+#define MESH_PROVISION_BATCH_TIMEOUT        30      // Time to provision one device. Value is seconds.
+#define MESH_PROVISION_BATCH_MAX_SESSIONS   4       // Max number of devices provisioned at the same time
+#define MESH_PROVISION_BATCH_MAX_UNICAST    0x7FFF  // Last unicast address
+
+// States of the provisioning of one device
+#define MESH_PROVISION_BATCH_STATE_IDLE             0
+#define MESH_PROVISION_BATCH_STATE_CONNECTING       1   // Waiting for the capabilities of the device
+#define MESH_PROVISION_BATCH_STATE_PROVISIONING     2   // Waiting for the provisioning end
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+// Parameters shared by all devices of the batch
+typedef struct
+{
+    uint16_t    net_key_idx;
+    uint16_t    next_addr;                  // Unicast address of the next provisioned device
+    uint8_t     identify_duration;
+    uint8_t     use_pb_gatt;
+    uint8_t     algorithm;
+    uint8_t     public_key_type;
+    uint8_t     auth_method;
+    uint8_t     auth_action;
+    uint8_t     auth_size;
+    uint8_t     oob_len;
+    uint8_t     oob[MESH_PROVISION_BATCH_MAX_OOB_LEN];
+    uint8_t     num_devices;
+    uint8_t     next_device;                // Index of the next device to be provisioned
+    uint8_t     num_done;
+    uint8_t     num_sessions;
+    uint8_t     uuid[MESH_PROVISION_BATCH_MAX_DEVICES][MESH_DEVICE_UUID_LEN];
+} mesh_provision_batch_t;
+
+// Provisioning of one device
+typedef struct
+{
+    uint16_t        server_addr;            // Address of the provisioning server, local address for PB-ADV and PB-GATT
+    uint8_t         state;
+    uint8_t         device;                 // Index of the device in the batch
+    uint8_t         elements_num;
+    uint16_t        addr;
+    uint32_t        start_time;             // Time when the provisioning of the device started. Value is milliseconds.
+    wiced_timer_t   timer;
+} mesh_provision_batch_session_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static void mesh_provision_batch_next(mesh_provision_batch_session_t *p_session);
+static void mesh_provision_batch_done(mesh_provision_batch_session_t *p_session, uint8_t result, uint8_t *p_dev_key);
+static void mesh_provision_batch_timer_callback(TIMER_PARAM_TYPE arg);
+static wiced_bt_mesh_event_t *mesh_provision_batch_create_event(mesh_provision_batch_session_t *p_session);
+static mesh_provision_batch_session_t *mesh_provision_batch_session_find(uint16_t server_addr);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static wiced_bool_t                     mesh_provision_batch_active = WICED_FALSE;
+static wiced_bool_t                     mesh_provision_batch_timer_ready = WICED_FALSE;
+static mesh_provision_batch_t           mesh_provision_batch;
+static mesh_provision_batch_session_t   mesh_provision_batch_session[MESH_PROVISION_BATCH_MAX_SESSIONS];
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Create event to send a provisioning request to the provisioning server of the session
+ */
+wiced_bt_mesh_event_t *mesh_provision_batch_create_event(mesh_provision_batch_session_t *p_session)
+{
+    return wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, p_session->server_addr, 0);
+}
+
+/*
+ * Find the active session of the provisioning server
+ */
+mesh_provision_batch_session_t *mesh_provision_batch_session_find(uint16_t server_addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < mesh_provision_batch.num_sessions; i++)
+    {
+        if ((mesh_provision_batch_session[i].server_addr == server_addr) &&
+            (mesh_provision_batch_session[i].state != MESH_PROVISION_BATCH_STATE_IDLE))
+            return &mesh_provision_batch_session[i];
+    }
+    return NULL;
+}
+
+/*
+ * Connect provisioning link of the session to the next device of the batch. The batch is
+ * finished when all devices are done.
+ */
+void mesh_provision_batch_next(mesh_provision_batch_session_t *p_session)
+{
+    wiced_bt_mesh_provision_connect_data_t connect;
+    wiced_bt_mesh_event_t *p_event;
+
+    while (mesh_provision_batch.next_device < mesh_provision_batch.num_devices)
+    {
+        memset(&connect, 0, sizeof(connect));
+        memcpy(connect.uuid, mesh_provision_batch.uuid[mesh_provision_batch.next_device], MESH_DEVICE_UUID_LEN);
+        connect.identify_duration = mesh_provision_batch.identify_duration;
+        connect.procedure         = WICED_BT_MESH_PROVISION_PROCEDURE_PROVISION;
+
+        p_session->device       = mesh_provision_batch.next_device++;
+        p_session->elements_num = 0;
+        p_session->addr         = 0;
+        p_session->start_time   = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+        p_session->state        = MESH_PROVISION_BATCH_STATE_CONNECTING;
+
+        if (((p_event = mesh_provision_batch_create_event(p_session)) != NULL) &&
+            wiced_bt_mesh_provision_connect(p_event, &connect, mesh_provision_batch.use_pb_gatt))
+        {
+            mesh_app_provision_phase(p_session->server_addr, MESH_APP_PROVISION_PHASE_CONNECT, 0);
+            wiced_start_timer(&p_session->timer, MESH_PROVISION_BATCH_TIMEOUT * 1000);
+            return;
+        }
+        mesh_provision_batch_done(p_session, WICED_BT_MESH_PROVISION_RESULT_FAILED, NULL);
+    }
+    if (mesh_provision_batch.num_done == mesh_provision_batch.num_devices)
+        mesh_provision_batch_active = WICED_FALSE;
+}
+
+/*
+ * Send the result of the provisioning of the device of the session to the MCU
+ */
+void mesh_provision_batch_done(mesh_provision_batch_session_t *p_session, uint8_t result, uint8_t *p_dev_key)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    WICED_BT_TRACE("batch provision device:%d addr:%x result:%d\n", p_session->device, p_session->addr, result);
+
+    if (wiced_is_timer_in_use(&p_session->timer))
+        wiced_stop_timer(&p_session->timer);
+    p_session->state = MESH_PROVISION_BATCH_STATE_IDLE;
+    mesh_provision_batch.num_done++;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, p_session->device);
+    UINT8_TO_STREAM(p, mesh_provision_batch.num_devices - mesh_provision_batch.num_done);
+    UINT8_TO_STREAM(p, (uint8_t)(p_session - mesh_provision_batch_session));
+    UINT8_TO_STREAM(p, result);
+    UINT16_TO_STREAM(p, p_session->addr);
+    UINT8_TO_STREAM(p, p_session->elements_num);
+    if (p_dev_key != NULL)
+        ARRAY_TO_STREAM(p, p_dev_key, WICED_BT_MESH_KEY_LEN);
+
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Device did not complete provisioning in time
+ */
+void mesh_provision_batch_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    mesh_provision_batch_session_t *p_session = &mesh_provision_batch_session[(uint32_t)arg];
+    wiced_bt_mesh_event_t *p_event;
+
+    if ((p_event = mesh_provision_batch_create_event(p_session)) != NULL)
+        wiced_bt_mesh_provision_disconnect(p_event);
+
+    mesh_provision_batch_done(p_session, WICED_BT_MESH_PROVISION_RESULT_TIMEOUT, NULL);
+    mesh_provision_batch_next(p_session);
+}
+
+/*
+ * Process provisioning events of the device provisioned by the batch. Returns WICED_TRUE if
+ * the event was consumed and should not be sent to the MCU.
+ */
+wiced_bool_t mesh_app_provision_batch_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    mesh_provision_batch_session_t *p_session;
+    wiced_bt_mesh_provision_device_capabilities_data_t *p_caps;
+    wiced_bt_mesh_provision_device_oob_request_data_t *p_oob;
+    wiced_bt_mesh_provision_link_report_data_t *p_link;
+    wiced_bt_mesh_provision_status_data_t *p_status;
+    wiced_bt_mesh_provision_start_data_t start;
+    wiced_bt_mesh_event_t *p_req;
+    uint8_t *p_oob_value;
+    uint8_t oob_len;
+
+    if (!mesh_provision_batch_active || ((p_session = mesh_provision_batch_session_find(p_event->src)) == NULL))
+        return WICED_FALSE;
+
+    switch (event)
+    {
+    case WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES:
+        p_caps = (wiced_bt_mesh_provision_device_capabilities_data_t *)p_data;
+
+        // Device fails if its elements do not fit in the unicast addresses left
+        p_session->elements_num = p_caps->elements_num;
+        if ((p_caps->elements_num == 0) ||
+            ((uint32_t)mesh_provision_batch.next_addr + p_caps->elements_num - 1 > MESH_PROVISION_BATCH_MAX_UNICAST))
+        {
+            if ((p_req = mesh_provision_batch_create_event(p_session)) != NULL)
+                wiced_bt_mesh_provision_disconnect(p_req);
+            mesh_provision_batch_done(p_session, WICED_BT_MESH_PROVISION_RESULT_FAILED, NULL);
+            mesh_provision_batch_next(p_session);
+            break;
+        }
+        // Addresses are reserved now so that concurrent sessions do not overlap
+        p_session->addr         = mesh_provision_batch.next_addr;
+        p_session->state        = MESH_PROVISION_BATCH_STATE_PROVISIONING;
+        mesh_provision_batch.next_addr += p_caps->elements_num;
+
+        start.addr              = p_session->addr;
+        start.net_key_idx       = mesh_provision_batch.net_key_idx;
+        start.algorithm         = mesh_provision_batch.algorithm;
+        start.public_key_type   = mesh_provision_batch.public_key_type;
+        start.auth_method       = mesh_provision_batch.auth_method;
+        start.auth_action       = mesh_provision_batch.auth_action;
+        start.auth_size         = mesh_provision_batch.auth_size;
+
+        if (((p_req = mesh_provision_batch_create_event(p_session)) == NULL) || !wiced_bt_mesh_provision_start(p_req, &start))
+        {
+            mesh_provision_batch_done(p_session, WICED_BT_MESH_PROVISION_RESULT_FAILED, NULL);
+            mesh_provision_batch_next(p_session);
+        }
+        else
+        {
+            mesh_app_provision_phase(p_session->server_addr, MESH_APP_PROVISION_PHASE_START, 0);
+        }
+        break;
+
+    case WICED_BT_MESH_PROVISION_GET_OOB_DATA:
+        // Only the static OOB can be supplied without the user
+        p_oob = (wiced_bt_mesh_provision_device_oob_request_data_t *)p_data;
+        if ((p_req = mesh_provision_batch_create_event(p_session)) == NULL)
+            break;
+
+        if (p_oob->type != WICED_BT_MESH_PROVISION_GET_OOB_TYPE_ENTER_STATIC)
+        {
+            wiced_bt_mesh_provision_disconnect(p_req);
+            break;
+        }
+        // Value of the device in the static OOB table takes precedence over the batch value
+        if ((oob_len = mesh_app_static_oob_get(mesh_provision_batch.uuid[p_session->device], &p_oob_value)) == 0)
+        {
+            p_oob_value = mesh_provision_batch.oob;
+            oob_len     = mesh_provision_batch.oob_len;
+        }
+        if (wiced_bt_mesh_provision_client_set_oob(p_req, p_oob_value, oob_len))
+            mesh_app_provision_phase(p_session->server_addr, MESH_APP_PROVISION_PHASE_OOB_VALUE, 0);
+        break;
+
+    case WICED_BT_MESH_PROVISION_END:
+        p_status = (wiced_bt_mesh_provision_status_data_t *)p_data;
+        mesh_provision_batch_done(p_session, p_status->result, p_status->dev_key);
+        mesh_provision_batch_next(p_session);
+        break;
+
+    case WICED_BT_MESH_PROVISION_LINK_REPORT:
+        // Link closed before the provisioning end. While connecting, the report can be the close
+        // of the link of the previous device, failure to connect is detected by the timeout.
+        p_link = (wiced_bt_mesh_provision_link_report_data_t *)p_data;
+        if ((p_session->state == MESH_PROVISION_BATCH_STATE_PROVISIONING) &&
+            (p_link->rpr_state != WICED_BT_MESH_REMOTE_PROVISION_STATE_LINK_ACTIVE) &&
+            (p_link->rpr_state != WICED_BT_MESH_REMOTE_PROVISION_STATE_OUTBOUND_PDU_TRANSFER))
+        {
+            mesh_provision_batch_done(p_session, WICED_BT_MESH_PROVISION_RESULT_FAILED, NULL);
+            mesh_provision_batch_next(p_session);
+        }
+        break;
+
+    case WICED_BT_MESH_PROVISION_LINK_STATUS:
+        break;
+
+    default:
+        return WICED_FALSE;
+    }
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to provision a list of devices. Devices receive consecutive unicast
+ * addresses starting from start_addr. The list of UUIDs can be followed by the addresses of
+ * additional provisioning servers. A device is provisioned by each server at the same time.
+ * The start address and the server addresses are unicast addresses, each server is listed once.
+ */
+uint8_t mesh_app_process_provision_batch(uint8_t *p_data, uint32_t length)
+{
+    uint16_t server_addrs[MESH_PROVISION_BATCH_MAX_SESSIONS];
+    uint8_t  num_servers = 0;
+    uint8_t  i, j;
+
+    if (mesh_provision_batch_active)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    STREAM_TO_UINT16(server_addrs[0], p_data);
+    STREAM_TO_UINT16(mesh_provision_batch.net_key_idx, p_data);
+    STREAM_TO_UINT16(mesh_provision_batch.next_addr, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.identify_duration, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.use_pb_gatt, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.algorithm, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.public_key_type, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.auth_method, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.auth_action, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.auth_size, p_data);
+    STREAM_TO_UINT8(mesh_provision_batch.oob_len, p_data);
+    length -= 14;
+
+    if ((mesh_provision_batch.oob_len > MESH_PROVISION_BATCH_MAX_OOB_LEN) || (length < mesh_provision_batch.oob_len + 1))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    STREAM_TO_ARRAY(mesh_provision_batch.oob, p_data, mesh_provision_batch.oob_len);
+    STREAM_TO_UINT8(mesh_provision_batch.num_devices, p_data);
+    length -= mesh_provision_batch.oob_len + 1;
+
+    if ((mesh_provision_batch.num_devices == 0) || (mesh_provision_batch.num_devices > MESH_PROVISION_BATCH_MAX_DEVICES) ||
+        (length < (uint32_t)mesh_provision_batch.num_devices * MESH_DEVICE_UUID_LEN))
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+    for (i = 0; i < mesh_provision_batch.num_devices; i++)
+        STREAM_TO_ARRAY(mesh_provision_batch.uuid[i], p_data, MESH_DEVICE_UUID_LEN);
+    length -= mesh_provision_batch.num_devices * MESH_DEVICE_UUID_LEN;
+
+    if (length != 0)
+    {
+        STREAM_TO_UINT8(num_servers, p_data);
+        if ((num_servers >= MESH_PROVISION_BATCH_MAX_SESSIONS) || (length < 1 + (uint32_t)num_servers * 2))
+            return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+        for (i = 1; i <= num_servers; i++)
+            STREAM_TO_UINT16(server_addrs[i], p_data);
+    }
+    if ((mesh_provision_batch.next_addr == 0) || (mesh_provision_batch.next_addr > MESH_PROVISION_BATCH_MAX_UNICAST))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    for (i = 0; i <= num_servers; i++)
+    {
+        if ((server_addrs[i] == 0) || (server_addrs[i] > MESH_PROVISION_BATCH_MAX_UNICAST))
+            return HCI_CONTROL_MESH_STATUS_ERROR;
+        for (j = 0; j < i; j++)
+        {
+            if (server_addrs[j] == server_addrs[i])
+                return HCI_CONTROL_MESH_STATUS_ERROR;
+        }
+    }
+    if (!mesh_provision_batch_timer_ready)
+    {
+        for (i = 0; i < MESH_PROVISION_BATCH_MAX_SESSIONS; i++)
+            wiced_init_timer(&mesh_provision_batch_session[i].timer, mesh_provision_batch_timer_callback, (TIMER_PARAM_TYPE)(uint32_t)i, WICED_MILLI_SECONDS_TIMER);
+        mesh_provision_batch_timer_ready = WICED_TRUE;
+    }
+    mesh_provision_batch.num_sessions = 1 + num_servers;
+    for (i = 0; i < mesh_provision_batch.num_sessions; i++)
+    {
+        mesh_provision_batch_session[i].server_addr = server_addrs[i];
+        mesh_provision_batch_session[i].state       = MESH_PROVISION_BATCH_STATE_IDLE;
+    }
+    mesh_provision_batch.next_device = 0;
+    mesh_provision_batch.num_done    = 0;
+    mesh_provision_batch_active = WICED_TRUE;
+
+    for (i = 0; i < mesh_provision_batch.num_sessions; i++)
+        mesh_provision_batch_next(&mesh_provision_batch_session[i]);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the progress of each session of the batch
+ */
+uint8_t mesh_app_process_provision_batch_status_get(uint8_t *p_data, uint32_t length)
+{
+    mesh_provision_batch_session_t *p_session;
+    uint32_t now = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t i;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, mesh_provision_batch_active);
+    UINT8_TO_STREAM(p, mesh_provision_batch.num_devices);
+    UINT8_TO_STREAM(p, mesh_provision_batch.num_done);
+    UINT8_TO_STREAM(p, mesh_provision_batch.num_sessions);
+    for (i = 0; i < mesh_provision_batch.num_sessions; i++)
+    {
+        p_session = &mesh_provision_batch_session[i];
+        UINT16_TO_STREAM(p, p_session->server_addr);
+        UINT8_TO_STREAM(p, p_session->state);
+        UINT8_TO_STREAM(p, p_session->device);
+        UINT16_TO_STREAM(p, p_session->addr);
+        UINT32_TO_STREAM(p, (p_session->state == MESH_PROVISION_BATCH_STATE_IDLE) ? 0 : now - p_session->start_time);
+    }
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
@@ -68,94 +68,77 @@
 #include "hci_control_api.h"
 #include "wiced_bt_mesh_client.h"
 #include "wiced_memory.h"
+#include "mesh_provision_client.h"
 
 #include "wiced_bt_cfg.h"
 extern wiced_bt_cfg_settings_t wiced_bt_cfg_settings;
 
-uint32_t mesh_default_transition_time_proc_rx_cmd(uint16_t opcode, uint8_t* p_data, uint32_t length);
 extern void mesh_default_transition_time_client_message_handler(uint16_t event, wiced_bt_mesh_event_t* p_event, void* p_data);
 
 #ifdef WICED_BT_MESH_MODEL_PROPERTY_CLIENT_INCLUDED
-uint32_t mesh_property_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_property_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_BATTERY_CLIENT_INCLUDED
-uint32_t mesh_battery_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_battery_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, mesh_battery_event_t *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LIGHT_LC_CLIENT_INCLUDED
-uint32_t mesh_light_lc_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_light_lc_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LIGHT_XYL_CLIENT_INCLUDED
-uint32_t mesh_light_xyl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_light_xyl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LOCATION_CLIENT_INCLUDED
-uint32_t mesh_location_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_location_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_POWER_LEVEL_CLIENT_INCLUDED
-uint32_t mesh_power_level_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_power_level_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_POWER_ONOFF_CLIENT_INCLUDED
-uint32_t mesh_power_onoff_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_power_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_SCHEDULER_CLIENT_INCLUDED
-uint32_t mesh_scheduler_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_scheduler_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_TIME_CLIENT_INCLUDED
-uint32_t mesh_time_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_time_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_ONOFF_CLIENT_INCLUDED
-uint32_t mesh_onoff_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_onoff_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LEVEL_CLIENT_INCLUDED
-uint32_t mesh_level_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_level_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, wiced_bt_mesh_level_status_data_t *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LIGHT_LIGHTNESS_CLIENT_INCLUDED
-uint32_t mesh_light_lightness_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_light_lightness_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LIGHT_HSL_CLIENT_INCLUDED
-uint32_t mesh_light_hsl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_light_hsl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_LIGHT_CTL_CLIENT_INCLUDED
-uint32_t mesh_light_ctl_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_light_ctl_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_SENSOR_CLIENT_INCLUDED
-uint32_t mesh_sensor_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_sensor_client_message_handler(uint16_t event, wiced_bt_mesh_event_t* p_event, void* p_data);
 #endif
 
 #ifdef WICED_BT_MESH_MODEL_SCENE_CLIENT_INCLUDED
-uint32_t mesh_scene_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 extern void mesh_scene_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 #endif
 
-uint32_t mesh_vendor_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
 wiced_bool_t mesh_gatt_client_local_device_set(wiced_bt_mesh_local_device_set_data_t *p_data);
 
 /******************************************************
@@ -164,15 +147,75 @@ wiced_bool_t mesh_gatt_client_local_device_set(wiced_bt_mesh_local_device_set_da
 #define MESH_PID                0x301D
 #define MESH_VID                0x0002
 #define MESH_APP_RPL_DELAY      30        // Value is seconds. Use RPL = 0 to update immediately so that message cannot be replayed
+
+#define MESH_APP_HCI_CMD_INDEX_SIZE     256 // One entry for each command in the HCI_CONTROL_GROUP_MESH group
+#define MESH_APP_BATCH_MAX_CMDS         64  // Max number of commands in HCI_CONTROL_MESH_COMMAND_BATCH
+#define MESH_APP_BATCH_CMD_HDR_LEN      4   // Length (2 bytes) and opcode (2 bytes) of each command in the batch
+#define MESH_APP_TRANSACTION_HDR_LEN    4   // Transaction ID (2 bytes) and opcode (2 bytes) of the command
+#define MESH_APP_MAX_TRANSACTIONS       16  // Max number of commands received in transactions waiting for a reply from a peer
+#define MESH_APP_MAX_UNTAGGED_CMDS      (MESH_APP_MAX_TRANSACTIONS + MESH_APP_CONFIG_REQUEST_MAX_REQUESTS) // Same for the other commands, including the ones of the config request queue
+#define MESH_APP_TRANSACTION_TIMEOUT    30000 // Value is milliseconds. Commands without reply are dropped after that
+#define MESH_APP_HCI_EVENT_HDR_LEN      11  // Destination and send parameters preceding the payload of the commands sent to a peer
 /******************************************************
  *          Structures
  ******************************************************/
+typedef uint8_t (*mesh_provisioner_cmd_handler_t)(uint8_t *p_data, uint32_t length);
+typedef uint8_t (*mesh_provisioner_event_cmd_handler_t)(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
+typedef uint8_t (*mesh_provisioner_change_cmd_handler_t)(wiced_bt_mesh_event_t *p_event, uint8_t operation, uint8_t *p_data, uint32_t length);
+
+/*
+ * Description of an HCI command processed by the provisioner. Exactly one of the handlers is set.
+ * Commands with p_cmd_handler are executed locally, all others need an event created with the
+ * company_id and model_id. min_length is the minimum length of the payload following the event header.
+ */
+typedef struct
+{
+    uint16_t                                opcode;
+    uint16_t                                company_id;
+    uint16_t                                model_id;
+    uint8_t                                 min_length;
+    uint8_t                                 operation;
+    mesh_provisioner_cmd_handler_t          p_cmd_handler;
+    mesh_provisioner_event_cmd_handler_t    p_event_cmd_handler;
+    mesh_provisioner_change_cmd_handler_t   p_change_cmd_handler;
+} mesh_provisioner_hci_cmd_t;
+
+/*
+ * Payload of the HCI_CONTROL_MESH_COMMAND_SET_LOCAL_DEVICE
+ */
+typedef struct
+{
+    wiced_bt_mesh_local_device_set_data_t   set;
+    uint8_t                                 model_level_access;
+} mesh_provisioner_local_device_set_cmd_t;
+
+/*
+ * Command waiting for the reply from the peer. Reply is the first event from the dst
+ * address for the company_id and model_id. tid is valid for commands received in a transaction.
+ */
+typedef struct
+{
+    wiced_bool_t    in_use;
+    uint16_t        tid;
+    uint16_t        dst;
+    uint16_t        company_id;
+    uint16_t        model_id;
+    uint16_t        opcode;         // HCI command, the latencies are counted per opcode
+    uint32_t        seq;            // Order in which commands have been received
+    uint64_t        timestamp;
+} mesh_app_transaction_t;
 
 /******************************************************
  *          Function Prototypes
  ******************************************************/
 static void mesh_app_init(wiced_bool_t is_provisioned);
 static uint32_t mesh_app_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length);
+static uint8_t mesh_app_hci_cmd_index_get(uint16_t opcode);
+static uint32_t mesh_app_process_batch(uint8_t *p_data, uint32_t length);
+static uint32_t mesh_app_process_transaction(uint8_t *p_data, uint32_t length);
+static mesh_app_transaction_t *mesh_app_transaction_add(uint16_t opcode, uint8_t index, uint8_t *p_data, uint32_t length);
+static mesh_app_transaction_t *mesh_app_transaction_find(mesh_app_transaction_t *p_table, uint8_t table_size, wiced_bt_mesh_event_t *p_event, uint64_t now);
+static mesh_app_transaction_t *mesh_app_transaction_event(wiced_bt_mesh_event_t *p_event);
 static void mesh_config_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
 static uint8_t mesh_provisioner_process_set_local_device(uint8_t *p_data, uint32_t length);
 static uint8_t mesh_provisioner_process_add_vendor_model(uint8_t *p_data, uint32_t length);
@@ -309,7 +352,7 @@ static uint8_t mesh_provisioner_process_health_attention_set(wiced_bt_mesh_event
 static uint8_t mesh_provisioner_process_lpn_poll_timeout_get(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
 static uint8_t mesh_provisioner_process_network_transmit_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
 static uint8_t mesh_provisioner_process_proxy_filter_type_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
-static uint8_t mesh_provisioner_process_proxy_filter_change(wiced_bt_mesh_event_t *p_event, wiced_bool_t is_add, uint8_t *p_data, uint32_t length);
+static uint8_t mesh_provisioner_process_proxy_filter_change(wiced_bt_mesh_event_t *p_event, uint8_t operation, uint8_t *p_data, uint32_t length);
 static void mesh_provisioner_hci_event_provision_end_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_status_data_t *p_data);
 void mesh_provisioner_hci_event_scan_report_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_report_data_t *p_data);
 void mesh_provisioner_hci_event_scan_extended_report_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_extended_report_data_t *p_data);
@@ -360,8 +403,6 @@ static void mesh_provisioner_hci_event_proxy_filter_status_send(wiced_bt_mesh_hc
 static void mesh_provisioner_hci_event_scan_capabilities_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_capabilities_status_data_t *p_data);
 static void mesh_provisioner_hci_event_scan_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_status_data_t *p_data);
 
-static void mesh_provisioner_hci_send_status(uint8_t status);
-
 #ifdef DIRECTED_FORWARDING_SERVER_SUPPORTED
 static void mesh_provisioner_hci_event_df_directed_control_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_control_status_data_t* p_data);
 static void mesh_provisioner_hci_event_df_path_metric_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_path_metric_status_data_t* p_data);
@@ -436,7 +477,324 @@ typedef struct
 #define MESH_APP_MESH_MAX_VENDOR_MODELS 10
 static wiced_bt_mesh_vendor_specific_model_t vendor_model_data[MESH_APP_MESH_MAX_VENDOR_MODELS] = {0};
 
-wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len);
+/*
+ * Model client front-ends which process HCI commands. The tables are searched once to build
+ * the index below, so the order does not matter as long as the opcode lists do not overlap.
+ */
+static const mesh_app_hci_cmd_handler_t *mesh_app_hci_cmd_handlers[] =
+{
+    &mesh_default_transition_time_client_hci_cmd_handler,
+#ifdef WICED_BT_MESH_MODEL_PROPERTY_CLIENT_INCLUDED
+    &mesh_property_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_BATTERY_CLIENT_INCLUDED
+    &mesh_battery_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LIGHT_LC_CLIENT_INCLUDED
+    &mesh_light_lc_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LIGHT_XYL_CLIENT_INCLUDED
+    &mesh_light_xyl_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LOCATION_CLIENT_INCLUDED
+    &mesh_location_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_POWER_LEVEL_CLIENT_INCLUDED
+    &mesh_power_level_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_POWER_ONOFF_CLIENT_INCLUDED
+    &mesh_power_onoff_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_SCHEDULER_CLIENT_INCLUDED
+    &mesh_scheduler_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_TIME_CLIENT_INCLUDED
+    &mesh_time_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_ONOFF_CLIENT_INCLUDED
+    &mesh_onoff_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LEVEL_CLIENT_INCLUDED
+    &mesh_level_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LIGHT_LIGHTNESS_CLIENT_INCLUDED
+    &mesh_light_lightness_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LIGHT_HSL_CLIENT_INCLUDED
+    &mesh_light_hsl_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_LIGHT_CTL_CLIENT_INCLUDED
+    &mesh_light_ctl_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_SENSOR_CLIENT_INCLUDED
+    &mesh_sensor_client_hci_cmd_handler,
+#endif
+#ifdef WICED_BT_MESH_MODEL_SCENE_CLIENT_INCLUDED
+    &mesh_scene_client_hci_cmd_handler,
+#endif
+    &mesh_vendor_client_hci_cmd_handler,
+};
+#define MESH_APP_NUM_HCI_CMD_HANDLERS   (sizeof(mesh_app_hci_cmd_handlers) / sizeof(mesh_app_hci_cmd_handlers[0]))
+
+#define MESH_PROVISIONER_CMD(opcode, min_length, handler) \
+    { opcode, 0, 0, min_length, 0, handler, NULL, NULL }
+#define MESH_PROVISIONER_EVENT_CMD(opcode, company_id, model_id, min_length, handler) \
+    { opcode, company_id, model_id, min_length, 0, NULL, handler, NULL }
+#define MESH_PROVISIONER_CHANGE_CMD(opcode, company_id, model_id, operation, min_length, handler) \
+    { opcode, company_id, model_id, min_length, operation, NULL, NULL, handler }
+
+#define MESH_PROVISIONER_CONFIG_CMD(opcode, min_length, handler) \
+    MESH_PROVISIONER_EVENT_CMD(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, min_length, handler)
+#define MESH_PROVISIONER_CONFIG_CHANGE_CMD(opcode, operation, min_length, handler) \
+    MESH_PROVISIONER_CHANGE_CMD(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, operation, min_length, handler)
+#define MESH_PROVISIONER_PROXY_CMD(opcode, min_length, handler) \
+    MESH_PROVISIONER_EVENT_CMD(opcode, MESH_COMPANY_ID_UNUSED, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, min_length, handler)
+#define MESH_PROVISIONER_PROXY_CHANGE_CMD(opcode, operation, min_length, handler) \
+    MESH_PROVISIONER_CHANGE_CMD(opcode, MESH_COMPANY_ID_UNUSED, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, operation, min_length, handler)
+#define MESH_PROVISIONER_HEALTH_CMD(opcode, min_length, handler) \
+    MESH_PROVISIONER_EVENT_CMD(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_HEALTH_CLNT, min_length, handler)
+#define MESH_PROVISIONER_DFU_CMD(opcode, min_length, handler) \
+    MESH_PROVISIONER_EVENT_CMD(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_FW_DISTRIBUTION_CLNT, min_length, handler)
+
+/*
+ * HCI commands processed by the provisioner
+ */
+static const mesh_provisioner_hci_cmd_t mesh_provisioner_hci_cmds[] =
+{
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_ADD, 5, mesh_provisioner_process_add_vendor_model),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SET_LOCAL_DEVICE, 43, mesh_provisioner_process_set_local_device),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SET_DEVICE_KEY, 20, mesh_provisioner_process_set_dev_key),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SEARCH_PROXY, 1, mesh_provisioner_process_search_proxy),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROXY_CONNECT, 0, mesh_provisioner_process_proxy_connect),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROXY_DISCONNECT, 0, mesh_provisioner_process_proxy_disconnect),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SET_ADV_TX_POWER, 0, mesh_provisioner_process_set_adv_tx_power),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_STATUS_COALESCE_SET, 5, mesh_app_process_status_coalesce_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_EVENT_MUX_SET, 3, mesh_app_process_event_mux_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_LATENCY_GET, 1, mesh_app_process_latency_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_TRACE_GET, 0, mesh_app_process_trace_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SCAN_DEDUP_SET, 4, mesh_app_process_scan_dedup_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SCAN_STATS_GET, 1, mesh_app_process_scan_stats_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET, 0, mesh_app_process_scan_ad_filter_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH, 15, mesh_app_process_provision_batch),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH_STATUS_GET, 0, mesh_app_process_provision_batch_status_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET, 0, mesh_app_process_config_recipe_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_SET, 1, mesh_app_process_provision_phase_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_STATS_GET, 1, mesh_app_process_provision_phase_stats_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD, 1, mesh_app_process_static_oob_add),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_STATIC_OOB_STATS_GET, 1, mesh_app_process_static_oob_stats_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_STATS_GET, 1, mesh_app_process_composition_cache_stats_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_COMPOSITION_MODEL_FIND, 6, mesh_app_process_composition_model_find),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE, 0, mesh_app_process_config_request_queue),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET, 5, mesh_app_process_config_request_set),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_STATS_GET, 1, mesh_app_process_config_request_stats_get),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_SUBSCRIPTION_FANOUT, 0, mesh_app_process_config_subscription_fanout),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START, 0, mesh_app_process_key_refresh_start),
+#ifdef PRIVATE_PROXY_SUPPORTED
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_SEND_SOLICITATION_PDU, 9, mesh_provisioner_send_solicitation_pdu),
+#endif
+#ifdef OPCODES_AGGREGATOR_SUPPORTED
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_OPCODES_AGGREGATOR_START, 8, mesh_provisioner_process_aggregator_start),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_OPCODES_AGGREGATOR_FINISH, 1, mesh_provisioner_process_aggregator_finish),
+#endif
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_CAPABILITIES_GET, 0, mesh_provisioner_process_scan_capabilities_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_GET, 0, mesh_provisioner_process_scan_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_START, 2, mesh_provisioner_process_scan_start),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_STOP, 0, mesh_provisioner_process_scan_stop),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_EXTENDED_START, 1, mesh_provisioner_process_extended_scan_start),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_CONNECT, 19, mesh_provisioner_process_connect),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_DISCONNECT, 0, mesh_provisioner_process_disconnect),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_START, 9, mesh_provisioner_process_start),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_OOB_VALUE, 0, mesh_provisioner_process_oob_value),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_RESET, 0, mesh_provisioner_process_node_reset),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_GET, 0, mesh_provisioner_process_beacon_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_SET, 1, mesh_provisioner_process_beacon_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_COMPOSITION_DATA_GET, 1, mesh_provisioner_process_composition_data_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_GET, 7, mesh_app_process_composition_cache_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET, 0, mesh_provisioner_process_default_ttl_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET, 1, mesh_provisioner_process_default_ttl_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_GET, 0, mesh_provisioner_process_gatt_proxy_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_SET, 1, mesh_provisioner_process_gatt_proxy_set),
+#ifdef DIRECTED_FORWARDING_SERVER_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_GET, 0, mesh_provisioner_process_df_directed_control_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_SET, 0, mesh_provisioner_process_df_directed_control_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_GET, 0, mesh_provisioner_process_df_path_metric_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_SET, 0, mesh_provisioner_process_df_path_metric_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_GET, 0, mesh_provisioner_process_df_discovery_table_capabilities_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_SET, 0, mesh_provisioner_process_df_discovery_table_capabilities_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ADD, 0, mesh_provisioner_process_df_forwarding_table_add),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DELETE, 0, mesh_provisioner_process_df_forwarding_table_delete),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_ADD, 0, mesh_provisioner_process_df_forwarding_table_dependents_add),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_DELETE, 0, mesh_provisioner_process_df_forwarding_table_dependents_delete),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_GET, 0, mesh_provisioner_process_df_forwarding_table_dependents_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_COUNT_GET, 0, mesh_provisioner_process_df_forwarding_table_entries_count_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_GET, 0, mesh_provisioner_process_df_forwarding_table_entries_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_GET, 0, mesh_provisioner_process_df_wanted_lanes_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_SET, 0, mesh_provisioner_process_df_wanted_lanes_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_GET, 0, mesh_provisioner_process_df_two_way_path_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_SET, 0, mesh_provisioner_process_df_two_way_path_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_GET, 0, mesh_provisioner_process_df_path_echo_interval_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_SET, 0, mesh_provisioner_process_df_path_echo_interval_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_GET, 0, mesh_provisioner_process_df_directed_network_transmit_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_SET, 0, mesh_provisioner_process_df_directed_network_transmit_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_GET, 0, mesh_provisioner_process_df_directed_relay_retransmit_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_SET, 0, mesh_provisioner_process_df_directed_relay_retransmit_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_GET, 0, mesh_provisioner_process_df_rssi_threshold_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_SET, 0, mesh_provisioner_process_df_rssi_threshold_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PATHS_GET, 0, mesh_provisioner_process_df_directed_paths_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_GET, 0, mesh_provisioner_process_df_directed_publish_policy_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_SET, 0, mesh_provisioner_process_df_directed_publish_policy_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_GET, 0, mesh_provisioner_process_df_path_discovery_timing_control_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_SET, 0, mesh_provisioner_process_df_path_discovery_timing_control_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_GET, 0, mesh_provisioner_process_df_directed_control_network_transmit_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_SET, 0, mesh_provisioner_process_df_directed_control_network_transmit_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_GET, 0, mesh_provisioner_process_df_directed_control_relay_retransmit_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_SET, 0, mesh_provisioner_process_df_directed_control_relay_retransmit_set),
+#endif
+#ifdef NETWORK_FILTER_SERVER_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_GET, 0, mesh_provisioner_process_network_filter_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_SET, 0, mesh_provisioner_process_network_filter_set),
+#endif
+#ifdef LARGE_COMPOSITION_DATA_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_LARGE_COMPOS_DATA_GET, 3, mesh_provisioner_process_large_compos_data_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODELS_METADATA_GET, 3, mesh_provisioner_process_models_metadata_get),
+#endif
+#ifdef SAR_CONFIGURATION_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_GET, 0, mesh_provisioner_process_sar_transmitter_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_SET, 0, mesh_provisioner_process_sar_transmitter_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_GET, 0, mesh_provisioner_process_sar_receiver_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_SET, 0, mesh_provisioner_process_sar_receiver_set),
+#endif
+#ifdef PRIVATE_PROXY_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_GET, 0, mesh_provisioner_process_private_beacon_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_SET, 1, mesh_provisioner_process_private_beacon_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_GET, 0, mesh_provisioner_process_private_gatt_proxy_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_SET, 1, mesh_provisioner_process_private_gatt_proxy_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_GET, 2, mesh_provisioner_process_private_node_identity_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_SET, 3, mesh_provisioner_process_private_node_identity_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_GET, 0, mesh_provisioner_process_on_demand_private_proxy_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_SET, 1, mesh_provisioner_process_on_demand_private_proxy_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_SOLICITATION_PDU_RPL_ITEMS_CLEAR, 3, mesh_provisioner_process_solicitation_pdu_rpl_items_clear),
+#endif
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_GET, 0, mesh_provisioner_process_relay_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_SET, 4, mesh_provisioner_process_relay_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_GET, 0, mesh_provisioner_process_friend_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_SET, 1, mesh_provisioner_process_friend_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_GET, 2, mesh_provisioner_process_key_refresh_phase_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_SET, 3, mesh_provisioner_process_key_refresh_phase_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_GET, 2, mesh_provisioner_process_node_identity_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_SET, 3, mesh_provisioner_process_node_identity_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_GET, 6, mesh_provisioner_process_model_publication_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET, 33, mesh_provisioner_process_model_publication_set),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_ADD, OPERATION_ADD, 22, mesh_provisioner_process_model_subscription_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE, OPERATION_DELETE, 22, mesh_provisioner_process_model_subscription_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_OVERWRITE, OPERATION_OVERWRITE, 22, mesh_provisioner_process_model_subscription_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE_ALL, OPERATION_DELETE_ALL, 6, mesh_provisioner_process_model_subscription_change),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_GET, 6, mesh_provisioner_process_model_subscription_get),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_ADD, OPERATION_ADD, 18, mesh_provisioner_process_netkey_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_DELETE, OPERATION_DELETE, 2, mesh_provisioner_process_netkey_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_UPDATE, OPERATION_OVERWRITE, 18, mesh_provisioner_process_netkey_change),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_GET, 0, mesh_provisioner_process_netkey_get),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_ADD, OPERATION_ADD, 20, mesh_provisioner_process_appkey_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_DELETE, OPERATION_DELETE, 4, mesh_provisioner_process_appkey_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_UPDATE, OPERATION_OVERWRITE, 20, mesh_provisioner_process_appkey_change),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_GET, 2, mesh_provisioner_process_appkey_get),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND, OPERATION_ADD, 8, mesh_provisioner_process_model_app_change),
+    MESH_PROVISIONER_CONFIG_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_UNBIND, OPERATION_DELETE, 8, mesh_provisioner_process_model_app_change),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_GET, 6, mesh_provisioner_process_model_app_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_GET, 0, mesh_provisioner_process_heartbeat_subscription_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_SET, 8, mesh_provisioner_process_heartbeat_subscription_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_GET, 0, mesh_provisioner_process_heartbeat_publication_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_SET, 17, mesh_provisioner_process_heartbeat_publication_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_GET, 0, mesh_provisioner_process_network_transmit_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_SET, 3, mesh_provisioner_process_network_transmit_set),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_CONFIG_LPN_POLL_TIMEOUT_GET, 2, mesh_provisioner_process_lpn_poll_timeout_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA, 2, mesh_provisioner_process_raw_model_data),
+    MESH_PROVISIONER_PROXY_CMD(HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_TYPE_SET, 1, mesh_provisioner_process_proxy_filter_type_set),
+    MESH_PROVISIONER_PROXY_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_ADD, OPERATION_ADD, 0, mesh_provisioner_process_proxy_filter_change),
+    MESH_PROVISIONER_PROXY_CHANGE_CMD(HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_DELETE, OPERATION_DELETE, 0, mesh_provisioner_process_proxy_filter_change),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_GET, 2, mesh_provisioner_process_health_fault_get),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_CLEAR, 2, mesh_provisioner_process_health_fault_clear),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_TEST, 3, mesh_provisioner_process_health_fault_test),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_GET, 0, mesh_provisioner_process_health_period_get),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_SET, 1, mesh_provisioner_process_health_period_set),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_GET, 0, mesh_provisioner_process_health_attention_get),
+    MESH_PROVISIONER_HEALTH_CMD(HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_SET, 1, mesh_provisioner_process_health_attention_set),
+#ifdef CERTIFICATE_BASED_PROVISIONING_SUPPORTED
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_SEND_INVITE, 0, mesh_provisioner_process_send_invite),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_RETRIEVE_RECORD, 6, mesh_provisioner_process_record_get),
+    MESH_PROVISIONER_CONFIG_CMD(HCI_CONTROL_MESH_COMMAND_PROVISION_RECORD_FETCH, 21, mesh_app_process_provision_record_fetch),
+#endif
+#ifdef MESH_DFU_SUPPORTED
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_START, 0, mesh_provisioner_process_fw_upload_start),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_DATA, 4, mesh_provisioner_process_fw_upload_data),
+    MESH_PROVISIONER_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_FINISH, 1, mesh_provisioner_process_fw_upload_finish),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_UPDATE_METADATA_CHECK, 1, mesh_provisioner_process_fw_update_metadata_check),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_START, 1, mesh_provisioner_process_fw_distribution_start),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_SUSPEND, 0, mesh_provisioner_process_fw_distribution_suspend),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_RESUME, 0, mesh_provisioner_process_fw_distribution_resume),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_STOP, 0, mesh_provisioner_process_fw_distribution_stop),
+    MESH_PROVISIONER_DFU_CMD(HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_GET_STATUS, 0, mesh_provisioner_process_fw_distribution_get_status),
+#endif
+};
+#define MESH_PROVISIONER_NUM_HCI_CMDS   (sizeof(mesh_provisioner_hci_cmds) / sizeof(mesh_provisioner_hci_cmds[0]))
+
+// Entries of the index are uint8_t and 0 means that the command is unknown
+_Static_assert(MESH_APP_NUM_HCI_CMD_HANDLERS + MESH_PROVISIONER_NUM_HCI_CMDS <= 0xFF, "too many HCI command entries for the index");
+
+// Payload layouts of the commands which are decoded with mesh_app_hci_decode
+static const mesh_app_hci_field_t mesh_provisioner_local_device_set_fields[] =
+{
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, set.addr, 2),
+    MESH_APP_HCI_ARRAY(mesh_provisioner_local_device_set_cmd_t, set.dev_key, 16),
+    MESH_APP_HCI_ARRAY(mesh_provisioner_local_device_set_cmd_t, set.network_key, 16),
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, set.net_key_idx, 2),
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, set.iv_idx, 4),
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, set.key_refresh, 1),
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, set.iv_update, 1),
+    MESH_APP_HCI_FIELD(mesh_provisioner_local_device_set_cmd_t, model_level_access, 1),
+};
+static const mesh_app_hci_layout_t mesh_provisioner_local_device_set_layout =
+    MESH_APP_HCI_LAYOUT(mesh_provisioner_local_device_set_cmd_t, mesh_provisioner_local_device_set_fields);
+
+static const mesh_app_hci_field_t mesh_provisioner_model_publication_set_fields[] =
+{
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, element_addr, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, company_id, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, model_id, 2),
+    MESH_APP_HCI_ARRAY(wiced_bt_mesh_config_model_publication_set_data_t, publish_addr, 16),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, app_key_idx, 2),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, credential_flag, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_ttl, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_period, 4),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_retransmit_count, 1),
+    MESH_APP_HCI_FIELD(wiced_bt_mesh_config_model_publication_set_data_t, publish_retransmit_interval, 2),
+};
+static const mesh_app_hci_layout_t mesh_provisioner_model_publication_set_layout =
+    MESH_APP_HCI_LAYOUT(wiced_bt_mesh_config_model_publication_set_data_t, mesh_provisioner_model_publication_set_fields);
+
+// Index for each command of the mesh group. 0 if the command is unknown, 1 to MESH_APP_NUM_HCI_CMD_HANDLERS
+// for the model client front-ends followed by the entries of the mesh_provisioner_hci_cmds.
+static uint8_t      mesh_app_hci_cmd_index[MESH_APP_HCI_CMD_INDEX_SIZE];
+
+// While a batch is executed the command status is saved here instead of being sent to the MCU
+static wiced_bool_t mesh_app_batch_active = WICED_FALSE;
+static uint8_t      mesh_app_batch_cmd_status;
+
+// While a transaction is executed the transaction ID is added to the command status. Commands
+// received in a transaction and the other commands are kept apart, so that a command without
+// reply never takes the transaction ID of the reply to a tagged command.
+static wiced_bool_t             mesh_app_transaction_active = WICED_FALSE;
+static uint16_t                 mesh_app_transaction_id;
+static mesh_app_transaction_t   *p_mesh_app_transaction_pending;
+static mesh_app_transaction_t   mesh_app_transactions[MESH_APP_MAX_TRANSACTIONS];
+static mesh_app_transaction_t   mesh_app_untagged_cmds[MESH_APP_MAX_UNTAGGED_CMDS];
+static uint32_t                 mesh_app_transaction_seq = 0;
+// HCI event created for the reply to a command received in a transaction and not sent yet.
+// The buffer starts MESH_APP_TRANSACTION_HDR_LEN bytes before the event header.
+static wiced_bt_mesh_hci_event_t *p_mesh_app_tagged_hci_event = NULL;
+static uint16_t                 mesh_app_tagged_tid;
+
+wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
 
 wiced_bt_mesh_core_config_model_t   mesh_element1_models[] =
 {
@@ -623,6 +981,13 @@ void mesh_app_init(wiced_bool_t is_provisioned)
     wiced_bt_mesh_core_adv_tx_power = 0;
 #endif
 
+    // Two front-ends processing the same command is a build error, do not start with broken tables
+    if (!mesh_app_hci_cmd_index_init())
+    {
+        WICED_BT_TRACE("hci cmd index invalid, init aborted\n");
+        return;
+    }
+
     wiced_bt_cfg_settings.device_name = (uint8_t *)"Provisioner Client";
     wiced_bt_cfg_settings.gatt_cfg.appearance = APPEARANCE_GENERIC_TAG;
     // Adv Data is fixed. Spec allows to put URI, Name, Appearance and Tx Power in the Scan Response Data.
@@ -725,14 +1090,14 @@ wiced_bt_mesh_event_t *p_out_event = NULL;
 
 wiced_bool_t mesh_model_raw_data_message_handler(wiced_bt_mesh_event_t *p_event, const uint8_t *params, uint16_t params_len)
 {
-    wiced_bt_mesh_hci_event_t *p_hci_event = wiced_bt_mesh_create_hci_event(p_event);
+    wiced_bt_mesh_hci_event_t *p_hci_event = mesh_app_create_hci_event(p_event);
     uint8_t *p = p_hci_event->data;
     if (p_hci_event == NULL)
     {
         WICED_BT_TRACE("model raw data no mem\n");
         return WICED_FALSE;
     }
-    WICED_BT_TRACE("model raw data opcode:%04x\n", p_event->opcode);
+    MESH_BIN_TRACE(PROVISION, MESH_BIN_TRACE_LEVEL_INFO, MESH_BIN_TRACE_ID_RAW_MODEL_DATA, p_event->src, p_event->company_id, p_event->opcode);
 
 #ifdef PTS
     // If we are still retransmitting cancel transmit
@@ -755,7 +1120,7 @@ wiced_bool_t mesh_model_raw_data_message_handler(wiced_bt_mesh_event_t *p_event,
     memcpy(p, params, params_len);
     p += params_len;
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_RAW_MODEL_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_RAW_MODEL_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
     wiced_bt_mesh_release_event(p_event);
     return WICED_TRUE;
 }
@@ -765,7 +1130,33 @@ wiced_bool_t mesh_model_raw_data_message_handler(wiced_bt_mesh_event_t *p_event,
  */
 void mesh_config_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
 {
-    wiced_bt_mesh_hci_event_t *p_hci_event = wiced_bt_mesh_create_hci_event(p_event);
+    wiced_bt_mesh_hci_event_t *p_hci_event;
+
+    mesh_app_provision_phase_event(event, p_event, p_data);
+    mesh_app_composition_cache_event(event, p_event, p_data);
+    mesh_app_composition_index_event(event, p_event, p_data);
+
+    // Provisioning of the devices of the batch is not reported step by step, the subscription
+    // change and the key refresh on the list of nodes are reported in their own events, and
+    // the configuration of the new nodes with the recipe is not reported at all
+    if (mesh_app_config_recipe_event(event, p_event, p_data) || mesh_app_provision_batch_event(event, p_event, p_data) ||
+        mesh_app_config_subscription_event(event, p_event, p_data) || mesh_app_key_refresh_event(event, p_event, p_data))
+    {
+        wiced_bt_mesh_release_event(p_event);
+        return;
+    }
+#if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
+    // Fragments of the record retrieved by the application are sent in record data events
+    if (mesh_app_provision_record_event(event, p_event, p_data))
+    {
+        wiced_bt_mesh_release_event(p_event);
+        return;
+    }
+#endif
+    // Status of the command sent by the request engine is also sent to the MCU
+    mesh_app_config_request_event(event, p_event, p_data);
+
+    p_hci_event = mesh_app_create_hci_event(p_event);
     if (p_hci_event == NULL)
     {
         WICED_BT_TRACE("config clt no mem event:%d\n", event);
@@ -777,7 +1168,7 @@ void mesh_config_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p
     {
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
-        wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        mesh_app_send_hci_tx_complete(p_hci_event, p_event);
         break;
 
 #if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
@@ -1086,807 +1477,525 @@ void mesh_config_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p
 
 
 /*
- * In 2 chip solutions MCU can send commands to change provisioner state.
+ * Add HCI command to the index. Returns WICED_FALSE if another entry already processes the command.
  */
-uint32_t mesh_app_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length)
+static wiced_bool_t mesh_app_hci_cmd_index_add(uint16_t opcode, uint8_t index)
 {
-    wiced_bt_mesh_event_t *p_event = NULL;
-    uint8_t status = HCI_CONTROL_MESH_STATUS_SUCCESS;
-
-    WICED_BT_TRACE("%s opcode:%x\n", __FUNCTION__, opcode);
-
-    if (
-        mesh_default_transition_time_proc_rx_cmd(opcode, p_data, length) ||
-#ifdef WICED_BT_MESH_MODEL_PROPERTY_CLIENT_INCLUDED
-       mesh_property_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_BATTERY_CLIENT_INCLUDED
-       mesh_battery_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LIGHT_LC_CLIENT_INCLUDED
-       mesh_light_lc_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LIGHT_XYL_CLIENT_INCLUDED
-       mesh_light_xyl_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LOCATION_CLIENT_INCLUDED
-       mesh_location_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_POWER_LEVEL_CLIENT_INCLUDED
-       mesh_power_level_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_POWER_ONOFF_CLIENT_INCLUDED
-       mesh_power_onoff_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_SCHEDULER_CLIENT_INCLUDED
-        mesh_scheduler_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_TIME_CLIENT_INCLUDED
-        mesh_time_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_ONOFF_CLIENT_INCLUDED
-        mesh_onoff_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LEVEL_CLIENT_INCLUDED
-        mesh_level_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LIGHT_LIGHTNESS_CLIENT_INCLUDED
-        mesh_light_lightness_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LIGHT_HSL_CLIENT_INCLUDED
-        mesh_light_hsl_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_LIGHT_CTL_CLIENT_INCLUDED
-        mesh_light_ctl_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_SENSOR_CLIENT_INCLUDED
-        mesh_sensor_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-#ifdef WICED_BT_MESH_MODEL_SCENE_CLIENT_INCLUDED
-        mesh_scene_client_proc_rx_cmd(opcode, p_data, length) ||
-#endif
-        mesh_vendor_client_proc_rx_cmd(opcode, p_data, length))
-        return WICED_TRUE;
-
-    switch (opcode)
+    if ((opcode >> 8) != HCI_CONTROL_GROUP_MESH)
     {
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_ADD:
-        status = mesh_provisioner_process_add_vendor_model(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_SET_LOCAL_DEVICE:
-        status = mesh_provisioner_process_set_local_device(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_SET_DEVICE_KEY:
-        status = mesh_provisioner_process_set_dev_key(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_SEARCH_PROXY:
-        status = mesh_provisioner_process_search_proxy(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_PROXY_CONNECT:
-        status = mesh_provisioner_process_proxy_connect(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_PROXY_DISCONNECT:
-        status = mesh_provisioner_process_proxy_disconnect(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_SET_ADV_TX_POWER:
-        status = mesh_provisioner_process_set_adv_tx_power(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        break;
-
-#ifdef PRIVATE_PROXY_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_SEND_SOLICITATION_PDU:
-        status = mesh_provisioner_send_solicitation_pdu(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-#endif
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_CAPABILITIES_GET:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_GET:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_START:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_STOP:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_EXTENDED_START:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_CONNECT:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_DISCONNECT:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_START:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_OOB_VALUE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_RESET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_COMPOSITION_DATA_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_SET:
-#ifdef DIRECTED_FORWARDING_SERVER_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ADD:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DELETE:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_ADD:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_DELETE:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_COUNT_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PATHS_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_SET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_GET:
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_SET:
-#endif
-#ifdef NETWORK_FILTER_SERVER_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_GET:
-    case HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_SET:
-#endif
-#ifdef LARGE_COMPOSITION_DATA_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_LARGE_COMPOS_DATA_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODELS_METADATA_GET:
-#endif
-#ifdef SAR_CONFIGURATION_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_SET:
-#endif
-#ifdef PRIVATE_PROXY_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_SET:
-    case HCI_CONTROL_MESH_COMMAND_SOLICITATION_PDU_RPL_ITEMS_CLEAR:
-#endif
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_ADD:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_OVERWRITE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE_ALL:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_ADD:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_DELETE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_UPDATE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_ADD:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_DELETE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_UPDATE:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_UNBIND:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_GET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_SET:
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_LPN_POLL_TIMEOUT_GET:
-    case HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA:
-#if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SEND_INVITE:
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_RETRIEVE_RECORD:
-#endif
-        p_event = wiced_bt_mesh_create_event_from_wiced_hci(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &p_data, &length);
-        if (p_event == NULL)
-        {
-            WICED_BT_TRACE("bad hdr\n");
-            return WICED_FALSE;
-        }
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_TYPE_SET:
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_ADD:
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_DELETE:
-        p_event = wiced_bt_mesh_create_event_from_wiced_hci(opcode, MESH_COMPANY_ID_UNUSED, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, &p_data, &length);
-        if (p_event == NULL)
-        {
-            WICED_BT_TRACE("bad hdr\n");
-            return WICED_FALSE;
-        }
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_GET:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_CLEAR:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_TEST:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_GET:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_SET:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_GET:
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_SET:
-        p_event = wiced_bt_mesh_create_event_from_wiced_hci(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_HEALTH_CLNT, &p_data, &length);
-        if (p_event == NULL)
-        {
-            WICED_BT_TRACE("bad hdr\n");
-            return WICED_FALSE;
-        }
-        break;
-
-#ifdef OPCODES_AGGREGATOR_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_OPCODES_AGGREGATOR_START:
-        status = mesh_provisioner_process_aggregator_start(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-
-    case HCI_CONTROL_MESH_COMMAND_OPCODES_AGGREGATOR_FINISH:
-        status = mesh_provisioner_process_aggregator_finish(p_data, length);
-        mesh_provisioner_hci_send_status(status);
-        return WICED_TRUE;
-#endif
-
-#ifdef MESH_DFU_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_START:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_DATA:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_FINISH:
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_FW_UPDATE_METADATA_CHECK:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_START:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_SUSPEND:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_RESUME:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_STOP:
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_GET_STATUS:
-        p_event = wiced_bt_mesh_create_event_from_wiced_hci(opcode, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_FW_DISTRIBUTION_CLNT, &p_data, &length);
-        if (p_event == NULL)
-        {
-            WICED_BT_TRACE("bad hdr\n");
-            return WICED_FALSE;
-        }
-        break;
-#endif
-
-    default:
-        WICED_BT_TRACE("bad hdr\n");
+        WICED_BT_TRACE("hci cmd %04x entry %d not in mesh group\n", opcode, index);
         return WICED_FALSE;
     }
-
-    switch (opcode)
+    if (mesh_app_hci_cmd_index[(uint8_t)opcode] != 0)
     {
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_CAPABILITIES_GET:
-        status = mesh_provisioner_process_scan_capabilities_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_GET:
-        status = mesh_provisioner_process_scan_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_START:
-        status = mesh_provisioner_process_scan_start(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_STOP:
-        status = mesh_provisioner_process_scan_stop(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SCAN_EXTENDED_START:
-        status = mesh_provisioner_process_extended_scan_start(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_CONNECT:
-        status = mesh_provisioner_process_connect(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_DISCONNECT:
-        status = mesh_provisioner_process_disconnect(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_START:
-        status = mesh_provisioner_process_start(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_OOB_VALUE:
-        status = mesh_provisioner_process_oob_value(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_RESET:
-        status = mesh_provisioner_process_node_reset(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_GET:
-        status = mesh_provisioner_process_beacon_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_BEACON_SET:
-        status = mesh_provisioner_process_beacon_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_COMPOSITION_DATA_GET:
-        status = mesh_provisioner_process_composition_data_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_GET:
-        status = mesh_provisioner_process_default_ttl_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_DEFAULT_TTL_SET:
-        status = mesh_provisioner_process_default_ttl_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_GET:
-        status = mesh_provisioner_process_gatt_proxy_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_GATT_PROXY_SET:
-        status = mesh_provisioner_process_gatt_proxy_set(p_event, p_data, length);
-        break;
-
-#ifdef DIRECTED_FORWARDING_SERVER_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_GET:
-        status = mesh_provisioner_process_df_directed_control_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_SET:
-        status = mesh_provisioner_process_df_directed_control_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_GET:
-        status = mesh_provisioner_process_df_path_metric_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_METRIC_SET:
-        status = mesh_provisioner_process_df_path_metric_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_GET:
-        status = mesh_provisioner_process_df_discovery_table_capabilities_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DISCOVERY_TABLE_CAPABILITIES_SET:
-        status = mesh_provisioner_process_df_discovery_table_capabilities_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ADD:
-        status = mesh_provisioner_process_df_forwarding_table_add(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DELETE:
-        status = mesh_provisioner_process_df_forwarding_table_delete(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_ADD:
-        status = mesh_provisioner_process_df_forwarding_table_dependents_add(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_DELETE:
-        status = mesh_provisioner_process_df_forwarding_table_dependents_delete(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_DEPENDENTS_GET:
-        status = mesh_provisioner_process_df_forwarding_table_dependents_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_COUNT_GET:
-        status = mesh_provisioner_process_df_forwarding_table_entries_count_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_FORWARDING_TABLE_ENTRIES_GET:
-        status = mesh_provisioner_process_df_forwarding_table_entries_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_GET:
-        status = mesh_provisioner_process_df_wanted_lanes_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_WANTED_LANES_SET:
-        status = mesh_provisioner_process_df_wanted_lanes_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_GET:
-        status = mesh_provisioner_process_df_two_way_path_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_TWO_WAY_PATH_SET:
-        status = mesh_provisioner_process_df_two_way_path_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_GET:
-        status = mesh_provisioner_process_df_path_echo_interval_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_ECHO_INTERVAL_SET:
-        status = mesh_provisioner_process_df_path_echo_interval_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_GET:
-        status = mesh_provisioner_process_df_directed_network_transmit_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_NETWORK_TRANSMIT_SET:
-        status = mesh_provisioner_process_df_directed_network_transmit_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_GET:
-        status = mesh_provisioner_process_df_directed_relay_retransmit_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_RELAY_RETRANSMIT_SET:
-        status = mesh_provisioner_process_df_directed_relay_retransmit_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_GET:
-        status = mesh_provisioner_process_df_rssi_threshold_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_RSSI_THRESHOLD_SET:
-        status = mesh_provisioner_process_df_rssi_threshold_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PATHS_GET:
-        status = mesh_provisioner_process_df_directed_paths_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_GET:
-        status = mesh_provisioner_process_df_directed_publish_policy_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_PUBLISH_POLICY_SET:
-        status = mesh_provisioner_process_df_directed_publish_policy_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_GET:
-        status = mesh_provisioner_process_df_path_discovery_timing_control_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_PATH_DISCOVERY_TIMING_CONTROL_SET:
-        status = mesh_provisioner_process_df_path_discovery_timing_control_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_GET:
-        status = mesh_provisioner_process_df_directed_control_network_transmit_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_SET:
-        status = mesh_provisioner_process_df_directed_control_network_transmit_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_GET:
-        status = mesh_provisioner_process_df_directed_control_relay_retransmit_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_SET:
-        status = mesh_provisioner_process_df_directed_control_relay_retransmit_set(p_event, p_data, length);
-        break;
-
-#endif
-#ifdef NETWORK_FILTER_SERVER_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_GET:
-        status = mesh_provisioner_process_network_filter_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_NETWORK_FILTER_SET:
-        status = mesh_provisioner_process_network_filter_set(p_event, p_data, length);
-        break;
-#endif
-#ifdef LARGE_COMPOSITION_DATA_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_LARGE_COMPOS_DATA_GET:
-        status = mesh_provisioner_process_large_compos_data_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODELS_METADATA_GET:
-        status = mesh_provisioner_process_models_metadata_get(p_event, p_data, length);
-        break;
-#endif
-#ifdef SAR_CONFIGURATION_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_GET:
-        status = mesh_provisioner_process_sar_transmitter_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_TRANSMITTER_SET:
-        status = mesh_provisioner_process_sar_transmitter_set(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_GET:
-        status = mesh_provisioner_process_sar_receiver_get(p_event, p_data, length);
-        break;
-
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_SAR_RECEIVER_SET:
-        status = mesh_provisioner_process_sar_receiver_set(p_event, p_data, length);
-        break;
-#endif
-#ifdef PRIVATE_PROXY_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_GET:
-        status = mesh_provisioner_process_private_beacon_get(p_event, p_data, length);
-        break;
+        WICED_BT_TRACE("hci cmd %04x entry %d already processed by entry %d\n", opcode, index, mesh_app_hci_cmd_index[(uint8_t)opcode]);
+        return WICED_FALSE;
+    }
+    mesh_app_hci_cmd_index[(uint8_t)opcode] = index;
+    return WICED_TRUE;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_BEACON_SET:
-        status = mesh_provisioner_process_private_beacon_set(p_event, p_data, length);
-        break;
+/*
+ * Build the index of the HCI commands from the tables of the model client front-ends and of
+ * the provisioner. Returns WICED_FALSE if two entries process the same command. The index is
+ * left empty in that case, so that all commands are rejected instead of some of them being sent
+ * to the wrong handler, and mesh_app_init stops there.
+ */
+wiced_bool_t mesh_app_hci_cmd_index_init(void)
+{
+    wiced_bool_t valid = WICED_TRUE;
+    uint8_t i, j;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_GET:
-        status = mesh_provisioner_process_private_gatt_proxy_get(p_event, p_data, length);
-        break;
+    memset(mesh_app_hci_cmd_index, 0, sizeof(mesh_app_hci_cmd_index));
+    for (i = 0; i < MESH_APP_NUM_HCI_CMD_HANDLERS; i++)
+    {
+        for (j = 0; j < mesh_app_hci_cmd_handlers[i]->num_opcodes; j++)
+            valid &= mesh_app_hci_cmd_index_add(mesh_app_hci_cmd_handlers[i]->p_opcodes[j], i + 1);
+    }
+    for (i = 0; i < MESH_PROVISIONER_NUM_HCI_CMDS; i++)
+        valid &= mesh_app_hci_cmd_index_add(mesh_provisioner_hci_cmds[i].opcode, MESH_APP_NUM_HCI_CMD_HANDLERS + 1 + i);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_GATT_PROXY_SET:
-        status = mesh_provisioner_process_private_gatt_proxy_set(p_event, p_data, length);
-        break;
+    if (!valid)
+        memset(mesh_app_hci_cmd_index, 0, sizeof(mesh_app_hci_cmd_index));
+    return valid;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_GET:
-        status = mesh_provisioner_process_private_node_identity_get(p_event, p_data, length);
-        break;
+/*
+ * Find the entry which processes the HCI command. All commands belong to the same group,
+ * so the low byte of the opcode is used as the index.
+ */
+uint8_t mesh_app_hci_cmd_index_get(uint16_t opcode)
+{
+    if ((opcode >> 8) != HCI_CONTROL_GROUP_MESH)
+        return 0;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_PRIVATE_NODE_IDENTITY_SET:
-        status = mesh_provisioner_process_private_node_identity_set(p_event, p_data, length);
-        break;
+    return mesh_app_hci_cmd_index[(uint8_t)opcode];
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_GET:
-        status = mesh_provisioner_process_on_demand_private_proxy_get(p_event, p_data, length);
-        break;
+/*
+ * Decode the command payload into the destination structure. The length is checked once for
+ * the whole layout, then each integer field is read from the payload and stored in its member
+ * with the size of the member.
+ */
+uint8_t mesh_app_hci_decode(const mesh_app_hci_layout_t *p_layout, uint8_t *p_data, uint32_t length, void *p_dst)
+{
+    const mesh_app_hci_field_t *p_field;
+    uint32_t layout_len = 0;
+    uint64_t value;
+    uint32_t u32;
+    uint16_t u16;
+    uint8_t  u8;
+    uint8_t  *p_member;
+    uint8_t  i;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_ON_DEMAND_PRIVATE_PROXY_SET:
-        status = mesh_provisioner_process_on_demand_private_proxy_set(p_event, p_data, length);
-        break;
+    for (i = 0; i < p_layout->num_fields; i++)
+        layout_len += p_layout->p_fields[i].len;
 
-    case HCI_CONTROL_MESH_COMMAND_SOLICITATION_PDU_RPL_ITEMS_CLEAR:
-        status = mesh_provisioner_process_solicitation_pdu_rpl_items_clear(p_event, p_data, length);
-        break;
-#endif
+    if (length < layout_len)
+    {
+        WICED_BT_TRACE("bad len:%d expected:%d\n", length, layout_len);
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+    }
+    memset(p_dst, 0, p_layout->size);
+    for (i = 0, p_field = p_layout->p_fields; i < p_layout->num_fields; i++, p_field++)
+    {
+        p_member = (uint8_t *)p_dst + p_field->offset;
+        if (p_field->size == 0)
+        {
+            STREAM_TO_ARRAY(p_member, p_data, p_field->len);
+            continue;
+        }
+        switch (p_field->len)
+        {
+        case 1:
+            STREAM_TO_UINT8(u8, p_data);
+            value = u8;
+            break;
+        case 2:
+            STREAM_TO_UINT16(u16, p_data);
+            value = u16;
+            break;
+        case 3:
+            STREAM_TO_UINT24(u32, p_data);
+            value = u32;
+            break;
+        case 4:
+            STREAM_TO_UINT32(u32, p_data);
+            value = u32;
+            break;
+        default:
+            STREAM_TO_UINT40(value, p_data);
+            break;
+        }
+        // Members of packed structures may be unaligned
+        switch (p_field->size)
+        {
+        case 1:
+            u8 = (uint8_t)value;
+            memcpy(p_member, &u8, sizeof(u8));
+            break;
+        case 2:
+            u16 = (uint16_t)value;
+            memcpy(p_member, &u16, sizeof(u16));
+            break;
+        case 4:
+            u32 = (uint32_t)value;
+            memcpy(p_member, &u32, sizeof(u32));
+            break;
+        default:
+            memcpy(p_member, &value, sizeof(value));
+            break;
+        }
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_GET:
-        status = mesh_provisioner_process_relay_get(p_event, p_data, length);
-        break;
+/*
+ * Check the command payload length for the model client front-ends, which decode the payload
+ * with the STREAM macros and do not send the command status on success.
+ */
+wiced_bool_t mesh_app_hci_length_check(wiced_bt_mesh_event_t *p_event, uint32_t length, uint32_t min_length)
+{
+    if (length >= min_length)
+        return WICED_TRUE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_RELAY_SET:
-        status = mesh_provisioner_process_relay_set(p_event, p_data, length);
-        break;
+    wiced_bt_mesh_release_event(p_event);
+    mesh_provisioner_hci_send_status(HCI_CONTROL_MESH_STATUS_INVALID_LENGTH);
+    return WICED_FALSE;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_GET:
-        status = mesh_provisioner_process_friend_get(p_event, p_data, length);
-        break;
+/*
+ * In 2 chip solutions MCU can send commands to change provisioner state.
+ */
+uint32_t mesh_app_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t length)
+{
+    const mesh_provisioner_hci_cmd_t *p_cmd;
+    wiced_bt_mesh_event_t *p_event;
+    uint32_t result = WICED_TRUE;
+    uint8_t index;
+    uint8_t status;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_FRIEND_SET:
-        status = mesh_provisioner_process_friend_set(p_event, p_data, length);
-        break;
+    MESH_BIN_TRACE(PROVISION, MESH_BIN_TRACE_LEVEL_INFO, MESH_BIN_TRACE_ID_PROC_RX_CMD, opcode, length, 0);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_GET:
-        status = mesh_provisioner_process_key_refresh_phase_get(p_event, p_data, length);
-        break;
+    if (opcode == HCI_CONTROL_MESH_COMMAND_BATCH)
+        return mesh_app_process_batch(p_data, length);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_KEY_REFRESH_PHASE_SET:
-        status = mesh_provisioner_process_key_refresh_phase_set(p_event, p_data, length);
-        break;
+    if (opcode == HCI_CONTROL_MESH_COMMAND_TRANSACTION)
+        return mesh_app_process_transaction(p_data, length);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_GET:
-        status = mesh_provisioner_process_node_identity_get(p_event, p_data, length);
-        break;
+    index = mesh_app_hci_cmd_index_get(opcode);
+    if (index == 0)
+    {
+        WICED_BT_TRACE("bad hdr\n");
+        return WICED_FALSE;
+    }
+    p_mesh_app_transaction_pending = mesh_app_transaction_add(opcode, index, p_data, length);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NODE_IDENTITY_SET:
-        status = mesh_provisioner_process_node_identity_set(p_event, p_data, length);
-        break;
+    if (index <= MESH_APP_NUM_HCI_CMD_HANDLERS)
+    {
+        result = mesh_app_hci_cmd_handlers[index - 1]->proc_rx_cmd(opcode, p_data, length);
+    }
+    else
+    {
+        p_cmd = &mesh_provisioner_hci_cmds[index - MESH_APP_NUM_HCI_CMD_HANDLERS - 1];
+        if (p_cmd->p_cmd_handler != NULL)
+        {
+            status = (length < p_cmd->min_length) ? HCI_CONTROL_MESH_STATUS_INVALID_LENGTH : p_cmd->p_cmd_handler(p_data, length);
+            mesh_provisioner_hci_send_status(status);
+        }
+        else if ((p_event = wiced_bt_mesh_create_event_from_wiced_hci(opcode, p_cmd->company_id, p_cmd->model_id, &p_data, &length)) == NULL)
+        {
+            WICED_BT_TRACE("bad hdr\n");
+            result = WICED_FALSE;
+        }
+        else
+        {
+            if (length < p_cmd->min_length)
+            {
+                wiced_bt_mesh_release_event(p_event);
+                status = HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+            }
+            else if (p_cmd->p_change_cmd_handler != NULL)
+                status = p_cmd->p_change_cmd_handler(p_event, p_cmd->operation, p_data, length);
+            else
+                status = p_cmd->p_event_cmd_handler(p_event, p_data, length);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_GET:
-        status = mesh_provisioner_process_model_publication_get(p_event, p_data, length);
-        break;
+            mesh_provisioner_hci_send_status(status);
+        }
+    }
+    // Peer will not reply to the command which has not been sent
+    if (!result && (p_mesh_app_transaction_pending != NULL))
+        p_mesh_app_transaction_pending->in_use = WICED_FALSE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_PUBLICATION_SET:
-        status = mesh_provisioner_process_model_publication_set(p_event, p_data, length);
-        break;
+    p_mesh_app_transaction_pending = NULL;
+    return result;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_ADD:
-        status = mesh_provisioner_process_model_subscription_change(p_event, OPERATION_ADD, p_data, length);
-        break;
+/*
+ * Process batch of commands from MCU. Each command in the batch is preceded by its length
+ * (opcode and payload) and opcode. Commands are executed in order and instead of a command
+ * status for each, one batch status with the status of each executed command is sent.
+ */
+uint32_t mesh_app_process_batch(uint8_t *p_data, uint32_t length)
+{
+    uint8_t  status[MESH_APP_BATCH_MAX_CMDS];
+    uint8_t  num_cmds = 0;
+    uint16_t cmd_len;
+    uint16_t cmd_opcode;
+    uint32_t payload_len;
+    uint8_t  *p_buffer;
+    uint8_t  *p;
+
+    mesh_app_batch_active = WICED_TRUE;
+    while ((length >= MESH_APP_BATCH_CMD_HDR_LEN) && (num_cmds < MESH_APP_BATCH_MAX_CMDS))
+    {
+        STREAM_TO_UINT16(cmd_len, p_data);
+        STREAM_TO_UINT16(cmd_opcode, p_data);
+        length -= MESH_APP_BATCH_CMD_HDR_LEN;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE:
-        status = mesh_provisioner_process_model_subscription_change(p_event, OPERATION_DELETE, p_data, length);
-        break;
+        // Length covers the opcode, which is already read. The header is consumed first and the
+        // payload length compared as unsigned, so neither side of the comparison can wrap.
+        if ((cmd_len < 2) || ((uint32_t)cmd_len - 2 > length))
+        {
+            WICED_BT_TRACE("batch bad len:%d cmd:%d\n", cmd_len, num_cmds);
+            break;
+        }
+        payload_len = (uint32_t)cmd_len - 2;
+        length -= payload_len;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_OVERWRITE:
-        status = mesh_provisioner_process_model_subscription_change(p_event, OPERATION_OVERWRITE, p_data, length);
-        break;
+        // Commands processed by the model clients do not send the command status
+        mesh_app_batch_cmd_status = HCI_CONTROL_MESH_STATUS_SUCCESS;
+        if ((cmd_opcode == HCI_CONTROL_MESH_COMMAND_BATCH) || !mesh_app_proc_rx_cmd(cmd_opcode, p_data, payload_len))
+            mesh_app_batch_cmd_status = HCI_CONTROL_MESH_STATUS_ERROR;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_DELETE_ALL:
-        status = mesh_provisioner_process_model_subscription_change(p_event, OPERATION_DELETE_ALL, p_data, length);
-        break;
+        status[num_cmds++] = mesh_app_batch_cmd_status;
+        p_data += payload_len;
+    }
+    mesh_app_batch_active = WICED_FALSE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_SUBSCRIPTION_GET:
-        status = mesh_provisioner_process_model_subscription_get(p_event, p_data, length);
-        break;
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return WICED_TRUE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_ADD:
-        status = mesh_provisioner_process_netkey_change(p_event, OPERATION_ADD, p_data, length);
-        break;
+    p = p_buffer;
+    UINT8_TO_STREAM(p, num_cmds);
+    ARRAY_TO_STREAM(p, status, num_cmds);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_DELETE:
-        status = mesh_provisioner_process_netkey_change(p_event, OPERATION_DELETE, p_data, length);
-        break;
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_BATCH_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+    return WICED_TRUE;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_UPDATE:
-        status = mesh_provisioner_process_netkey_change(p_event, OPERATION_OVERWRITE, p_data, length);
-        break;
+/*
+ * Save the command so that the reply from the peer can be matched to it for the latency statistics
+ * and, in a transaction, tagged with the transaction ID. Commands executed locally do not have
+ * a reply, and replies to a group, virtual or broadcast address come from any number of nodes
+ * and cannot be matched. If all entries of the table are used, the oldest is dropped.
+ */
+mesh_app_transaction_t *mesh_app_transaction_add(uint16_t opcode, uint8_t index, uint8_t *p_data, uint32_t length)
+{
+    mesh_app_transaction_t *p_table = mesh_app_transaction_active ? mesh_app_transactions : mesh_app_untagged_cmds;
+    uint8_t table_size = mesh_app_transaction_active ? MESH_APP_MAX_TRANSACTIONS : MESH_APP_MAX_UNTAGGED_CMDS;
+    mesh_app_transaction_t *p_transaction = &p_table[0];
+    uint16_t dst;
+    uint16_t company_id = MESH_COMPANY_ID_BT_SIG;
+    uint16_t model_id;
+    uint8_t  i;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NET_KEY_GET:
-        status = mesh_provisioner_process_netkey_get(p_event, p_data, length);
-        break;
+    if (length < 2)
+        return NULL;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_ADD:
-        status = mesh_provisioner_process_appkey_change(p_event, OPERATION_ADD, p_data, length);
-        break;
+    dst = p_data[0] + (p_data[1] << 8);
+    if ((dst == 0) || (dst & 0x8000))
+        return NULL;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_DELETE:
-        status = mesh_provisioner_process_appkey_change(p_event, OPERATION_DELETE, p_data, length);
-        break;
+    if (index <= MESH_APP_NUM_HCI_CMD_HANDLERS)
+    {
+        model_id = mesh_app_hci_cmd_handlers[index - 1]->model_id;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_UPDATE:
-        status = mesh_provisioner_process_appkey_change(p_event, OPERATION_OVERWRITE, p_data, length);
-        break;
+        // Model of the vendor data is in the command after the event header
+        if (model_id == MESH_APP_HCI_CMD_MODEL_IN_CMD)
+        {
+            if (length < MESH_APP_HCI_EVENT_HDR_LEN + 4)
+                return NULL;
+            company_id = p_data[MESH_APP_HCI_EVENT_HDR_LEN] + (p_data[MESH_APP_HCI_EVENT_HDR_LEN + 1] << 8);
+            model_id   = p_data[MESH_APP_HCI_EVENT_HDR_LEN + 2] + (p_data[MESH_APP_HCI_EVENT_HDR_LEN + 3] << 8);
+        }
+    }
+    else if (mesh_provisioner_hci_cmds[index - MESH_APP_NUM_HCI_CMD_HANDLERS - 1].p_cmd_handler == NULL)
+    {
+        company_id = mesh_provisioner_hci_cmds[index - MESH_APP_NUM_HCI_CMD_HANDLERS - 1].company_id;
+        model_id   = mesh_provisioner_hci_cmds[index - MESH_APP_NUM_HCI_CMD_HANDLERS - 1].model_id;
+    }
+    else
+        return NULL;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_APP_KEY_GET:
-        status = mesh_provisioner_process_appkey_get(p_event, p_data, length);
-        break;
+    for (i = 0; i < table_size; i++)
+    {
+        if (!p_table[i].in_use)
+        {
+            p_transaction = &p_table[i];
+            break;
+        }
+        if (p_table[i].seq < p_transaction->seq)
+            p_transaction = &p_table[i];
+    }
+    if (p_transaction->in_use && mesh_app_transaction_active)
+        WICED_BT_TRACE("transaction %04x dropped\n", p_transaction->tid);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_BIND:
-        status = mesh_provisioner_process_model_app_change(p_event, OPERATION_ADD, p_data, length);
-        break;
+    p_transaction->in_use        = WICED_TRUE;
+    p_transaction->tid           = mesh_app_transaction_id;
+    p_transaction->dst           = dst;
+    p_transaction->company_id    = company_id;
+    p_transaction->model_id      = model_id;
+    p_transaction->opcode        = opcode;
+    p_transaction->seq           = mesh_app_transaction_seq++;
+    p_transaction->timestamp     = wiced_bt_mesh_core_get_tick_count();
+    return p_transaction;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_UNBIND:
-        status = mesh_provisioner_process_model_app_change(p_event, OPERATION_DELETE, p_data, length);
-        break;
+/*
+ * Process command from MCU tagged with the transaction ID. The command status and the first
+ * event received from the peer as a reply to the command carry the same transaction ID, so
+ * the MCU can have several commands in progress.
+ */
+uint32_t mesh_app_process_transaction(uint8_t *p_data, uint32_t length)
+{
+    uint16_t tid;
+    uint16_t cmd_opcode;
+    uint32_t result;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_MODEL_APP_GET:
-        status = mesh_provisioner_process_model_app_get(p_event, p_data, length);
-        break;
+    if ((length < MESH_APP_TRANSACTION_HDR_LEN) || mesh_app_transaction_active)
+        return WICED_FALSE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_GET:
-        status = mesh_provisioner_process_heartbeat_subscription_get(p_event, p_data, length);
-        break;
+    STREAM_TO_UINT16(tid, p_data);
+    STREAM_TO_UINT16(cmd_opcode, p_data);
+    length -= MESH_APP_TRANSACTION_HDR_LEN;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_SUBSCRIPTION_SET:
-        status = mesh_provisioner_process_heartbeat_subscription_set(p_event, p_data, length);
-        break;
+    if ((cmd_opcode == HCI_CONTROL_MESH_COMMAND_BATCH) || (cmd_opcode == HCI_CONTROL_MESH_COMMAND_TRANSACTION))
+        return WICED_FALSE;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_GET:
-        status = mesh_provisioner_process_heartbeat_publication_get(p_event, p_data, length);
-        break;
+    mesh_app_transaction_active = WICED_TRUE;
+    mesh_app_transaction_id     = tid;
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_HEARBEAT_PUBLICATION_SET:
-        status = mesh_provisioner_process_heartbeat_publication_set(p_event, p_data, length);
-        break;
+    result = mesh_app_proc_rx_cmd(cmd_opcode, p_data, length);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_GET:
-        status = mesh_provisioner_process_network_transmit_get(p_event, p_data, length);
-        break;
+    mesh_app_transaction_active = WICED_FALSE;
+    return result;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_NETWORK_TRANSMIT_SET:
-        status = mesh_provisioner_process_network_transmit_set(p_event, p_data, length);
-        break;
+/*
+ * Check that the command is sent to the peer by the config client
+ */
+wiced_bool_t mesh_app_config_cmd_check(uint16_t opcode)
+{
+    const mesh_provisioner_hci_cmd_t *p_cmd;
+    uint8_t index = mesh_app_hci_cmd_index_get(opcode);
 
-    case HCI_CONTROL_MESH_COMMAND_CONFIG_LPN_POLL_TIMEOUT_GET:
-        status = mesh_provisioner_process_lpn_poll_timeout_get(p_event, p_data, length);
-        break;
+    if (index <= MESH_APP_NUM_HCI_CMD_HANDLERS)
+        return WICED_FALSE;
 
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_TYPE_SET:
-        status = mesh_provisioner_process_proxy_filter_type_set(p_event, p_data, length);
-        break;
+    p_cmd = &mesh_provisioner_hci_cmds[index - MESH_APP_NUM_HCI_CMD_HANDLERS - 1];
+    return (p_cmd->p_cmd_handler == NULL) && (p_cmd->model_id == WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT);
+}
 
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_ADD:
-    case HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_DELETE:
-        status = mesh_provisioner_process_proxy_filter_change(p_event, opcode == HCI_CONTROL_MESH_COMMAND_PROXY_FILTER_ADDRESSES_ADD, p_data, length);
-        break;
+/*
+ * Execute the config client command on behalf of the application. As in a batch, the command
+ * status is returned instead of being sent to the MCU.
+ */
+uint8_t mesh_app_config_cmd_execute(uint16_t opcode, uint8_t *p_data, uint32_t length)
+{
+    wiced_bool_t batch_active       = mesh_app_batch_active;
+    wiced_bool_t transaction_active = mesh_app_transaction_active;
+    uint8_t      batch_cmd_status   = mesh_app_batch_cmd_status;
+    uint8_t      status;
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_GET:
-        status = mesh_provisioner_process_health_fault_get(p_event, p_data, length);
-        break;
+    if (!mesh_app_config_cmd_check(opcode))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_CLEAR:
-        status = mesh_provisioner_process_health_fault_clear(p_event, p_data, length);
-        break;
+    mesh_app_batch_active       = WICED_TRUE;
+    mesh_app_transaction_active = WICED_FALSE;
+    mesh_app_batch_cmd_status   = HCI_CONTROL_MESH_STATUS_SUCCESS;
+    if (!mesh_app_proc_rx_cmd(opcode, p_data, length))
+        mesh_app_batch_cmd_status = HCI_CONTROL_MESH_STATUS_ERROR;
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_FAULT_TEST:
-        status = mesh_provisioner_process_health_fault_test(p_event, p_data, length);
-        break;
+    status = mesh_app_batch_cmd_status;
+    mesh_app_batch_active       = batch_active;
+    mesh_app_transaction_active = transaction_active;
+    mesh_app_batch_cmd_status   = batch_cmd_status;
+    return status;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_GET:
-        status = mesh_provisioner_process_health_period_get(p_event, p_data, length);
-        break;
+/*
+ * Find the oldest command of the table sent to the event source for the same model. Commands
+ * which did not get the reply in time are dropped.
+ */
+mesh_app_transaction_t *mesh_app_transaction_find(mesh_app_transaction_t *p_table, uint8_t table_size, wiced_bt_mesh_event_t *p_event, uint64_t now)
+{
+    mesh_app_transaction_t *p_transaction = NULL;
+    uint8_t i;
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_PERIOD_SET:
-        status = mesh_provisioner_process_health_period_set(p_event, p_data, length);
-        break;
+    for (i = 0; i < table_size; i++)
+    {
+        if (!p_table[i].in_use)
+            continue;
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_GET:
-        status = mesh_provisioner_process_health_attention_get(p_event, p_data, length);
-        break;
+        if (now - p_table[i].timestamp > MESH_APP_TRANSACTION_TIMEOUT)
+        {
+            WICED_BT_TRACE("cmd to %04x timeout\n", p_table[i].dst);
+            p_table[i].in_use = WICED_FALSE;
+            continue;
+        }
+        if ((p_table[i].dst == p_event->src) && (p_table[i].company_id == p_event->company_id) && (p_table[i].model_id == p_event->model_id) &&
+            ((p_transaction == NULL) || (p_table[i].seq < p_transaction->seq)))
+            p_transaction = &p_table[i];
+    }
+    return p_transaction;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_HEALTH_ATTENTION_SET:
-        status = mesh_provisioner_process_health_attention_set(p_event, p_data, length);
-        break;
+/*
+ * If the event is a reply to a command, update the latency statistics. Returns the command if it
+ * has been received in a transaction. Commands received in a transaction are completed first,
+ * so the MCU which has tagged commands in progress to a model of a node should tag all commands
+ * to that model, otherwise the reply to the untagged command carries the transaction ID.
+ */
+mesh_app_transaction_t *mesh_app_transaction_event(wiced_bt_mesh_event_t *p_event)
+{
+    mesh_app_transaction_t *p_transaction;
+    uint64_t now = wiced_bt_mesh_core_get_tick_count();
+    wiced_bool_t tagged = WICED_TRUE;
 
-    case HCI_CONTROL_MESH_COMMAND_RAW_MODEL_DATA:
-        status = mesh_provisioner_process_raw_model_data(p_event, p_data, length);
-        break;
+    if ((p_transaction = mesh_app_transaction_find(mesh_app_transactions, MESH_APP_MAX_TRANSACTIONS, p_event, now)) == NULL)
+    {
+        if ((p_transaction = mesh_app_transaction_find(mesh_app_untagged_cmds, MESH_APP_MAX_UNTAGGED_CMDS, p_event, now)) == NULL)
+            return NULL;
+        tagged = WICED_FALSE;
+    }
+    p_transaction->in_use = WICED_FALSE;
+    mesh_app_latency_record(p_transaction->opcode, p_transaction->dst, (uint32_t)(now - p_transaction->timestamp));
 
-#if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_SEND_INVITE:
-        status = mesh_provisioner_process_send_invite(p_event,  p_data, length);
-        break;
-    case HCI_CONTROL_MESH_COMMAND_PROVISION_RETRIEVE_RECORD:
-        status = mesh_provisioner_process_record_get(p_event, p_data, length);
-        break;
-#endif
+    return tagged ? p_transaction : NULL;
+}
 
-#ifdef MESH_DFU_SUPPORTED
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_START:
-        status = mesh_provisioner_process_fw_upload_start(p_data, length);
-        break;
+/*
+ * Create HCI event for the event received from the peer. The event which replies to a command
+ * received in a transaction leaves room for the transaction ID and the opcode in front of the
+ * event header, see mesh_app_transaction_tag.
+ */
+wiced_bt_mesh_hci_event_t *mesh_app_create_hci_event(wiced_bt_mesh_event_t *p_event)
+{
+    mesh_app_transaction_t *p_transaction = mesh_app_transaction_event(p_event);
+    wiced_bt_mesh_hci_event_t *p_hci_event;
+    uint8_t *p_buffer;
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_DATA:
-        status = mesh_provisioner_process_fw_upload_data(p_data, length);
-        break;
+    if (p_transaction == NULL)
+        return wiced_bt_mesh_create_hci_event(p_event);
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_UPLOAD_FINISH:
-        status = mesh_provisioner_process_fw_upload_finish(p_data, length);
-        break;
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return NULL;
 
-    case HCI_CONTROL_MESH_COMMAND_FW_UPDATE_METADATA_CHECK:
-        status = mesh_provisioner_process_fw_update_metadata_check(p_event, p_data, length);
-        break;
+    p_hci_event = (wiced_bt_mesh_hci_event_t *)(p_buffer + MESH_APP_TRANSACTION_HDR_LEN);
+    p_hci_event->src         = p_event->src;
+    p_hci_event->app_key_idx = p_event->app_key_idx;
+    p_hci_event->element_idx = p_event->element_idx;
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_START:
-        status = mesh_provisioner_process_fw_distribution_start(p_event, p_data, length);
-        break;
+    p_mesh_app_tagged_hci_event = p_hci_event;
+    mesh_app_tagged_tid         = p_transaction->tid;
+    return p_hci_event;
+}
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_SUSPEND:
-        status = mesh_provisioner_process_fw_distribution_suspend(p_event, p_data, length);
-        break;
+/*
+ * Release the HCI event which is not sent to the MCU
+ */
+void mesh_app_free_hci_event(wiced_bt_mesh_hci_event_t *p_hci_event)
+{
+    if (p_hci_event == p_mesh_app_tagged_hci_event)
+    {
+        p_mesh_app_tagged_hci_event = NULL;
+        wiced_transport_free_buffer((uint8_t *)p_hci_event - MESH_APP_TRANSACTION_HDR_LEN);
+        return;
+    }
+    wiced_transport_free_buffer(p_hci_event);
+}
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_RESUME:
-        status = mesh_provisioner_process_fw_distribution_resume(p_event, p_data, length);
-        break;
+/*
+ * Add the transaction ID and the opcode of the event in front of the event which replies to
+ * a command received in a transaction. Other events are sent unchanged.
+ */
+uint8_t *mesh_app_transaction_tag(uint16_t *p_opcode, uint8_t *p_data, uint16_t *p_length)
+{
+    uint8_t *p;
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_STOP:
-        status = mesh_provisioner_process_fw_distribution_stop(p_event, p_data, length);
-        break;
+    if ((p_mesh_app_tagged_hci_event == NULL) || (p_data != (uint8_t *)p_mesh_app_tagged_hci_event))
+        return p_data;
 
-    case HCI_CONTROL_MESH_COMMAND_FW_DISTRIBUTION_GET_STATUS:
-        status = mesh_provisioner_process_fw_distribution_get_status(p_event, p_data, length);
-        break;
-#endif
+    p_mesh_app_tagged_hci_event = NULL;
+    p_data -= MESH_APP_TRANSACTION_HDR_LEN;
+    p = p_data;
+    UINT16_TO_STREAM(p, mesh_app_tagged_tid);
+    UINT16_TO_STREAM(p, *p_opcode);
 
-    default:
-        wiced_bt_mesh_release_event(p_event);
-        break;
-    }
-    mesh_provisioner_hci_send_status(status);
-    return WICED_TRUE;
+    *p_opcode  = HCI_CONTROL_MESH_EVENT_TRANSACTION;
+    *p_length += MESH_APP_TRANSACTION_HDR_LEN;
+    return p_data;
 }
 
 /*
@@ -1926,25 +2035,18 @@ uint8_t mesh_provisioner_process_raw_model_data(wiced_bt_mesh_event_t *p_event,
  */
 uint8_t mesh_provisioner_process_set_local_device(uint8_t *p_data, uint32_t length)
 {
-    wiced_bt_mesh_local_device_set_data_t set;
-    uint8_t model_level_access;
+    mesh_provisioner_local_device_set_cmd_t cmd;
 
-    STREAM_TO_UINT16(set.addr, p_data);
-    STREAM_TO_ARRAY(set.dev_key, p_data, 16);
-    STREAM_TO_ARRAY(set.network_key, p_data, 16);
-    STREAM_TO_UINT16(set.net_key_idx, p_data);
-    STREAM_TO_UINT32(set.iv_idx, p_data);
-    STREAM_TO_UINT8(set.key_refresh, p_data);
-    STREAM_TO_UINT8(set.iv_update, p_data);
-    STREAM_TO_UINT8(model_level_access, p_data);
+    if (mesh_app_hci_decode(&mesh_provisioner_local_device_set_layout, p_data, length, &cmd) != HCI_CONTROL_MESH_STATUS_SUCCESS)
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
 
-    WICED_BT_TRACE("addr:%x net_key_idx:%x iv_idx:%x key_refresh:%d iv_upd:%d model_access:%d\n", set.addr, set.net_key_idx, set.iv_idx, set.key_refresh, set.iv_update, model_level_access);
-    mesh_gatt_client_local_device_set(&set);
+    WICED_BT_TRACE("addr:%x net_key_idx:%x iv_idx:%x key_refresh:%d iv_upd:%d model_access:%d\n", cmd.set.addr, cmd.set.net_key_idx, cmd.set.iv_idx, cmd.set.key_refresh, cmd.set.iv_update, cmd.model_level_access);
+    mesh_gatt_client_local_device_set(&cmd.set);
     mesh_app_init(WICED_TRUE);
 
     // Application can register to receive all raw model messages.
     // if not, this application wants to process all vendor specific messages
-    if (model_level_access)
+    if (cmd.model_level_access)
     {
         extern wiced_bt_mesh_core_received_msg_handler_t p_app_model_message_handler;
         p_app_model_message_handler = mesh_model_raw_data_message_handler;
@@ -2071,7 +2173,7 @@ uint8_t mesh_provisioner_process_add_vendor_model(uint8_t* p_data, uint32_t leng
     return HCI_CONTROL_MESH_STATUS_SUCCESS;
 }
 
-extern void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len);
+extern void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
 
 /*
  * This function is called when core receives a valid message for the define Vendor
@@ -2079,7 +2181,7 @@ extern void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint
  * was able to process the message, and FALSE if the message is unknown.  In the latter case the core
  * will call other registered models.
  */
-wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event,  uint8_t *p_data, uint16_t data_len)
+wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len)
 {
     uint8_t i = 0;
     uint8_t j = 0;
@@ -2149,14 +2251,29 @@ uint8_t mesh_provisioner_process_scan_get(wiced_bt_mesh_event_t *p_event, uint8_
 uint8_t mesh_provisioner_process_scan_start(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
 {
     wiced_bt_mesh_provision_scan_start_data_t data;
+    uint8_t i;
     memset(&data, 0, sizeof(data));
     STREAM_TO_UINT8(data.scanned_items_limit, p_data);
     STREAM_TO_UINT8(data.timeout, p_data);
-    if (length >= 2 + MESH_DEVICE_UUID_LEN)
+    length -= 2;
+
+    // Optional UUID can be followed by the optional scan filter. With the filter, the UUID
+    // of all zeros scans for all devices.
+    if (length >= MESH_DEVICE_UUID_LEN)
     {
         data.scan_single_uuid = WICED_TRUE;
         memcpy(data.uuid, p_data, MESH_DEVICE_UUID_LEN);
+        p_data += MESH_DEVICE_UUID_LEN;
+        length -= MESH_DEVICE_UUID_LEN;
+    }
+    if (length >= MESH_APP_SCAN_FILTER_LEN)
+    {
+        for (i = 0; (i < MESH_DEVICE_UUID_LEN) && (data.uuid[i] == 0); i++)
+            ;
+        data.scan_single_uuid = (i != MESH_DEVICE_UUID_LEN);
     }
+    mesh_app_scan_filter_set((length >= MESH_APP_SCAN_FILTER_LEN) ? p_data : NULL);
+
     return wiced_bt_mesh_provision_scan_start(p_event, &data) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
 }
 
@@ -2177,18 +2294,22 @@ uint8_t mesh_provisioner_process_extended_scan_start(wiced_bt_mesh_event_t *p_ev
         STREAM_TO_UINT8(data.ad_filter_types[i], p_data);
         length--;
     }
-    if ((length != 17) && (length != 0))
-    {
-        WICED_BT_TRACE("ext scan start len:%d\n", length);
-        return WICED_FALSE;
-    }
-    if (length == 17)
+    // Optional UUID and timeout can be followed by the optional scan filter
+    if ((length == 17) || (length == 17 + MESH_APP_SCAN_FILTER_LEN))
     {
         data.uuid_present = WICED_TRUE;
         memcpy(data.uuid, p_data, 16);
         p_data += 16;
         STREAM_TO_UINT8(data.timeout, p_data);
+        length -= 17;
+    }
+    if ((length != MESH_APP_SCAN_FILTER_LEN) && (length != 0))
+    {
+        WICED_BT_TRACE("ext scan start len:%d\n", length);
+        return WICED_FALSE;
     }
+    mesh_app_scan_filter_set((length == MESH_APP_SCAN_FILTER_LEN) ? p_data : NULL);
+
     return wiced_bt_mesh_provision_scan_extended_start(p_event, &data) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
 }
 
@@ -2206,6 +2327,7 @@ uint8_t mesh_provisioner_process_scan_stop(wiced_bt_mesh_event_t *p_event, uint8
 uint8_t mesh_provisioner_process_connect(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
 {
     wiced_bt_mesh_provision_connect_data_t connect;
+    uint16_t server_addr = p_event->dst;
     uint8_t use_pb_gatt;
 
     STREAM_TO_ARRAY(connect.uuid, p_data, 16);
@@ -2213,7 +2335,12 @@ uint8_t mesh_provisioner_process_connect(wiced_bt_mesh_event_t *p_event, uint8_t
     STREAM_TO_UINT8(connect.procedure, p_data);
     STREAM_TO_UINT8(use_pb_gatt, p_data);
 
-    return wiced_bt_mesh_provision_connect(p_event, &connect, use_pb_gatt)  ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
+    if (!wiced_bt_mesh_provision_connect(p_event, &connect, use_pb_gatt))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_app_static_oob_link_set(server_addr, connect.uuid);
+    mesh_app_provision_phase(server_addr, MESH_APP_PROVISION_PHASE_CONNECT, 0);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
 }
 
 /*
@@ -2230,6 +2357,7 @@ uint8_t mesh_provisioner_process_disconnect(wiced_bt_mesh_event_t *p_event, uint
 uint8_t mesh_provisioner_process_start(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
 {
     wiced_bt_mesh_provision_start_data_t start;
+    uint16_t server_addr = p_event->dst;
 
     STREAM_TO_UINT16(start.addr, p_data);
     STREAM_TO_UINT16(start.net_key_idx, p_data);
@@ -2239,7 +2367,11 @@ uint8_t mesh_provisioner_process_start(wiced_bt_mesh_event_t *p_event, uint8_t *
     STREAM_TO_UINT8(start.auth_action, p_data);
     STREAM_TO_UINT8(start.auth_size, p_data);
 
-    return wiced_bt_mesh_provision_start(p_event, &start) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
+    if (!wiced_bt_mesh_provision_start(p_event, &start))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_app_provision_phase(server_addr, MESH_APP_PROVISION_PHASE_START, 0);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
 }
 
 /*
@@ -2247,7 +2379,13 @@ uint8_t mesh_provisioner_process_start(wiced_bt_mesh_event_t *p_event, uint8_t *
  */
 uint8_t mesh_provisioner_process_oob_value(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
 {
-    return wiced_bt_mesh_provision_client_set_oob(p_event, p_data, length) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
+    uint16_t server_addr = p_event->dst;
+
+    if (!wiced_bt_mesh_provision_client_set_oob(p_event, p_data, length))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_app_provision_phase(server_addr, MESH_APP_PROVISION_PHASE_OOB_VALUE, 0);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
 }
 
 /*
@@ -2334,7 +2472,7 @@ void mesh_provisioner_hci_agg_item_add_status_send(uint8_t status)
 
     UINT8_TO_STREAM(p, status);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_OPCODES_AGGREGATOR_ADD_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_OPCODES_AGGREGATOR_ADD_STATUS, p_buffer, (uint16_t)(p - p_buffer));
 }
 #endif
 
@@ -3193,17 +3331,11 @@ uint8_t mesh_provisioner_process_model_publication_set(wiced_bt_mesh_event_t *p_
 {
     wiced_bt_mesh_config_model_publication_set_data_t data;
 
-    STREAM_TO_UINT16(data.element_addr, p_data);
-    STREAM_TO_UINT16(data.company_id, p_data);
-    STREAM_TO_UINT16(data.model_id, p_data);
-    STREAM_TO_ARRAY(data.publish_addr, p_data, 16);
-    STREAM_TO_UINT16(data.app_key_idx, p_data);
-    STREAM_TO_UINT8(data.credential_flag, p_data);
-    STREAM_TO_UINT8(data.publish_ttl, p_data);
-    STREAM_TO_UINT32(data.publish_period, p_data);
-    STREAM_TO_UINT8(data.publish_retransmit_count, p_data);
-    STREAM_TO_UINT16(data.publish_retransmit_interval, p_data);
-
+    if (mesh_app_hci_decode(&mesh_provisioner_model_publication_set_layout, p_data, length, &data) != HCI_CONTROL_MESH_STATUS_SUCCESS)
+    {
+        wiced_bt_mesh_release_event(p_event);
+        return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+    }
     return wiced_bt_mesh_config_model_publication_set(p_event, &data) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
 }
 
@@ -3491,7 +3623,7 @@ uint8_t mesh_provisioner_process_proxy_filter_type_set(wiced_bt_mesh_event_t *p_
     return wiced_bt_mesh_proxy_set_filter_type(p_event, &set) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
 }
 
-uint8_t mesh_provisioner_process_proxy_filter_change(wiced_bt_mesh_event_t *p_event, wiced_bool_t is_add, uint8_t *p_data, uint32_t length)
+uint8_t mesh_provisioner_process_proxy_filter_change(wiced_bt_mesh_event_t *p_event, uint8_t operation, uint8_t *p_data, uint32_t length)
 {
     wiced_bt_mesh_proxy_filter_change_addr_data_t *p_addr;
     uint16_t addr_num = length / 2;
@@ -3505,7 +3637,7 @@ uint8_t mesh_provisioner_process_proxy_filter_change(wiced_bt_mesh_event_t *p_ev
     for (i = 0; i < addr_num; i++)
         STREAM_TO_UINT16(p_addr->addr[i], p_data);
 
-    res = wiced_bt_mesh_proxy_filter_change_addr(p_event, is_add, p_addr) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
+    res = wiced_bt_mesh_proxy_filter_change_addr(p_event, operation == OPERATION_ADD, p_addr) ? HCI_CONTROL_MESH_STATUS_SUCCESS : HCI_CONTROL_MESH_STATUS_ERROR;
     wiced_bt_free_buffer(p_addr);
     return res;
 }
@@ -3543,7 +3675,7 @@ void mesh_provisioner_hci_send_fw_distr_status(uint8_t status)
     UINT8_TO_STREAM(p, fw_distribution_server_get_upload_phase());
     UINT8_TO_STREAM(p, mesh_fw_distribution_get_distribution_state());
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_DISTRIBUTION_UPLOAD_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_DISTRIBUTION_UPLOAD_STATUS, p_buffer, (uint16_t)(p - p_buffer));
 }
 
 uint8_t mesh_provisioner_process_fw_upload_start(uint8_t *p_data, uint32_t length)
@@ -3644,12 +3776,25 @@ uint8_t mesh_provisioner_process_fw_distribution_get_status(wiced_bt_mesh_event_
 
 void mesh_provisioner_hci_send_status(uint8_t status)
 {
-    uint8_t *p_buffer = wiced_transport_allocate_buffer(host_trans_pool);
-    uint8_t *p = p_buffer;
+    uint8_t buffer[3];
+    uint8_t *p = buffer;
 
+    if ((status != HCI_CONTROL_MESH_STATUS_SUCCESS) && (p_mesh_app_transaction_pending != NULL))
+    {
+        // Peer will not reply to the command which failed
+        p_mesh_app_transaction_pending->in_use = WICED_FALSE;
+        p_mesh_app_transaction_pending = NULL;
+    }
+    if (mesh_app_batch_active)
+    {
+        mesh_app_batch_cmd_status = status;
+        return;
+    }
     UINT8_TO_STREAM(p, status);
+    if (mesh_app_transaction_active)
+        UINT16_TO_STREAM(p, mesh_app_transaction_id);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_COMMAND_STATUS, p_buffer, (uint16_t)(p - p_buffer));
+    mesh_app_hci_status_send(buffer, (uint8_t)(p - buffer));
 }
 
 /*
@@ -3661,7 +3806,7 @@ void mesh_provisioner_hci_event_scan_capabilities_status_send(wiced_bt_mesh_hci_
 
     UINT8_TO_STREAM(p, p_data->max_scanned_items);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_CAPABILITIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_CAPABILITIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3676,7 +3821,7 @@ void mesh_provisioner_hci_event_scan_status_send(wiced_bt_mesh_hci_event_t *p_hc
     UINT8_TO_STREAM(p, p_data->scanned_items_limit);
     UINT8_TO_STREAM(p, p_data->timeout);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3685,15 +3830,22 @@ void mesh_provisioner_hci_event_scan_status_send(wiced_bt_mesh_hci_event_t *p_hc
 void mesh_provisioner_hci_event_scan_report_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_report_data_t *p_data)
 {
     uint8_t *p = p_hci_event->data;
+    int8_t  rssi = (int8_t)p_data->rssi;
 
-    UINT8_TO_STREAM(p, p_data->rssi);
+    // Reports of the devices which are already known to the MCU are dropped
+    if (!mesh_app_scan_report_check(p_data->uuid, p_data->oob, &rssi))
+    {
+        mesh_app_free_hci_event(p_hci_event);
+        return;
+    }
+    UINT8_TO_STREAM(p, rssi);
     ARRAY_TO_STREAM(p, p_data->uuid, 16);
     UINT16_TO_STREAM(p, p_data->oob);
     UINT32_TO_STREAM(p, p_data->uri_hash);
 #ifdef PROVISION_SCAN_REPORT_INCLUDE_BDADDR
     BDADDR_TO_STREAM(p, p_data->bdaddr);
 #endif
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3702,18 +3854,19 @@ void mesh_provisioner_hci_event_scan_report_send(wiced_bt_mesh_hci_event_t *p_hc
 void mesh_provisioner_hci_event_scan_extended_report_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_scan_extended_report_data_t *p_data)
 {
     uint8_t* p = p_hci_event->data;
-    uint16_t data_len;
-    int i;
 
+    // Extended reports do not carry the RSSI, only UUID and OOB are filtered
+    if (!mesh_app_scan_filter_match(p_data->uuid, p_data->oob, NULL))
+    {
+        mesh_app_free_hci_event(p_hci_event);
+        return;
+    }
     memcpy(p, (uint8_t *)p_data, 1 + MESH_DEVICE_UUID_LEN + 2); // status, uuid, oob
     p += 1 + MESH_DEVICE_UUID_LEN + 2;
 
-    for (i = 0; (i < sizeof(p_data->adv_data)) && (p_data->adv_data[i] != 0); i++)
-    {
-        *p++ = p_data->adv_data[i];
-    }
+    p += mesh_app_scan_ad_copy(p, p_data->adv_data, sizeof(p_data->adv_data));
     WICED_BT_TRACE_ARRAY(p_hci_event->data, (uint16_t)(p - (uint8_t *)p_hci_event->data), "extended report ");
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_EXTENDED_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_SCAN_EXTENDED_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3727,7 +3880,7 @@ void mesh_provisioner_hci_event_proxy_device_send(wiced_bt_mesh_hci_event_t *p_h
     UINT8_TO_STREAM(p, p_data->bd_addr_type);
     UINT8_TO_STREAM(p, p_data->rssi);
     UINT16_TO_STREAM(p, p_data->net_key_idx);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_DEVICE_NETWORK_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_DEVICE_NETWORK_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 
 }
 
@@ -3741,7 +3894,7 @@ void mesh_provisioner_hci_event_provision_link_status_send(wiced_bt_mesh_hci_eve
     WICED_BT_TRACE("provision connection not sent status from %x addr:%x connected:%d\n", p_hci_event->src, p_data->status);
     UINT8_TO_STREAM(p, p_data->status);
 
-    // mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_LINK_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    // mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_LINK_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_provision_link_report_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_provision_link_report_data_t *p_data)
@@ -3755,7 +3908,7 @@ void mesh_provisioner_hci_event_provision_link_report_send(wiced_bt_mesh_hci_eve
     UINT8_TO_STREAM(p, p_data->reason);
     UINT8_TO_STREAM(p, p_data->over_gatt);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_LINK_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_LINK_REPORT, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3773,7 +3926,7 @@ void mesh_provisioner_hci_event_provision_end_send(wiced_bt_mesh_hci_event_t *p_
     UINT8_TO_STREAM(p, p_data->result);
     ARRAY_TO_STREAM(p, p_data->dev_key, WICED_BT_MESH_KEY_LEN);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_END, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_END, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3795,7 +3948,7 @@ void mesh_provisioner_hci_event_device_capabilities_send(wiced_bt_mesh_hci_event
     UINT8_TO_STREAM(p, p_data->input_oob_size);
     UINT16_TO_STREAM(p, p_data->input_oob_action);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_DEVICE_CAPABILITIES, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_DEVICE_CAPABILITIES, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -3807,12 +3960,19 @@ void mesh_provisioner_hci_event_device_get_oob_data_send(wiced_bt_mesh_hci_event
 
     WICED_BT_TRACE("mesh prov oob req from:%x type:%d size:%d action:%d\n", p_oob_data->provisioner_addr, p_oob_data->type, p_oob_data->size, p_oob_data->action);
 
+    // Static OOB of the devices loaded in the table is supplied without the MCU
+    if (mesh_app_static_oob_request(p_oob_data->provisioner_addr, p_oob_data->type))
+    {
+        mesh_app_free_hci_event(p_hci_event);
+        return;
+    }
+
     UINT16_TO_STREAM(p, p_oob_data->provisioner_addr);
     UINT8_TO_STREAM(p, p_oob_data->type);
     UINT8_TO_STREAM(p, p_oob_data->size);
     UINT8_TO_STREAM(p, p_oob_data->action);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_OOB_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_OOB_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_proxy_connection_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_connect_status_data_t *p_data)
@@ -3826,7 +3986,7 @@ void mesh_provisioner_hci_event_proxy_connection_status_send(wiced_bt_mesh_hci_e
     UINT8_TO_STREAM(p, p_data->connected);
     UINT8_TO_STREAM(p, p_data->over_gatt);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_CONNECTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_CONNECTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
@@ -3841,7 +4001,7 @@ void mesh_provisioner_hci_event_record_list(wiced_bt_mesh_hci_event_t *p_hci_eve
     {
         UINT16_TO_STREAM(p, p_data->list[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_record_response(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_core_provisioning_record_t *p_data)
@@ -3858,7 +4018,7 @@ void mesh_provisioner_hci_event_record_response(wiced_bt_mesh_hci_event_t *p_hci
         UINT8_TO_STREAM(p, p_data->data[i]);
     }
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_RESPONSE, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_RESPONSE, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
@@ -3869,7 +4029,7 @@ void mesh_provisioner_hci_event_proxy_filter_status_send(wiced_bt_mesh_hci_event
     UINT8_TO_STREAM(p, p_data->type);
     UINT16_TO_STREAM(p, p_data->list_size);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_FILTER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROXY_FILTER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_node_reset_status_send(wiced_bt_mesh_hci_event_t *p_hci_event)
@@ -3878,7 +4038,7 @@ void mesh_provisioner_hci_event_node_reset_status_send(wiced_bt_mesh_hci_event_t
 
     WICED_BT_TRACE("node reset status\n", p_hci_event->src);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NODE_RESET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NODE_RESET_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_node_identity_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_node_identity_status_data_t *p_data)
@@ -3891,7 +4051,7 @@ void mesh_provisioner_hci_event_node_identity_status_send(wiced_bt_mesh_hci_even
     UINT16_TO_STREAM(p, p_data->net_key_idx);
     UINT8_TO_STREAM(p, p_data->identity);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NODE_IDENTITY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NODE_IDENTITY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 
@@ -3904,7 +4064,7 @@ void mesh_provisioner_hci_event_composition_data_status_send(wiced_bt_mesh_hci_e
     UINT8_TO_STREAM(p, p_data->page_number);
     ARRAY_TO_STREAM(p, p_data->data, p_data->data_len);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_COMPOSITION_DATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
     wiced_bt_free_buffer(p_data);
 }
 
@@ -3916,7 +4076,7 @@ void mesh_provisioner_hci_event_friend_status_send(wiced_bt_mesh_hci_event_t *p_
 
     UINT8_TO_STREAM(p, p_data->state);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_FRIEND_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_FRIEND_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_key_refresh_phase_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_key_refresh_phase_status_data_t *p_data)
@@ -3929,7 +4089,7 @@ void mesh_provisioner_hci_event_key_refresh_phase_status_send(wiced_bt_mesh_hci_
     UINT16_TO_STREAM(p, p_data->net_key_idx);
     UINT8_TO_STREAM(p, p_data->phase);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PHASE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PHASE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_default_ttl_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_default_ttl_status_data_t *p_data)
@@ -3940,7 +4100,7 @@ void mesh_provisioner_hci_event_default_ttl_status_send(wiced_bt_mesh_hci_event_
 
     UINT8_TO_STREAM(p, p_data->ttl);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DEFAULT_TTL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DEFAULT_TTL_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_relay_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_relay_status_data_t *p_data)
@@ -3953,7 +4113,7 @@ void mesh_provisioner_hci_event_relay_status_send(wiced_bt_mesh_hci_event_t *p_h
     UINT8_TO_STREAM(p, p_data->retransmit_count);
     UINT16_TO_STREAM(p, p_data->retransmit_interval);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_RELAY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_RELAY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #ifdef DIRECTED_FORWARDING_SERVER_SUPPORTED
@@ -3971,7 +4131,7 @@ void mesh_provisioner_hci_event_df_directed_control_status_send(wiced_bt_mesh_hc
     UINT8_TO_STREAM(p, p_data->control.proxy_use_directed_default);
     UINT8_TO_STREAM(p, p_data->control.friend);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_path_metric_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_path_metric_status_data_t* p_data)
 {
@@ -3983,7 +4143,7 @@ static void mesh_provisioner_hci_event_df_path_metric_status_send(wiced_bt_mesh_
     UINT8_TO_STREAM(p, p_data->type);
     UINT8_TO_STREAM(p, p_data->lifetime);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_METRIC_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_METRIC_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_discovery_table_capabilities_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_discovery_table_capabilities_status_data_t* p_data)
 {
@@ -3995,7 +4155,7 @@ static void mesh_provisioner_hci_event_df_discovery_table_capabilities_status_se
     UINT8_TO_STREAM(p, p_data->max_concurrent_init);
     UINT8_TO_STREAM(p, p_data->max_discovery_table_entries_count);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DISCOVERY_TABLE_CAPABILITIES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DISCOVERY_TABLE_CAPABILITIES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_forwarding_table_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_forwarding_table_status_data_t* p_data)
 {
@@ -4007,7 +4167,7 @@ static void mesh_provisioner_hci_event_df_forwarding_table_status_send(wiced_bt_
     UINT16_TO_STREAM(p, p_data->po);
     UINT16_TO_STREAM(p, p_data->dst);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_forwarding_table_dependents_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_forwarding_table_dependents_status_data_t* p_data)
 {
@@ -4019,7 +4179,7 @@ static void mesh_provisioner_hci_event_df_forwarding_table_dependents_status_sen
     UINT16_TO_STREAM(p, p_data->po);
     UINT16_TO_STREAM(p, p_data->dst);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_DEPENDENTS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_DEPENDENTS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_forwarding_table_dependents_get_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_forwarding_table_dependents_get_status_data_t* p_data)
 {
@@ -4047,7 +4207,7 @@ static void mesh_provisioner_hci_event_df_forwarding_table_dependents_get_status
         UINT8_TO_STREAM(p, p_data->dependents[ui8].sec_elem_cnt);
     }
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_DEPENDENTS_GET_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_DEPENDENTS_GET_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_forwarding_table_entries_count_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_forwarding_table_entries_count_status_data_t* p_data)
 {
@@ -4058,7 +4218,7 @@ static void mesh_provisioner_hci_event_df_forwarding_table_entries_count_status_
     UINT16_TO_STREAM(p, p_data->update_id);
     UINT16_TO_STREAM(p, p_data->fixed);
     UINT16_TO_STREAM(p, p_data->non_fixed);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_ENTRIES_COUNT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_ENTRIES_COUNT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_forwarding_table_entries_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_forwarding_table_entries_status_data_t* p_data)
 {
@@ -4098,7 +4258,7 @@ static void mesh_provisioner_hci_event_df_forwarding_table_entries_status_send(w
             UINT8_TO_STREAM(p, entry->non_fixed.po_fn);
         }
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_ENTRIES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_FORWARDING_TABLE_ENTRIES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_wanted_lanes_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_wanted_lanes_status_data_t* p_data)
 {
@@ -4107,7 +4267,7 @@ static void mesh_provisioner_hci_event_df_wanted_lanes_status_send(wiced_bt_mesh
     UINT8_TO_STREAM(p, p_data->status);
     UINT16_TO_STREAM(p, p_data->netkey_idx);
     UINT8_TO_STREAM(p, p_data->wanted_lines);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_WANTED_LANES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_WANTED_LANES_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_two_way_path_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_two_way_path_status_data_t* p_data)
 {
@@ -4118,7 +4278,7 @@ static void mesh_provisioner_hci_event_df_two_way_path_status_send(wiced_bt_mesh
     UINT16_TO_STREAM(p, p_data->netkey_idx);
     ui8 = p_data->two_way_path ? 1 : 0;
     UINT8_TO_STREAM(p, ui8);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_TWO_WAY_PATH_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_TWO_WAY_PATH_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_path_echo_interval_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_path_echo_interval_status_data_t* p_data)
 {
@@ -4128,7 +4288,7 @@ static void mesh_provisioner_hci_event_df_path_echo_interval_status_send(wiced_b
     UINT16_TO_STREAM(p, p_data->netkey_idx);
     UINT8_TO_STREAM(p, p_data->unicast);
     UINT8_TO_STREAM(p, p_data->multicast);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_ECHO_INTERVAL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_ECHO_INTERVAL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_network_transmit_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_transmit_status_data_t* p_data)
 {
@@ -4136,7 +4296,7 @@ static void mesh_provisioner_hci_event_df_directed_network_transmit_status_send(
     WICED_BT_TRACE("df directed_network_transmit_status src:%x\n", p_hci_event->src);
     UINT8_TO_STREAM(p, p_data->count);
     UINT8_TO_STREAM(p, p_data->interval);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_NETWORK_TRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_NETWORK_TRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_relay_retransmit_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_transmit_status_data_t* p_data)
 {
@@ -4144,7 +4304,7 @@ static void mesh_provisioner_hci_event_df_directed_relay_retransmit_status_send(
     WICED_BT_TRACE("df directed_relay_retransmit_status src:%x\n", p_hci_event->src);
     UINT8_TO_STREAM(p, p_data->count);
     UINT8_TO_STREAM(p, p_data->interval);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_RELAY_RETRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_RELAY_RETRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_rssi_threshold_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_rssi_threshold_status_data_t* p_data)
 {
@@ -4152,7 +4312,7 @@ static void mesh_provisioner_hci_event_df_rssi_threshold_status_send(wiced_bt_me
     WICED_BT_TRACE("df rssi_threshold_status src:%x\n", p_hci_event->src);
     UINT8_TO_STREAM(p, p_data->default_threshold);
     UINT8_TO_STREAM(p, p_data->margin);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_RSSI_THRESHOLD_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_RSSI_THRESHOLD_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_paths_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_paths_status_data_t* p_data)
 {
@@ -4162,7 +4322,7 @@ static void mesh_provisioner_hci_event_df_directed_paths_status_send(wiced_bt_me
     UINT16_TO_STREAM(p, p_data->relay_paths);
     UINT16_TO_STREAM(p, p_data->proxy_paths);
     UINT16_TO_STREAM(p, p_data->friend_paths);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_PATHS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_PATHS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_publish_policy_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_publish_policy_status_data_t* p_data)
 {
@@ -4175,7 +4335,7 @@ static void mesh_provisioner_hci_event_df_directed_publish_policy_status_send(wi
     UINT16_TO_STREAM(p, p_data->elem_addr);
     UINT16_TO_STREAM(p, p_data->company_id);
     UINT16_TO_STREAM(p, p_data->model_id);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_PUBLISH_POLICY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_PUBLISH_POLICY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_path_discovery_timing_control_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_path_discovery_timing_control_status_data_t* p_data)
 {
@@ -4188,7 +4348,7 @@ static void mesh_provisioner_hci_event_df_path_discovery_timing_control_status_s
     UINT8_TO_STREAM(p, ui8);
     ui8 = p_data->lane_discovery_guard_interval_high ? 1 : 0;
     UINT8_TO_STREAM(p, ui8);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_DISCOVERY_TIMING_CONTROL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_PATH_DISCOVERY_TIMING_CONTROL_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_control_network_transmit_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_transmit_status_data_t* p_data)
 {
@@ -4196,7 +4356,7 @@ static void mesh_provisioner_hci_event_df_directed_control_network_transmit_stat
     WICED_BT_TRACE("df directed_control_network_transmit_status src:%x\n", p_hci_event->src);
     UINT8_TO_STREAM(p, p_data->count);
     UINT8_TO_STREAM(p, p_data->interval);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_NETWORK_TRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 static void mesh_provisioner_hci_event_df_directed_control_relay_retransmit_status_send(wiced_bt_mesh_hci_event_t* p_hci_event, wiced_bt_mesh_df_directed_transmit_status_data_t* p_data)
 {
@@ -4204,7 +4364,7 @@ static void mesh_provisioner_hci_event_df_directed_control_relay_retransmit_stat
     WICED_BT_TRACE("df directed_control_relay_retransmit_status src:%x\n", p_hci_event->src);
     UINT8_TO_STREAM(p, p_data->count);
     UINT8_TO_STREAM(p, p_data->interval);
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_DF_DIRECTED_CONTROL_RELAY_RETRANSMIT_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 #endif
 #ifdef NETWORK_FILTER_SERVER_SUPPORTED
@@ -4224,7 +4384,7 @@ void mesh_provisioner_hci_event_network_filter_status_send(wiced_bt_mesh_hci_eve
         UINT16_TO_STREAM(p, p_data->addr[i]);
     }
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NETWORK_FILTER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NETWORK_FILTER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 #endif
@@ -4241,7 +4401,7 @@ void mesh_provisioner_hci_event_large_compos_data_status_send(wiced_bt_mesh_hci_
     UINT16_TO_STREAM(p, p_data->total_size);
     ARRAY_TO_STREAM(p, p_data->p_data, p_data->data_len);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LARGE_COMPOS_DATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LARGE_COMPOS_DATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_models_metadata_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_models_metadata_status_data_t *p_data)
@@ -4255,7 +4415,7 @@ void mesh_provisioner_hci_event_models_metadata_status_send(wiced_bt_mesh_hci_ev
     UINT16_TO_STREAM(p, p_data->total_size);
     ARRAY_TO_STREAM(p, p_data->p_data, p_data->data_len);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODELS_METADATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODELS_METADATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
@@ -4267,7 +4427,7 @@ void mesh_provisioner_hci_event_gatt_proxy_status_send(wiced_bt_mesh_hci_event_t
 
     UINT8_TO_STREAM(p, p_data->state);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_GATT_PROXY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_GATT_PROXY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_beacon_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_beacon_status_data_t *p_data)
@@ -4278,7 +4438,7 @@ void mesh_provisioner_hci_event_beacon_status_send(wiced_bt_mesh_hci_event_t *p_
 
     UINT8_TO_STREAM(p, p_data->state);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_BEACON_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_BEACON_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #ifdef SAR_CONFIGURATION_SUPPORTED
@@ -4291,7 +4451,7 @@ void mesh_provisioner_hci_event_sar_transmitter_status_send(wiced_bt_mesh_hci_ev
     memcpy(p, p_data, MESH_SAR_XMTR_PARAMS_LEN);
     p += MESH_SAR_XMTR_PARAMS_LEN;
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SAR_TRANSMITTER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SAR_TRANSMITTER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_sar_receiver_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_sar_rcvr_t *p_data)
@@ -4303,7 +4463,7 @@ void mesh_provisioner_hci_event_sar_receiver_status_send(wiced_bt_mesh_hci_event
     memcpy(p, p_data, MESH_SAR_RCVR_PARAMS_LEN);
     p += MESH_SAR_RCVR_PARAMS_LEN;
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SAR_RECEIVER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SAR_RECEIVER_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 #endif
 
@@ -4317,7 +4477,7 @@ void mesh_provisioner_hci_event_private_beacon_status_send(wiced_bt_mesh_hci_eve
     UINT8_TO_STREAM(p, p_data->state);
     UINT8_TO_STREAM(p, p_data->random_update_interval);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_BEACON_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_BEACON_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_private_gatt_proxy_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_private_gatt_proxy_status_data_t *p_data)
@@ -4328,7 +4488,7 @@ void mesh_provisioner_hci_event_private_gatt_proxy_status_send(wiced_bt_mesh_hci
 
     UINT8_TO_STREAM(p, p_data->state);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_GATT_PROXY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_GATT_PROXY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_private_node_identity_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_private_node_identity_status_data_t *p_data)
@@ -4341,7 +4501,7 @@ void mesh_provisioner_hci_event_private_node_identity_status_send(wiced_bt_mesh_
     UINT16_TO_STREAM(p, p_data->net_key_idx);
     UINT8_TO_STREAM(p, p_data->identity);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_NODE_IDENTITY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PRIVATE_NODE_IDENTITY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_on_demand_private_proxy_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_on_demand_private_proxy_status_data_t *p_data)
@@ -4352,7 +4512,7 @@ void mesh_provisioner_hci_event_on_demand_private_proxy_status_send(wiced_bt_mes
 
     UINT8_TO_STREAM(p, p_data->state);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_ON_DEMAND_PRIVATE_PROXY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_ON_DEMAND_PRIVATE_PROXY_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_solicitation_pdu_rpl_items_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_unicast_address_range_t *p_data)
@@ -4368,7 +4528,7 @@ void mesh_provisioner_hci_event_solicitation_pdu_rpl_items_status_send(wiced_bt_
     UINT16_TO_STREAM(p, p_data->range_start);
     UINT8_TO_STREAM(p, range_length);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SOLICITATION_PDU_RPL_ITEMS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SOLICITATION_PDU_RPL_ITEMS_STATUS, (uint8_t*)p_hci_event, (uint16_t)(p - (uint8_t*)p_hci_event));
 }
 #endif
 
@@ -4390,7 +4550,7 @@ void mesh_provisioner_hci_event_model_publication_status_send(wiced_bt_mesh_hci_
     UINT8_TO_STREAM(p, p_data->publish_retransmit_count);
     UINT16_TO_STREAM(p, p_data->publish_retransmit_interval);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_PUBLICATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_PUBLICATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_model_subscription_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_model_subscription_status_data_t *p_data)
@@ -4405,7 +4565,7 @@ void mesh_provisioner_hci_event_model_subscription_status_send(wiced_bt_mesh_hci
     UINT16_TO_STREAM(p, p_data->model_id);
     UINT16_TO_STREAM(p, p_data->addr);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_model_subscription_list_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_model_subscription_list_data_t *p_data)
@@ -4423,7 +4583,7 @@ void mesh_provisioner_hci_event_model_subscription_list_send(wiced_bt_mesh_hci_e
     {
         UINT16_TO_STREAM(p, p_data->addr[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_SUBSCRIPTION_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_netkey_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_netkey_status_data_t *p_data)
@@ -4435,7 +4595,7 @@ void mesh_provisioner_hci_event_netkey_status_send(wiced_bt_mesh_hci_event_t *p_
     UINT8_TO_STREAM(p, p_data->status);
     UINT16_TO_STREAM(p, p_data->net_key_idx);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NETKEY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NETKEY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_netkey_list_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_netkey_list_data_t *p_data)
@@ -4449,7 +4609,7 @@ void mesh_provisioner_hci_event_netkey_list_send(wiced_bt_mesh_hci_event_t *p_hc
     {
         UINT16_TO_STREAM(p, p_data->net_key_idx[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NETKEY_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NETKEY_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_appkey_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_appkey_status_data_t *p_data)
@@ -4462,7 +4622,7 @@ void mesh_provisioner_hci_event_appkey_status_send(wiced_bt_mesh_hci_event_t *p_
     UINT16_TO_STREAM(p, p_data->net_key_idx);
     UINT16_TO_STREAM(p, p_data->app_key_idx);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_APPKEY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_APPKEY_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_appkey_list_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_appkey_list_data_t *p_data)
@@ -4478,7 +4638,7 @@ void mesh_provisioner_hci_event_appkey_list_send(wiced_bt_mesh_hci_event_t *p_hc
     {
         UINT16_TO_STREAM(p, p_data->app_key_idx[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_APPKEY_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_APPKEY_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_model_app_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_model_app_bind_status_data_t *p_data)
@@ -4493,7 +4653,7 @@ void mesh_provisioner_hci_event_model_app_status_send(wiced_bt_mesh_hci_event_t
     UINT16_TO_STREAM(p, p_data->model_id);
     UINT16_TO_STREAM(p, p_data->app_key_idx);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_APP_BIND_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_APP_BIND_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_model_app_list_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_model_app_list_data_t *p_data)
@@ -4511,7 +4671,7 @@ void mesh_provisioner_hci_event_model_app_list_send(wiced_bt_mesh_hci_event_t *p
     {
         UINT16_TO_STREAM(p, p_data->app_key_idx[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_APP_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_MODEL_APP_LIST, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_hearbeat_subscription_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_heartbeat_subscription_status_data_t *p_data)
@@ -4529,7 +4689,7 @@ void mesh_provisioner_hci_event_hearbeat_subscription_status_send(wiced_bt_mesh_
     UINT8_TO_STREAM(p, p_data->min_hops);
     UINT8_TO_STREAM(p, p_data->max_hops);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEARTBEAT_SUBSCRIPTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEARTBEAT_SUBSCRIPTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_hearbeat_publication_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_heartbeat_publication_status_data_t *p_data)
@@ -4550,7 +4710,7 @@ void mesh_provisioner_hci_event_hearbeat_publication_status_send(wiced_bt_mesh_h
     UINT8_TO_STREAM(p, p_data->feature_low_power);
     UINT16_TO_STREAM(p, p_data->net_key_idx);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEARTBEAT_PUBLICATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEARTBEAT_PUBLICATION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_network_transmit_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_config_network_transmit_status_data_t *p_data)
@@ -4562,7 +4722,7 @@ void mesh_provisioner_hci_event_network_transmit_status_send(wiced_bt_mesh_hci_e
     UINT8_TO_STREAM(p, p_data->count);
     UINT32_TO_STREAM(p, p_data->interval);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_NETWORK_TRANSMIT_PARAMS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_NETWORK_TRANSMIT_PARAMS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_health_current_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_health_fault_status_data_t *p_data)
@@ -4574,7 +4734,7 @@ void mesh_provisioner_hci_event_health_current_status_send(wiced_bt_mesh_hci_eve
     UINT16_TO_STREAM(p, p_data->company_id);
     ARRAY_TO_STREAM(p, p_data->fault_array, p_data->count);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_CURRENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_CURRENT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_health_fault_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_health_fault_status_data_t *p_data)
@@ -4586,7 +4746,7 @@ void mesh_provisioner_hci_event_health_fault_status_send(wiced_bt_mesh_hci_event
     UINT16_TO_STREAM(p, p_data->company_id);
     ARRAY_TO_STREAM(p, p_data->fault_array, p_data->count);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_FAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_FAULT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_health_period_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_health_period_status_data_t *p_data)
@@ -4596,7 +4756,7 @@ void mesh_provisioner_hci_event_health_period_status_send(wiced_bt_mesh_hci_even
     UINT16_TO_STREAM(p, p_data->app_key_idx);
     UINT8_TO_STREAM(p, p_data->divisor);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_PERIOD_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_PERIOD_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_health_attention_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_health_attention_status_data_t *p_data)
@@ -4605,7 +4765,7 @@ void mesh_provisioner_hci_event_health_attention_status_send(wiced_bt_mesh_hci_e
 
     UINT8_TO_STREAM(p, p_data->timer);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_ATTENTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_HEALTH_ATTENTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_lpn_poll_timeout_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_lpn_poll_timeout_status_data_t *p_data)
@@ -4615,7 +4775,7 @@ void mesh_provisioner_hci_event_lpn_poll_timeout_status_send(wiced_bt_mesh_hci_e
     UINT16_TO_STREAM(p, p_data->lpn_addr);
     UINT32_TO_STREAM(p, p_data->poll_timeout);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_LPN_POLL_TIMEOUT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_LPN_POLL_TIMEOUT_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #ifdef MESH_DFU_SUPPORTED
@@ -4634,7 +4794,7 @@ void mesh_provisioner_hci_event_fw_distribution_status_send(wiced_bt_mesh_hci_ev
         UINT8_TO_STREAM(p, p_data->node[i].progress);
     }
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_DISTRIBUTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_DISTRIBUTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 void mesh_provisioner_hci_event_fw_update_metadata_status_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_dfu_metadata_status_data_t *p_data)
@@ -4645,7 +4805,7 @@ void mesh_provisioner_hci_event_fw_update_metadata_status_send(wiced_bt_mesh_hci
     UINT8_TO_STREAM(p, p_data->add_info);
     UINT8_TO_STREAM(p, p_data->index);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_UPDATE_METADATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_FW_UPDATE_METADATA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
@@ -0,0 +1,562 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ * Definitions shared between the provisioner client and the model client front-ends.
+ */
+#ifndef MESH_PROVISION_CLIENT_H__
+#define MESH_PROVISION_CLIENT_H__
+
+#include <stddef.h>
+#include "wiced_bt_types.h"
+#include "wiced_bt_mesh_models.h"
+#include "wiced_bt_mesh_app.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+
+/*
+ * Application specific commands and events of the HCI_CONTROL_GROUP_MESH group.
+ * The values are taken from the top of the group which is not used by hci_control_api.h.
+ */
+#ifndef HCI_CONTROL_MESH_COMMAND_BATCH
+#define HCI_CONTROL_MESH_COMMAND_BATCH                  ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE0 )  /* Execute a list of commands and reply with one batch status */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_TRANSACTION
+#define HCI_CONTROL_MESH_COMMAND_TRANSACTION            ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE1 )  /* Execute a command tagged with a transaction ID */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_STATUS_COALESCE_SET
+#define HCI_CONTROL_MESH_COMMAND_STATUS_COALESCE_SET    ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE2 )  /* Enable or disable coalescing of command statuses */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_EVENT_MUX_SET
+#define HCI_CONTROL_MESH_COMMAND_EVENT_MUX_SET          ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE3 )  /* Enable or disable multiplexing of events */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_LATENCY_GET
+#define HCI_CONTROL_MESH_COMMAND_LATENCY_GET            ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE4 )  /* Get and optionally reset latency histograms */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_TRACE_GET
+#define HCI_CONTROL_MESH_COMMAND_TRACE_GET              ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE5 )  /* Read binary trace records */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_SCAN_DEDUP_SET
+#define HCI_CONTROL_MESH_COMMAND_SCAN_DEDUP_SET         ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE6 )  /* Configure de-duplication of scan reports */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_SCAN_STATS_GET
+#define HCI_CONTROL_MESH_COMMAND_SCAN_STATS_GET         ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE7 )  /* Get and optionally reset scan report counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET
+#define HCI_CONTROL_MESH_COMMAND_SCAN_AD_FILTER_SET     ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE8 )  /* Set AD types sent in extended scan reports */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH        ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE9 )  /* Provision a list of devices */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH_STATUS_GET
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_BATCH_STATUS_GET ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEA )  /* Get the progress of each provisioning session */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_RECIPE_SET      ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEB )  /* Set configuration applied to each provisioned node */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_PROVISION_RECORD_FETCH
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_RECORD_FETCH ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEC )  /* Retrieve all fragments of a provisioning record */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_SET
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_SET    ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xED )  /* Enable or disable provisioning phase events */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_STATS_GET
+#define HCI_CONTROL_MESH_COMMAND_PROVISION_PHASE_STATS_GET ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEE )  /* Get and optionally reset time spent in each provisioning phase */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD
+#define HCI_CONTROL_MESH_COMMAND_STATIC_OOB_ADD         ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEF )  /* Add static OOB values of the devices to be provisioned */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_STATIC_OOB_STATS_GET
+#define HCI_CONTROL_MESH_COMMAND_STATIC_OOB_STATS_GET   ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF0 )  /* Get and optionally reset static OOB table counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_GET
+#define HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_GET  ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF1 )  /* Get composition data of the node of the known product */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_STATS_GET
+#define HCI_CONTROL_MESH_COMMAND_COMPOSITION_CACHE_STATS_GET ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF2 )  /* Get and optionally reset composition cache counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_COMPOSITION_MODEL_FIND
+#define HCI_CONTROL_MESH_COMMAND_COMPOSITION_MODEL_FIND ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF3 )  /* Find elements of one or all nodes which host the model */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE   ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF4 )  /* Queue config client commands to be sent without waiting for each status */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_SET     ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF5 )  /* Set windows, timeout and retries of queued config commands */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_STATS_GET
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_STATS_GET ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF6 )  /* Get and optionally reset queued config command counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_CONFIG_SUBSCRIPTION_FANOUT
+#define HCI_CONTROL_MESH_COMMAND_CONFIG_SUBSCRIPTION_FANOUT ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF7 )  /* Change subscription of the model on a list of nodes */
+#endif
+
+#ifndef HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START
+#define HCI_CONTROL_MESH_COMMAND_KEY_REFRESH_START      ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF8 )  /* Execute key refresh procedure on a list of nodes */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_BATCH_STATUS
+#define HCI_CONTROL_MESH_EVENT_BATCH_STATUS             ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE0 )  /* Status of each command of the batch */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_TRANSACTION
+#define HCI_CONTROL_MESH_EVENT_TRANSACTION              ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE1 )  /* Event tagged with the transaction ID of the command it replies to */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST
+#define HCI_CONTROL_MESH_EVENT_COMMAND_STATUS_LIST      ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE2 )  /* Command statuses collected in coalescing mode */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_MULTIPLEXED
+#define HCI_CONTROL_MESH_EVENT_MULTIPLEXED              ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE3 )  /* Several events packed in one transport buffer */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_LATENCY_STATUS
+#define HCI_CONTROL_MESH_EVENT_LATENCY_STATUS           ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE4 )  /* Latency histograms */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_TRACE_DATA
+#define HCI_CONTROL_MESH_EVENT_TRACE_DATA               ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE5 )  /* Binary trace records */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_SCAN_STATS
+#define HCI_CONTROL_MESH_EVENT_SCAN_STATS               ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE6 )  /* Scan report counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT
+#define HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_RESULT   ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE7 )  /* Result of the provisioning of one device of the list */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_STATUS
+#define HCI_CONTROL_MESH_EVENT_PROVISION_BATCH_STATUS   ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE8 )  /* Progress of each provisioning session */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE
+#define HCI_CONTROL_MESH_EVENT_CONFIG_RECIPE_DONE       ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xE9 )  /* Provisioned node has been configured */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA
+#define HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA    ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEA )  /* Part of the provisioning record */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_PROVISION_PHASE
+#define HCI_CONTROL_MESH_EVENT_PROVISION_PHASE          ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEB )  /* Provisioning phase reached */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_PROVISION_PHASE_STATS
+#define HCI_CONTROL_MESH_EVENT_PROVISION_PHASE_STATS    ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEC )  /* Time spent in each provisioning phase */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_STATIC_OOB_STATS
+#define HCI_CONTROL_MESH_EVENT_STATIC_OOB_STATS         ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xED )  /* Static OOB table size and counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_COMPOSITION_CACHE_STATS
+#define HCI_CONTROL_MESH_EVENT_COMPOSITION_CACHE_STATS  ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEE )  /* Composition cache size and counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_COMPOSITION_MODEL_ELEMENTS
+#define HCI_CONTROL_MESH_EVENT_COMPOSITION_MODEL_ELEMENTS ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xEF )  /* Elements which host the model */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE
+#define HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_DONE      ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF0 )  /* Result of the queued config command */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_STATS
+#define HCI_CONTROL_MESH_EVENT_CONFIG_REQUEST_STATS     ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF1 )  /* Queued config command counters */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE
+#define HCI_CONTROL_MESH_EVENT_CONFIG_SUBSCRIPTION_DONE ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF2 )  /* Result of the subscription change on each node of the list */
+#endif
+
+#ifndef HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS
+#define HCI_CONTROL_MESH_EVENT_KEY_REFRESH_PROGRESS     ( ( HCI_CONTROL_GROUP_MESH << 8 ) | 0xF3 )  /* Progress of the key refresh procedure */
+#endif
+
+#ifndef HCI_CONTROL_MESH_STATUS_INVALID_LENGTH
+#define HCI_CONTROL_MESH_STATUS_INVALID_LENGTH          0xE0    /* Command payload is shorter than its layout */
+#endif
+
+// Phases of the provisioning reported to the MCU
+#define MESH_APP_PROVISION_PHASE_CONNECT                0   // Provisioning link requested
+#define MESH_APP_PROVISION_PHASE_LINK                   1   // Link status or link report received
+#define MESH_APP_PROVISION_PHASE_CAPABILITIES           2   // Invite sent and device capabilities received
+#define MESH_APP_PROVISION_PHASE_START                  3   // Provisioning started
+#define MESH_APP_PROVISION_PHASE_OOB_REQUEST            4   // Public key exchanged and OOB data requested
+#define MESH_APP_PROVISION_PHASE_OOB_VALUE              5   // OOB data supplied
+#define MESH_APP_PROVISION_PHASE_END                    6   // Confirmation, random and data exchanged
+#define MESH_APP_PROVISION_NUM_PHASES                   7
+
+// Max number of commands queued with HCI_CONTROL_MESH_COMMAND_CONFIG_REQUEST_QUEUE. All of them can wait for a reply.
+#define MESH_APP_CONFIG_REQUEST_MAX_REQUESTS            32
+
+// Severity of the binary traces
+#define MESH_BIN_TRACE_LEVEL_NONE                       0
+#define MESH_BIN_TRACE_LEVEL_ERROR                      1
+#define MESH_BIN_TRACE_LEVEL_WARNING                    2
+#define MESH_BIN_TRACE_LEVEL_INFO                       3
+#define MESH_BIN_TRACE_LEVEL_DEBUG                      4
+
+// Binary traces with a level above the level of the module are not compiled
+#ifndef MESH_BIN_TRACE_LEVEL_PROVISION
+#define MESH_BIN_TRACE_LEVEL_PROVISION                  MESH_BIN_TRACE_LEVEL_INFO
+#endif
+#ifndef MESH_BIN_TRACE_LEVEL_SENSOR
+#define MESH_BIN_TRACE_LEVEL_SENSOR                     MESH_BIN_TRACE_LEVEL_INFO
+#endif
+#ifndef MESH_BIN_TRACE_LEVEL_VENDOR
+#define MESH_BIN_TRACE_LEVEL_VENDOR                     MESH_BIN_TRACE_LEVEL_INFO
+#endif
+
+// Binary trace IDs. The MCU formats the arguments of each record based on the ID.
+#define MESH_BIN_TRACE_ID_PROC_RX_CMD                   0x0001  // opcode, length
+#define MESH_BIN_TRACE_ID_RAW_MODEL_DATA                0x0002  // src, company_id, opcode
+#define MESH_BIN_TRACE_ID_VENDOR_DATA                   0x0003  // src, opcode, length
+#define MESH_BIN_TRACE_ID_VENDOR_CMD                    0x0004  // company_id, model_id, opcode
+#define MESH_BIN_TRACE_ID_SENSOR_SERIES                 0x0005  // property_id, prop_value_len, no_of_columns
+
+#ifdef HCI_CONTROL
+#define MESH_BIN_TRACE(module, level, id, arg0, arg1, arg2) \
+    do { if ((level) <= MESH_BIN_TRACE_LEVEL_##module) mesh_app_bin_trace(id, (uint32_t)(arg0), (uint32_t)(arg1), (uint32_t)(arg2)); } while (0)
+#else
+#define MESH_BIN_TRACE(module, level, id, arg0, arg1, arg2)
+#endif
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+
+/*
+ * Front-end function which processes HCI commands for a model client.
+ * Returns WICED_TRUE if the command has been consumed.
+ */
+typedef uint32_t (*mesh_app_proc_rx_cmd_t)(uint16_t opcode, uint8_t *p_data, uint32_t length);
+
+/*
+ * Each model client front-end registers the list of HCI commands it processes,
+ * so that mesh_app_proc_rx_cmd can find the handler with a single lookup.
+ */
+typedef struct
+{
+    uint16_t                model_id;       // Model ID the front-end creates events for, or MESH_APP_HCI_CMD_MODEL_IN_CMD
+    uint8_t                 num_opcodes;    // Number of entries in p_opcodes
+    const uint16_t          *p_opcodes;     // HCI commands processed by the front-end
+    mesh_app_proc_rx_cmd_t  proc_rx_cmd;    // Front-end function
+} mesh_app_hci_cmd_handler_t;
+
+// Company ID and model ID follow the event header in the command, as for the vendor data
+#define MESH_APP_HCI_CMD_MODEL_IN_CMD   0xFFFF
+
+#define MESH_APP_HCI_CMD_HANDLER(model_id, opcodes, proc_rx_cmd) \
+    { model_id, (uint8_t)(sizeof(opcodes) / sizeof(opcodes[0])), opcodes, proc_rx_cmd }
+
+/*
+ * Field of the command payload. An integer field is len bytes little endian in the payload and is
+ * stored in the member of size bytes. A byte array field (size 0) is copied as is.
+ */
+typedef struct
+{
+    uint16_t    offset;     // Offset of the member in the destination structure
+    uint8_t     len;        // Length of the field in the payload
+    uint8_t     size;       // Size of the integer member, 0 for a byte array
+} mesh_app_hci_field_t;
+
+/*
+ * Layout of the command payload. Fields follow each other in the payload in the order of the list.
+ */
+typedef struct
+{
+    uint16_t                    size;           // Size of the destination structure
+    uint8_t                     num_fields;     // Number of entries in p_fields
+    const mesh_app_hci_field_t  *p_fields;      // Fields of the payload
+} mesh_app_hci_layout_t;
+
+// Evaluates to 0, the compilation fails if the condition is false
+#define MESH_APP_HCI_CHECK(cond)        (0 * sizeof(char[(cond) ? 1 : -1]))
+
+#define MESH_APP_HCI_MEMBER_SIZE(type, member) \
+    sizeof(((type *)0)->member)
+
+// Integer of 1 to 5 bytes stored in a member of 1, 2, 4 or 8 bytes
+#define MESH_APP_HCI_FIELD(type, member, len) \
+    { (uint16_t)offsetof(type, member), \
+      (uint8_t)((len) + MESH_APP_HCI_CHECK(((len) >= 1) && ((len) <= 5) && ((len) <= MESH_APP_HCI_MEMBER_SIZE(type, member)))), \
+      (uint8_t)(MESH_APP_HCI_MEMBER_SIZE(type, member) + MESH_APP_HCI_CHECK((MESH_APP_HCI_MEMBER_SIZE(type, member) & (MESH_APP_HCI_MEMBER_SIZE(type, member) - 1)) == 0) + \
+                                                          MESH_APP_HCI_CHECK(MESH_APP_HCI_MEMBER_SIZE(type, member) <= 8)) }
+
+// Byte array copied to a member of at least len bytes
+#define MESH_APP_HCI_ARRAY(type, member, len) \
+    { (uint16_t)offsetof(type, member), (uint8_t)((len) + MESH_APP_HCI_CHECK((len) <= MESH_APP_HCI_MEMBER_SIZE(type, member))), 0 }
+
+#define MESH_APP_HCI_LAYOUT(type, fields) \
+    { (uint16_t)sizeof(type), (uint8_t)(sizeof(fields) / sizeof(fields[0])), fields }
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern const mesh_app_hci_cmd_handler_t mesh_default_transition_time_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_onoff_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_level_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_light_lightness_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_light_ctl_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_light_hsl_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_light_xyl_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_light_lc_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_sensor_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_scene_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_property_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_battery_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_location_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_power_level_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_power_onoff_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_scheduler_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_time_client_hci_cmd_handler;
+extern const mesh_app_hci_cmd_handler_t mesh_vendor_client_hci_cmd_handler;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+
+/*
+ * Build the index of the HCI commands processed by the model client front-ends and the provisioner.
+ * Returns WICED_FALSE if two entries process the same command.
+ */
+wiced_bool_t mesh_app_hci_cmd_index_init(void);
+
+/*
+ * Same as wiced_bt_mesh_create_hci_event. If the event is a reply to a command received with
+ * HCI_CONTROL_MESH_COMMAND_TRANSACTION, it is sent as HCI_CONTROL_MESH_EVENT_TRANSACTION with
+ * the transaction ID and the opcode of the event in front of the event header.
+ */
+wiced_bt_mesh_hci_event_t *mesh_app_create_hci_event(wiced_bt_mesh_event_t *p_event);
+
+/*
+ * Release the HCI event created with mesh_app_create_hci_event which is not sent.
+ */
+void mesh_app_free_hci_event(wiced_bt_mesh_hci_event_t *p_hci_event);
+
+/*
+ * Called before the event is sent to the MCU. If the event is tagged with the transaction ID,
+ * the header of HCI_CONTROL_MESH_EVENT_TRANSACTION is added, and the opcode and the length are
+ * updated. Returns the start of the data to send.
+ */
+uint8_t *mesh_app_transaction_tag(uint16_t *p_opcode, uint8_t *p_data, uint16_t *p_length);
+
+/*
+ * Decode command payload described by the layout. Returns HCI_CONTROL_MESH_STATUS_INVALID_LENGTH
+ * if the payload is too short.
+ */
+uint8_t mesh_app_hci_decode(const mesh_app_hci_layout_t *p_layout, uint8_t *p_data, uint32_t length, void *p_dst);
+
+/*
+ * Check the payload length for the model client front-ends. If the payload is too short,
+ * the event is released, the command status is sent and WICED_FALSE is returned.
+ */
+wiced_bool_t mesh_app_hci_length_check(wiced_bt_mesh_event_t *p_event, uint32_t length, uint32_t min_length);
+
+/*
+ * Send command status to the MCU.
+ */
+void mesh_provisioner_hci_send_status(uint8_t status);
+
+/*
+ * Send event to the MCU. Collected command statuses are sent before the event.
+ */
+void mesh_app_transport_send_data(uint16_t opcode, uint8_t *p_data, uint16_t length);
+
+/*
+ * Send command status (status and optional transaction ID) to the MCU.
+ */
+void mesh_app_hci_status_send(uint8_t *p_data, uint8_t length);
+
+/*
+ * Send collected command statuses to the MCU.
+ */
+void mesh_app_hci_status_flush(void);
+
+/*
+ * Enable or disable coalescing of command statuses.
+ */
+void mesh_app_hci_status_coalesce_set(wiced_bool_t enable, uint32_t deadline_us);
+uint8_t mesh_app_process_status_coalesce_set(uint8_t *p_data, uint32_t length);
+
+/*
+ * Enable or disable multiplexing of small events in one transport buffer.
+ */
+void mesh_app_hci_mux_set(wiced_bool_t enable, uint16_t timeout_ms);
+uint8_t mesh_app_process_event_mux_set(uint8_t *p_data, uint32_t length);
+
+/*
+ * Same as wiced_bt_mesh_send_hci_tx_complete, but the event goes through the multiplexer to keep the order.
+ */
+void mesh_app_send_hci_tx_complete(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_event_t *p_event);
+
+/*
+ * Count the time from the reception of the command until the reply of the peer.
+ */
+void mesh_app_latency_record(uint16_t opcode, uint16_t dst, uint32_t latency_ms);
+uint8_t mesh_app_process_latency_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Save binary trace record to be read by the MCU.
+ */
+void mesh_app_bin_trace(uint16_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2);
+uint8_t mesh_app_process_trace_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Check if the scan report of the device should be sent to the MCU.
+ */
+wiced_bool_t mesh_app_scan_report_check(uint8_t *p_uuid, uint16_t oob, int8_t *p_rssi);
+uint8_t mesh_app_process_scan_dedup_set(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_scan_stats_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Filter of the scan reports set by the scan start commands.
+ */
+#define MESH_APP_SCAN_FILTER_LEN    (2 * MESH_DEVICE_UUID_LEN + 2 + 1) // UUID, UUID mask, OOB mask, min RSSI
+void mesh_app_scan_filter_set(uint8_t *p_data);
+wiced_bool_t mesh_app_scan_filter_match(uint8_t *p_uuid, uint16_t oob, int8_t *p_rssi);
+
+/*
+ * Copy AD structures of the types requested by the MCU.
+ */
+uint16_t mesh_app_scan_ad_copy(uint8_t *p_dst, uint8_t *p_adv_data, uint16_t adv_len);
+uint8_t mesh_app_process_scan_ad_filter_set(uint8_t *p_data, uint32_t length);
+
+/*
+ * Provision a list of devices without the MCU.
+ */
+wiced_bool_t mesh_app_provision_batch_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_provision_batch(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_provision_batch_status_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Configure each provisioned node with the recipe set by the MCU.
+ */
+wiced_bool_t mesh_app_config_recipe_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_config_recipe_set(uint8_t *p_data, uint32_t length);
+
+/*
+ * Report the phases of the provisioning and collect the time spent in each phase.
+ */
+void mesh_app_provision_phase(uint16_t server_addr, uint8_t phase, uint8_t status);
+void mesh_app_provision_phase_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_provision_phase_set(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_provision_phase_stats_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Supply static OOB of the devices loaded by the MCU.
+ */
+uint8_t mesh_app_static_oob_get(uint8_t *p_uuid, uint8_t **p_oob);
+void mesh_app_static_oob_link_set(uint16_t server_addr, uint8_t *p_uuid);
+wiced_bool_t mesh_app_static_oob_request(uint16_t server_addr, uint8_t type);
+uint8_t mesh_app_process_static_oob_add(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_static_oob_stats_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Cache composition data of the nodes by product.
+ */
+void mesh_app_composition_cache_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_composition_cache_get(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_composition_cache_stats_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Index the models of each node from its composition data.
+ */
+void mesh_app_composition_index_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_composition_index_find(uint16_t node_addr, uint16_t company_id, uint16_t model_id, uint16_t *p_element_addrs, uint8_t max);
+uint8_t mesh_app_process_composition_model_find(uint8_t *p_data, uint32_t length);
+
+/*
+ * Execute config client commands on behalf of the application.
+ */
+wiced_bool_t mesh_app_config_cmd_check(uint16_t opcode);
+uint8_t mesh_app_config_cmd_execute(uint16_t opcode, uint8_t *p_data, uint32_t length);
+
+/*
+ * Send queued config client commands with a window of commands waiting for the status.
+ */
+void mesh_app_config_request_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_config_request_queue(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_config_request_set(uint8_t *p_data, uint32_t length);
+uint8_t mesh_app_process_config_request_stats_get(uint8_t *p_data, uint32_t length);
+
+/*
+ * Change subscription of the model on a list of nodes.
+ */
+wiced_bool_t mesh_app_config_subscription_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_config_subscription_fanout(uint8_t *p_data, uint32_t length);
+
+/*
+ * Execute key refresh procedure on a list of nodes.
+ */
+wiced_bool_t mesh_app_key_refresh_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_key_refresh_start(uint8_t *p_data, uint32_t length);
+
+#if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
+/*
+ * Retrieve complete provisioning records and keep them in the cache.
+ */
+wiced_bool_t mesh_app_provision_record_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data);
+uint8_t mesh_app_process_provision_record_fetch(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length);
+#endif
+
+#endif // MESH_PROVISION_CLIENT_H__
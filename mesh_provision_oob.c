@@ -0,0 +1,288 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file keeps the static OOB values of the devices loaded by the MCU before provisioning.
+ * The table is sorted by UUID. When a device requests the static OOB, the value is found with
+ * a binary search and supplied without the MCU. Requests of devices which are not in the table
+ * are sent to the MCU.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_PROVISION_OOB_MAX_ENTRIES      48      // Max number of devices in the table
+#define MESH_PROVISION_OOB_MAX_LEN          32      // Static OOB is 16 bytes, or 32 bytes for HMAC-SHA256
+#define MESH_PROVISION_OOB_MAX_LINKS        4       // Number of provisioning servers tracked at the same time
+
+// Flags of the static OOB add command
+#define MESH_PROVISION_OOB_FLAG_CLEAR       0x01    // Clear the table before adding the entries
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+    uint8_t     len;
+    uint8_t     oob[MESH_PROVISION_OOB_MAX_LEN];
+} mesh_provision_oob_entry_t;
+
+// UUID of the device connected through the provisioning server
+typedef struct
+{
+    uint16_t    server_addr;
+    uint8_t     uuid[MESH_DEVICE_UUID_LEN];
+} mesh_provision_oob_link_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static int mesh_provision_oob_search(uint8_t *p_uuid, wiced_bool_t *p_found);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static mesh_provision_oob_entry_t   mesh_provision_oob_table[MESH_PROVISION_OOB_MAX_ENTRIES];
+static uint8_t                      mesh_provision_oob_num_entries = 0;
+static mesh_provision_oob_link_t    mesh_provision_oob_links[MESH_PROVISION_OOB_MAX_LINKS];
+static uint8_t                      mesh_provision_oob_next_link = 0;
+
+// Counters of the requests answered from the table and sent to the MCU
+static uint32_t                     mesh_provision_oob_hits = 0;
+static uint32_t                     mesh_provision_oob_misses = 0;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Binary search of the UUID in the table. Returns the index of the entry if found, otherwise
+ * the index where the UUID should be inserted.
+ */
+int mesh_provision_oob_search(uint8_t *p_uuid, wiced_bool_t *p_found)
+{
+    int low = 0;
+    int high = mesh_provision_oob_num_entries - 1;
+    int mid, cmp;
+
+    while (low <= high)
+    {
+        mid = (low + high) / 2;
+        cmp = memcmp(p_uuid, mesh_provision_oob_table[mid].uuid, MESH_DEVICE_UUID_LEN);
+        if (cmp == 0)
+        {
+            *p_found = WICED_TRUE;
+            return mid;
+        }
+        if (cmp < 0)
+            high = mid - 1;
+        else
+            low = mid + 1;
+    }
+    *p_found = WICED_FALSE;
+    return low;
+}
+
+/*
+ * Find the static OOB of the device. Returns the length of the OOB, 0 if the device is not in
+ * the table.
+ */
+uint8_t mesh_app_static_oob_get(uint8_t *p_uuid, uint8_t **p_oob)
+{
+    wiced_bool_t found;
+    int index = mesh_provision_oob_search(p_uuid, &found);
+
+    if (!found)
+    {
+        mesh_provision_oob_misses++;
+        return 0;
+    }
+    mesh_provision_oob_hits++;
+    *p_oob = mesh_provision_oob_table[index].oob;
+    return mesh_provision_oob_table[index].len;
+}
+
+/*
+ * Save the UUID of the device connected through the provisioning server
+ */
+void mesh_app_static_oob_link_set(uint16_t server_addr, uint8_t *p_uuid)
+{
+    mesh_provision_oob_link_t *p_link = NULL;
+    uint8_t i;
+
+    for (i = 0; i < MESH_PROVISION_OOB_MAX_LINKS; i++)
+    {
+        if (mesh_provision_oob_links[i].server_addr == server_addr)
+            p_link = &mesh_provision_oob_links[i];
+    }
+    if (p_link == NULL)
+    {
+        p_link = &mesh_provision_oob_links[mesh_provision_oob_next_link];
+        mesh_provision_oob_next_link = (mesh_provision_oob_next_link + 1) % MESH_PROVISION_OOB_MAX_LINKS;
+    }
+    p_link->server_addr = server_addr;
+    memcpy(p_link->uuid, p_uuid, MESH_DEVICE_UUID_LEN);
+}
+
+/*
+ * Supply the static OOB requested by the device connected through the provisioning server.
+ * Returns WICED_FALSE if the request should be sent to the MCU.
+ */
+wiced_bool_t mesh_app_static_oob_request(uint16_t server_addr, uint8_t type)
+{
+    wiced_bt_mesh_event_t *p_event;
+    uint8_t *p_oob;
+    uint8_t len;
+    uint8_t i;
+
+    if ((type != WICED_BT_MESH_PROVISION_GET_OOB_TYPE_ENTER_STATIC) || (mesh_provision_oob_num_entries == 0))
+        return WICED_FALSE;
+
+    for (i = 0; i < MESH_PROVISION_OOB_MAX_LINKS; i++)
+    {
+        if ((mesh_provision_oob_links[i].server_addr == server_addr) &&
+            ((len = mesh_app_static_oob_get(mesh_provision_oob_links[i].uuid, &p_oob)) != 0))
+            break;
+    }
+    if ((i == MESH_PROVISION_OOB_MAX_LINKS) ||
+        ((p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, server_addr, 0)) == NULL) ||
+        !wiced_bt_mesh_provision_client_set_oob(p_event, p_oob, len))
+        return WICED_FALSE;
+
+    mesh_app_provision_phase(server_addr, MESH_APP_PROVISION_PHASE_OOB_VALUE, 0);
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to add static OOB values to the table. The command contains flags
+ * (1 byte) followed by the entries. Each entry has the UUID (16 bytes), OOB length (1 byte) and
+ * the OOB. An entry with the UUID already in the table replaces it. All entries are checked
+ * first, so the table is not changed if the command is rejected.
+ */
+uint8_t mesh_app_process_static_oob_add(uint8_t *p_data, uint32_t length)
+{
+    mesh_provision_oob_entry_t *p_entry;
+    wiced_bool_t found;
+    uint8_t flags;
+    uint8_t len;
+    uint8_t *p;
+    uint32_t remaining;
+    uint32_t num_new = 0;
+    int index;
+
+    STREAM_TO_UINT8(flags, p_data);
+    length--;
+
+    p         = p_data;
+    remaining = length;
+    while (remaining != 0)
+    {
+        if ((remaining < MESH_DEVICE_UUID_LEN + 1) || ((len = p[MESH_DEVICE_UUID_LEN]) > MESH_PROVISION_OOB_MAX_LEN) ||
+            (remaining < MESH_DEVICE_UUID_LEN + 1 + (uint32_t)len))
+            return HCI_CONTROL_MESH_STATUS_INVALID_LENGTH;
+
+        // UUID repeated in the command is counted more than once
+        found = WICED_FALSE;
+        if (!(flags & MESH_PROVISION_OOB_FLAG_CLEAR))
+            mesh_provision_oob_search(p, &found);
+        if (!found)
+            num_new++;
+
+        p         += MESH_DEVICE_UUID_LEN + 1 + len;
+        remaining -= MESH_DEVICE_UUID_LEN + 1 + len;
+    }
+    if (((flags & MESH_PROVISION_OOB_FLAG_CLEAR) ? 0 : mesh_provision_oob_num_entries) + num_new > MESH_PROVISION_OOB_MAX_ENTRIES)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    if (flags & MESH_PROVISION_OOB_FLAG_CLEAR)
+        mesh_provision_oob_num_entries = 0;
+
+    while (length != 0)
+    {
+        len   = p_data[MESH_DEVICE_UUID_LEN];
+        index = mesh_provision_oob_search(p_data, &found);
+        if (!found)
+        {
+            memmove(&mesh_provision_oob_table[index + 1], &mesh_provision_oob_table[index],
+                    (mesh_provision_oob_num_entries - index) * sizeof(mesh_provision_oob_entry_t));
+            mesh_provision_oob_num_entries++;
+        }
+        p_entry = &mesh_provision_oob_table[index];
+        STREAM_TO_ARRAY(p_entry->uuid, p_data, MESH_DEVICE_UUID_LEN);
+        STREAM_TO_UINT8(p_entry->len, p_data);
+        STREAM_TO_ARRAY(p_entry->oob, p_data, len);
+        length -= MESH_DEVICE_UUID_LEN + 1 + len;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the number of entries and the hit and miss counters, and to
+ * reset the counters if requested
+ */
+uint8_t mesh_app_process_static_oob_stats_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, mesh_provision_oob_num_entries);
+    UINT32_TO_STREAM(p, mesh_provision_oob_hits);
+    UINT32_TO_STREAM(p, mesh_provision_oob_misses);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_STATIC_OOB_STATS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (p_data[0] != 0)
+    {
+        mesh_provision_oob_hits   = 0;
+        mesh_provision_oob_misses = 0;
+    }
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file reports the phases of the provisioning to the MCU with the time when each phase was
+ * reached, and collects the time spent in each phase. The phases are the steps visible to the
+ * application: connect, link status, capabilities, start, OOB request, OOB value and end. The
+ * time between start and end includes the public key exchange, which is done by the mesh core.
+ */
+
+#ifdef HCI_CONTROL
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_PROVISION_PHASE_MAX_LINKS      4       // Number of provisioning servers tracked at the same time
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint16_t    server_addr;                // 0 if the entry is not used
+    uint8_t     phase;                      // Last phase reached
+    uint32_t    timestamp;                  // Time when the last phase was reached. Value is milliseconds.
+} mesh_provision_phase_link_t;
+
+typedef struct
+{
+    uint16_t    count;
+    uint32_t    total_ms;
+    uint32_t    max_ms;
+} mesh_provision_phase_stats_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static mesh_provision_phase_link_t *mesh_provision_phase_link_get(uint16_t server_addr, uint8_t phase);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static wiced_bool_t                 mesh_provision_phase_events = WICED_FALSE;
+static mesh_provision_phase_link_t  mesh_provision_phase_links[MESH_PROVISION_PHASE_MAX_LINKS];
+static mesh_provision_phase_stats_t mesh_provision_phase_stats[MESH_APP_PROVISION_NUM_PHASES];
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * Find the provisioning link of the server. A new link is started by the connect phase and
+ * takes the entry with the oldest phase change.
+ */
+mesh_provision_phase_link_t *mesh_provision_phase_link_get(uint16_t server_addr, uint8_t phase)
+{
+    mesh_provision_phase_link_t *p_oldest = &mesh_provision_phase_links[0];
+    uint8_t i;
+
+    for (i = 0; i < MESH_PROVISION_PHASE_MAX_LINKS; i++)
+    {
+        if (mesh_provision_phase_links[i].server_addr == server_addr)
+            return &mesh_provision_phase_links[i];
+        if ((mesh_provision_phase_links[i].server_addr == 0) ||
+            ((p_oldest->server_addr != 0) && (mesh_provision_phase_links[i].timestamp < p_oldest->timestamp)))
+            p_oldest = &mesh_provision_phase_links[i];
+    }
+    if (phase != MESH_APP_PROVISION_PHASE_CONNECT)
+        return NULL;
+
+    p_oldest->server_addr = server_addr;
+    return p_oldest;
+}
+
+/*
+ * Record the phase of the provisioning through the server. The time since the previous phase
+ * is counted for this phase, and the event is sent to the MCU if enabled.
+ */
+void mesh_app_provision_phase(uint16_t server_addr, uint8_t phase, uint8_t status)
+{
+    mesh_provision_phase_link_t *p_link;
+    mesh_provision_phase_stats_t *p_stats = &mesh_provision_phase_stats[phase];
+    uint32_t now = (uint32_t)wiced_bt_mesh_core_get_tick_count();
+    uint32_t elapsed = 0;
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    if ((p_link = mesh_provision_phase_link_get(server_addr, phase)) == NULL)
+        return;
+
+    if (phase != MESH_APP_PROVISION_PHASE_CONNECT)
+    {
+        elapsed = now - p_link->timestamp;
+        if (p_stats->count != 0xFFFF)
+            p_stats->count++;
+        p_stats->total_ms += elapsed;
+        if (elapsed > p_stats->max_ms)
+            p_stats->max_ms = elapsed;
+    }
+    p_link->phase     = phase;
+    p_link->timestamp = now;
+
+    if (!mesh_provision_phase_events || ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL))
+        return;
+
+    p = p_buffer;
+    UINT16_TO_STREAM(p, server_addr);
+    UINT8_TO_STREAM(p, phase);
+    UINT8_TO_STREAM(p, status);
+    UINT32_TO_STREAM(p, now);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Record the phases reported by the provisioning events of the mesh core
+ */
+void mesh_app_provision_phase_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    switch (event)
+    {
+    case WICED_BT_MESH_PROVISION_LINK_STATUS:
+        mesh_app_provision_phase(p_event->src, MESH_APP_PROVISION_PHASE_LINK, ((wiced_bt_mesh_provision_link_status_data_t *)p_data)->status);
+        break;
+    case WICED_BT_MESH_PROVISION_LINK_REPORT:
+        mesh_app_provision_phase(p_event->src, MESH_APP_PROVISION_PHASE_LINK, ((wiced_bt_mesh_provision_link_report_data_t *)p_data)->rpr_state);
+        break;
+    case WICED_BT_MESH_PROVISION_DEVICE_CAPABILITIES:
+        mesh_app_provision_phase(p_event->src, MESH_APP_PROVISION_PHASE_CAPABILITIES, ((wiced_bt_mesh_provision_device_capabilities_data_t *)p_data)->elements_num);
+        break;
+    case WICED_BT_MESH_PROVISION_GET_OOB_DATA:
+        mesh_app_provision_phase(p_event->src, MESH_APP_PROVISION_PHASE_OOB_REQUEST, ((wiced_bt_mesh_provision_device_oob_request_data_t *)p_data)->type);
+        break;
+    case WICED_BT_MESH_PROVISION_END:
+        mesh_app_provision_phase(p_event->src, MESH_APP_PROVISION_PHASE_END, ((wiced_bt_mesh_provision_status_data_t *)p_data)->result);
+        break;
+    }
+}
+
+/*
+ * Process command from MCU to enable or disable the provisioning phase events
+ */
+uint8_t mesh_app_process_provision_phase_set(uint8_t *p_data, uint32_t length)
+{
+    mesh_provision_phase_events = (p_data[0] != 0);
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+/*
+ * Process command from MCU to get the time spent in each phase, and to reset it if requested.
+ * For each phase the number of times it was reached, the total and the max time since the
+ * previous phase are sent.
+ */
+uint8_t mesh_app_process_provision_phase_stats_get(uint8_t *p_data, uint32_t length)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+    uint8_t reset;
+    uint8_t i;
+
+    STREAM_TO_UINT8(reset, p_data);
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, MESH_APP_PROVISION_NUM_PHASES);
+    for (i = 0; i < MESH_APP_PROVISION_NUM_PHASES; i++)
+    {
+        UINT16_TO_STREAM(p, mesh_provision_phase_stats[i].count);
+        UINT32_TO_STREAM(p, mesh_provision_phase_stats[i].total_ms);
+        UINT32_TO_STREAM(p, mesh_provision_phase_stats[i].max_ms);
+    }
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_PHASE_STATS, p_buffer, (uint16_t)(p - p_buffer));
+
+    if (reset)
+        memset(mesh_provision_phase_stats, 0, sizeof(mesh_provision_phase_stats));
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // HCI_CONTROL
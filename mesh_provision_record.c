@@ -0,0 +1,370 @@
+/*
+ * Copyright 2016-2023, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/** @file
+ *
+ *
+ * This file retrieves provisioning records of the certificate-based provisioning without the MCU
+ * requesting each fragment. Fragments are requested one after another as soon as the previous
+ * one is received and are sent to the MCU as they arrive. Complete records are kept in a small
+ * cache, so that records shared by devices of the same product, such as intermediate
+ * certificates, are sent from the cache without being retrieved again. Record ID, offset and
+ * length are sent in the big endian order, as in the provisioning record get command.
+ */
+
+#ifdef HCI_CONTROL
+#if defined(CERTIFICATE_BASED_PROVISIONING_SUPPORTED)
+
+#include "wiced_bt_trace.h"
+#include "wiced_transport.h"
+#include "wiced_timer.h"
+#include "wiced_bt_mesh_app.h"
+#include "wiced_bt_mesh_provision.h"
+#include "hci_control_api.h"
+#include "mesh_provision_client.h"
+
+/******************************************************
+ *          Constants
+ ******************************************************/
+#define MESH_PROVISION_RECORD_ARENA_SIZE    2048    // Memory for the cached records
+#define MESH_PROVISION_RECORD_MAX_ENTRIES   8       // Max number of cached records
+#define MESH_PROVISION_RECORD_CHUNK_LEN     128     // Max data in one event sent from the cache
+#define MESH_PROVISION_RECORD_TIMEOUT       10      // Seconds to wait for each fragment
+
+// Status of the record data event for errors detected by the application
+#define MESH_PROVISION_RECORD_STATUS_TIMEOUT 0xFF   // Device did not reply with the fragment
+
+/******************************************************
+ *          Structures
+ ******************************************************/
+typedef struct
+{
+    uint32_t    key;                        // Hash of the UUID prefix and record ID, 0 if the entry is not used
+    uint16_t    offset;                     // Offset of the record in the arena
+    uint16_t    len;
+    uint16_t    received;                   // Bytes received while the record is retrieved
+    uint16_t    record_id;
+    uint32_t    last_used;                  // Value of the use counter when the record was last sent
+} mesh_provision_record_entry_t;
+
+/******************************************************
+ *          Function Prototypes
+ ******************************************************/
+static uint32_t mesh_provision_record_key(uint8_t *p_uuid, uint8_t key_len, uint16_t record_id);
+static mesh_provision_record_entry_t *mesh_provision_record_find(uint32_t key);
+static mesh_provision_record_entry_t *mesh_provision_record_alloc(uint32_t key, uint16_t record_id, uint16_t len);
+static void mesh_provision_record_send(uint8_t status, uint16_t record_id, uint16_t offset, uint16_t total_len, uint8_t *p_data, uint16_t len);
+static wiced_bool_t mesh_provision_record_request(wiced_bt_mesh_event_t *p_event);
+static void mesh_provision_record_stop(void);
+static void mesh_provision_record_timer_callback(TIMER_PARAM_TYPE arg);
+
+/******************************************************
+ *          Variables Definitions
+ ******************************************************/
+extern wiced_transport_buffer_pool_t* host_trans_pool;
+
+static uint8_t                          mesh_provision_record_arena[MESH_PROVISION_RECORD_ARENA_SIZE];
+static mesh_provision_record_entry_t    mesh_provision_record_cache[MESH_PROVISION_RECORD_MAX_ENTRIES];
+static uint32_t                         mesh_provision_record_use_count = 0;
+
+// Record being retrieved
+static wiced_bool_t                     mesh_provision_record_active = WICED_FALSE;
+static uint16_t                         mesh_provision_record_dst;
+static uint16_t                         mesh_provision_record_id;
+static uint16_t                         mesh_provision_record_offset;
+static uint16_t                         mesh_provision_record_fragment_size;
+static uint32_t                         mesh_provision_record_cache_key;
+static mesh_provision_record_entry_t    *p_mesh_provision_record_entry;
+static wiced_timer_t                    mesh_provision_record_timer;
+static wiced_bool_t                     mesh_provision_record_timer_ready = WICED_FALSE;
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/*
+ * FNV-1a hash of the first key_len bytes of the UUID and the record ID. 0 is not used as a key.
+ */
+uint32_t mesh_provision_record_key(uint8_t *p_uuid, uint8_t key_len, uint16_t record_id)
+{
+    uint32_t hash = 2166136261u;
+    uint8_t  i;
+
+    for (i = 0; i < key_len; i++)
+        hash = (hash ^ p_uuid[i]) * 16777619u;
+    hash = (hash ^ (record_id & 0xFF)) * 16777619u;
+    hash = (hash ^ (record_id >> 8)) * 16777619u;
+    return (hash == 0) ? 1 : hash;
+}
+
+/*
+ * Find the complete record in the cache
+ */
+mesh_provision_record_entry_t *mesh_provision_record_find(uint32_t key)
+{
+    uint8_t i;
+
+    for (i = 0; i < MESH_PROVISION_RECORD_MAX_ENTRIES; i++)
+    {
+        if ((mesh_provision_record_cache[i].key == key) && (mesh_provision_record_cache[i].received == mesh_provision_record_cache[i].len))
+            return &mesh_provision_record_cache[i];
+    }
+    return NULL;
+}
+
+/*
+ * Allocate space for the record in the arena. Least recently used records are dropped until
+ * there is enough space, and the remaining records are moved to the start of the arena.
+ */
+mesh_provision_record_entry_t *mesh_provision_record_alloc(uint32_t key, uint16_t record_id, uint16_t len)
+{
+    mesh_provision_record_entry_t *p_entry, *p_lru, *p_free;
+    uint16_t used;
+    uint8_t  i, j;
+
+    if (len > MESH_PROVISION_RECORD_ARENA_SIZE)
+        return NULL;
+
+    while (1)
+    {
+        used   = 0;
+        p_lru  = NULL;
+        p_free = NULL;
+        for (i = 0; i < MESH_PROVISION_RECORD_MAX_ENTRIES; i++)
+        {
+            p_entry = &mesh_provision_record_cache[i];
+            if (p_entry->key == 0)
+            {
+                p_free = p_entry;
+                continue;
+            }
+            used += p_entry->len;
+            if ((p_lru == NULL) || (p_entry->last_used < p_lru->last_used))
+                p_lru = p_entry;
+        }
+        if ((p_free != NULL) && (used + len <= MESH_PROVISION_RECORD_ARENA_SIZE))
+            break;
+        p_lru->key = 0;
+    }
+
+    // Compact the arena in the order of the offsets
+    used = 0;
+    for (i = 0; i < MESH_PROVISION_RECORD_MAX_ENTRIES; i++)
+    {
+        p_lru = NULL;
+        for (j = 0; j < MESH_PROVISION_RECORD_MAX_ENTRIES; j++)
+        {
+            p_entry = &mesh_provision_record_cache[j];
+            if ((p_entry->key != 0) && (p_entry->offset >= used) && ((p_lru == NULL) || (p_entry->offset < p_lru->offset)))
+                p_lru = p_entry;
+        }
+        if (p_lru == NULL)
+            break;
+        memmove(&mesh_provision_record_arena[used], &mesh_provision_record_arena[p_lru->offset], p_lru->len);
+        p_lru->offset = used;
+        used += p_lru->len;
+    }
+    p_free->key       = key;
+    p_free->record_id = record_id;
+    p_free->offset    = used;
+    p_free->len       = len;
+    p_free->received  = 0;
+    p_free->last_used = ++mesh_provision_record_use_count;
+    return p_free;
+}
+
+/*
+ * Send part of the record to the MCU
+ */
+void mesh_provision_record_send(uint8_t status, uint16_t record_id, uint16_t offset, uint16_t total_len, uint8_t *p_data, uint16_t len)
+{
+    uint8_t *p_buffer;
+    uint8_t *p;
+
+    if ((p_buffer = wiced_transport_allocate_buffer(host_trans_pool)) == NULL)
+        return;
+
+    p = p_buffer;
+    UINT8_TO_STREAM(p, status);
+    UINT16_TO_BE_STREAM(p, record_id);
+    UINT16_TO_BE_STREAM(p, offset);
+    UINT16_TO_BE_STREAM(p, total_len);
+    ARRAY_TO_STREAM(p, p_data, len);
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_PROVISION_RECORD_DATA, p_buffer, (uint16_t)(p - p_buffer));
+}
+
+/*
+ * Request the next fragment of the record from the device
+ */
+wiced_bool_t mesh_provision_record_request(wiced_bt_mesh_event_t *p_event)
+{
+    wiced_bt_mesh_provision_device_record_fragment_data_t data;
+
+    if ((p_event == NULL) &&
+        ((p_event = wiced_bt_mesh_create_event(0, MESH_COMPANY_ID_BT_SIG, WICED_BT_MESH_CORE_MODEL_ID_CONFIG_CLNT, mesh_provision_record_dst, 0)) == NULL))
+        return WICED_FALSE;
+
+    data.record_id       = mesh_provision_record_id;
+    data.fragment_offset = mesh_provision_record_offset;
+    data.total_length    = mesh_provision_record_fragment_size;
+    if (!wiced_bt_mesh_provision_retrieve_record(p_event, &data))
+        return WICED_FALSE;
+
+    wiced_start_timer(&mesh_provision_record_timer, MESH_PROVISION_RECORD_TIMEOUT * 1000);
+    return WICED_TRUE;
+}
+
+/*
+ * Stop retrieving the record. Partially received record is dropped from the cache.
+ */
+void mesh_provision_record_stop(void)
+{
+    if (wiced_is_timer_in_use(&mesh_provision_record_timer))
+        wiced_stop_timer(&mesh_provision_record_timer);
+
+    if ((p_mesh_provision_record_entry != NULL) && (p_mesh_provision_record_entry->received != p_mesh_provision_record_entry->len))
+        p_mesh_provision_record_entry->key = 0;
+    mesh_provision_record_active = WICED_FALSE;
+}
+
+/*
+ * Device did not reply with the fragment, report the error to the MCU
+ */
+void mesh_provision_record_timer_callback(TIMER_PARAM_TYPE arg)
+{
+    if (!mesh_provision_record_active)
+        return;
+
+    WICED_BT_TRACE("record:%d timeout offset:%d\n", mesh_provision_record_id, mesh_provision_record_offset);
+    mesh_provision_record_send(MESH_PROVISION_RECORD_STATUS_TIMEOUT, mesh_provision_record_id, mesh_provision_record_offset, 0, NULL, 0);
+    mesh_provision_record_stop();
+}
+
+/*
+ * Process fragment of the record received from the device. Returns WICED_TRUE if the fragment
+ * belongs to the record retrieved by the application and should not be sent to the MCU.
+ */
+wiced_bool_t mesh_app_provision_record_event(uint16_t event, wiced_bt_mesh_event_t *p_event, void *p_data)
+{
+    wiced_bt_mesh_core_provisioning_record_t *p_record = (wiced_bt_mesh_core_provisioning_record_t *)p_data;
+    uint16_t total_len;
+
+    if (!mesh_provision_record_active || (event != WICED_BT_MESH_DEVICE_PROVISIONING_RECORD_RESP) ||
+        (p_event->src != mesh_provision_record_dst) || (p_record->u.response.record_id != mesh_provision_record_id))
+        return WICED_FALSE;
+
+    total_len = p_record->u.response.total_length;
+    mesh_provision_record_send(p_record->status, mesh_provision_record_id, mesh_provision_record_offset, total_len, p_record->data, p_record->size);
+
+    if ((p_record->status != 0) || (p_record->size == 0))
+    {
+        mesh_provision_record_stop();
+        return WICED_TRUE;
+    }
+
+    // Space in the cache is allocated when the size of the record is known
+    if ((mesh_provision_record_offset == 0) && (mesh_provision_record_cache_key != 0))
+        p_mesh_provision_record_entry = mesh_provision_record_alloc(mesh_provision_record_cache_key, mesh_provision_record_id, total_len);
+
+    if ((p_mesh_provision_record_entry != NULL) && (mesh_provision_record_offset + p_record->size <= p_mesh_provision_record_entry->len))
+    {
+        memcpy(&mesh_provision_record_arena[p_mesh_provision_record_entry->offset + mesh_provision_record_offset], p_record->data, p_record->size);
+        p_mesh_provision_record_entry->received = mesh_provision_record_offset + p_record->size;
+    }
+    mesh_provision_record_offset += p_record->size;
+
+    if ((mesh_provision_record_offset >= total_len) || !mesh_provision_record_request(NULL))
+        mesh_provision_record_stop();
+    return WICED_TRUE;
+}
+
+/*
+ * Process command from MCU to retrieve a complete provisioning record. The command contains
+ * record ID (2 bytes), max fragment size (2 bytes), device UUID (16 bytes) and the number of UUID
+ * bytes shared by the devices with the same record (1 byte). 0 disables the cache. The record
+ * is sent in one or more record data events. The command fails while another record is retrieved.
+ */
+uint8_t mesh_app_process_provision_record_fetch(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t length)
+{
+    mesh_provision_record_entry_t *p_entry;
+    uint8_t  uuid[MESH_DEVICE_UUID_LEN];
+    uint8_t  key_len;
+    uint16_t record_id, fragment_size;
+    uint16_t offset, len;
+
+    BE_STREAM_TO_UINT16(record_id, p_data);
+    BE_STREAM_TO_UINT16(fragment_size, p_data);
+    STREAM_TO_ARRAY(uuid, p_data, MESH_DEVICE_UUID_LEN);
+    STREAM_TO_UINT8(key_len, p_data);
+
+    if (mesh_provision_record_active)
+    {
+        wiced_bt_mesh_release_event(p_event);
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+    }
+    if (!mesh_provision_record_timer_ready)
+    {
+        wiced_init_timer(&mesh_provision_record_timer, mesh_provision_record_timer_callback, 0, WICED_MILLI_SECONDS_TIMER);
+        mesh_provision_record_timer_ready = WICED_TRUE;
+    }
+    mesh_provision_record_id            = record_id;
+    mesh_provision_record_fragment_size = fragment_size;
+    mesh_provision_record_cache_key = (key_len == 0) ? 0 :
+        mesh_provision_record_key(uuid, (key_len > MESH_DEVICE_UUID_LEN) ? MESH_DEVICE_UUID_LEN : key_len, mesh_provision_record_id);
+
+    if ((mesh_provision_record_cache_key != 0) && ((p_entry = mesh_provision_record_find(mesh_provision_record_cache_key)) != NULL))
+    {
+        WICED_BT_TRACE("record:%d from cache len:%d\n", mesh_provision_record_id, p_entry->len);
+        wiced_bt_mesh_release_event(p_event);
+
+        p_entry->last_used = ++mesh_provision_record_use_count;
+        for (offset = 0; offset < p_entry->len; offset += len)
+        {
+            len = p_entry->len - offset;
+            if (len > MESH_PROVISION_RECORD_CHUNK_LEN)
+                len = MESH_PROVISION_RECORD_CHUNK_LEN;
+            mesh_provision_record_send(0, mesh_provision_record_id, offset, p_entry->len, &mesh_provision_record_arena[p_entry->offset + offset], len);
+        }
+        return HCI_CONTROL_MESH_STATUS_SUCCESS;
+    }
+    mesh_provision_record_dst     = p_event->dst;
+    mesh_provision_record_offset  = 0;
+    p_mesh_provision_record_entry = NULL;
+    if (!mesh_provision_record_request(p_event))
+        return HCI_CONTROL_MESH_STATUS_ERROR;
+
+    mesh_provision_record_active = WICED_TRUE;
+    return HCI_CONTROL_MESH_STATUS_SUCCESS;
+}
+
+#endif // CERTIFICATE_BASED_PROVISIONING_SUPPORTED
+#endif // HCI_CONTROL
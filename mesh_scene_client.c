@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Constants
@@ -96,15 +97,15 @@ void mesh_scene_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
-            wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
+            mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
     case WICED_BT_MESH_SCENE_REGISTER_STATUS:
         p_register_status = (wiced_bt_mesh_scene_register_status_data_t *)p_data;
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_scene_hci_register_status_event_send(p_hci_event, p_register_status);
 #endif
         break;
@@ -112,7 +113,7 @@ void mesh_scene_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_
     case WICED_BT_MESH_SCENE_STATUS:
         p_scene_status = (wiced_bt_mesh_scene_status_data_t *)p_data;
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_scene_hci_status_event_send(p_hci_event, p_scene_status);
 #endif
         break;
@@ -174,6 +175,22 @@ uint32_t mesh_scene_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_scene_client_proc_rx_cmd
+ */
+static const uint16_t mesh_scene_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_SCENE_STORE,
+    HCI_CONTROL_MESH_COMMAND_SCENE_RECALL,
+    HCI_CONTROL_MESH_COMMAND_SCENE_GET,
+    HCI_CONTROL_MESH_COMMAND_SCENE_REGISTER_GET,
+    HCI_CONTROL_MESH_COMMAND_SCENE_DELETE,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_scene_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_SCENE_CLNT, mesh_scene_client_hci_opcodes, mesh_scene_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Scene Store command
  */
@@ -258,7 +275,7 @@ void mesh_scene_hci_register_status_event_send(wiced_bt_mesh_hci_event_t *p_hci_
     for (i = 0; i < p_data->scene_num; i++)
         UINT16_TO_STREAM(p, p_data->scene[i]);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SCENE_REGISTER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SCENE_REGISTER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -273,7 +290,7 @@ void mesh_scene_hci_status_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wi
     UINT16_TO_STREAM(p, p_data->target_scene);
     UINT32_TO_STREAM(p, p_data->remaining_time);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SCENE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SCENE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
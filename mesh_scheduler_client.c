@@ -48,6 +48,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Function Prototypes
@@ -71,7 +72,7 @@ void mesh_scheduler_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     wiced_bt_mesh_scheduler_status_t      *p_scheduler_status;
     wiced_bt_mesh_scheduler_action_data_t *p_scheduler_action_status;
 #if defined HCI_CONTROL
-    wiced_bt_mesh_hci_event_t *p_hci_event = wiced_bt_mesh_create_hci_event(p_event);
+    wiced_bt_mesh_hci_event_t *p_hci_event = mesh_app_create_hci_event(p_event);
     if (p_hci_event == NULL)
         return;
 #endif
@@ -83,7 +84,7 @@ void mesh_scheduler_client_message_handler(uint16_t event, wiced_bt_mesh_event_t
     case WICED_BT_MESH_TX_COMPLETE:
         WICED_BT_TRACE("tx complete status:%d\n", p_event->status.tx_flag);
 #if defined HCI_CONTROL
-        wiced_bt_mesh_send_hci_tx_complete(p_hci_event, p_event);
+        mesh_app_send_hci_tx_complete(p_hci_event, p_event);
 #endif
         break;
 
@@ -151,6 +152,20 @@ uint32_t mesh_scheduler_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uin
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_scheduler_client_proc_rx_cmd
+ */
+static const uint16_t mesh_scheduler_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_SCHEDULER_GET,
+    HCI_CONTROL_MESH_COMMAND_SCHEDULER_ACTION_GET,
+    HCI_CONTROL_MESH_COMMAND_SCHEDULER_ACTION_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_scheduler_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_SCHEDULER_CLNT, mesh_scheduler_client_hci_opcodes, mesh_scheduler_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Scheduler Get command
  */
@@ -199,12 +214,11 @@ void mesh_scheduler_action_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data,
  */
 void mesh_scheduler_hci_scheduler_status_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_scheduler_status_t *p_data)
 {
-    int i;
     uint8_t *p = p_hci_event->data;
 
     UINT16_TO_STREAM(p, p_data->actions);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SCHEDULER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SCHEDULER_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -226,7 +240,7 @@ void mesh_scheduler_hci_scheduler_action_status_event_send(wiced_bt_mesh_hci_eve
     UINT32_TO_STREAM(p, p_data->transition_time);
     UINT16_TO_STREAM(p, p_data->scene_number);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SCHEDULER_ACTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SCHEDULER_ACTION_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
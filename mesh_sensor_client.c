@@ -49,6 +49,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Constants
@@ -106,59 +107,38 @@ void mesh_sensor_client_message_handler(uint16_t event, wiced_bt_mesh_event_t* p
 
 #if defined HCI_CONTROL
     case WICED_BT_MESH_SENSOR_DESCRIPTOR_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_desc_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_descriptor_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_data_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_COLUMN_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_column_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_column_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_SERIES_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_series_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_series_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_CADENCE_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_cadence_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_cadence_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_SETTINGS_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_settings_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_settings_status_data_t*)p_data);
-        }
         break;
 
     case WICED_BT_MESH_SENSOR_SETTING_STATUS:
-        if ((p_hci_event = wiced_bt_mesh_alloc_hci_event(p_event->element_idx)) != NULL)
-        {
-            p_hci_event->src = p_event->src;
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_sensor_setting_hci_event_send(p_hci_event, (wiced_bt_mesh_sensor_setting_status_data_t*)p_data);
-        }
         break;
 #endif
     default:
@@ -244,6 +224,26 @@ uint32_t mesh_sensor_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_sensor_client_proc_rx_cmd
+ */
+static const uint16_t mesh_sensor_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_SENSOR_DESCRIPTOR_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_COLUMN_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_SERIES_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_CADENCE_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_CADENCE_SET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_SETTING_GET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_SETTING_SET,
+    HCI_CONTROL_MESH_COMMAND_SENSOR_SETTINGS_GET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_sensor_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_SENSOR_CLNT, mesh_sensor_client_hci_opcodes, mesh_sensor_client_proc_rx_cmd);
+#endif
+
 /*
  * Send sensor descriptor get command
  */
@@ -466,7 +466,7 @@ void mesh_sensor_desc_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wic
         WICED_BT_TRACE("mesh_sensor_desc_get : no descriptor present for property ID\n");
     }
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_DESCRIPTOR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_DESCRIPTOR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -475,7 +475,7 @@ void mesh_sensor_desc_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wic
 void mesh_sensor_data_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_sensor_status_data_t *p_data)
 {
     uint8_t *p = p_hci_event->data;
-    int i, j;
+    int j;
 
     WICED_BT_TRACE("property_id:%04x\n", p_data->property_id);
     WICED_BT_TRACE("prop_value_len:%d\n", p_data->prop_value_len);
@@ -490,7 +490,7 @@ void mesh_sensor_data_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wic
     memcpy(p, p_data->raw_value, p_data->prop_value_len);
     p = p + p_data->prop_value_len;
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -520,7 +520,7 @@ void mesh_sensor_column_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, w
     for (i = 0; i < p_data->prop_value_len; i++)
            WICED_BT_TRACE(" %x ",p_data->column_data.raw_valuey[i]);
     WICED_BT_TRACE("\n ------------------------ \n");
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_COLUMN_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_COLUMN_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -529,9 +529,9 @@ void mesh_sensor_column_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, w
 void mesh_sensor_series_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_sensor_series_status_data_t *p_data)
 {
     uint8_t *p = p_hci_event->data;
-    int i, j;
+    int i;
 
-    WICED_BT_TRACE(" property_id:%x val_len:%x no_columns:%x\n",p_data->property_id, p_data->prop_value_len, p_data->no_of_columns);
+    MESH_BIN_TRACE(SENSOR, MESH_BIN_TRACE_LEVEL_DEBUG, MESH_BIN_TRACE_ID_SENSOR_SERIES, p_data->property_id, p_data->prop_value_len, p_data->no_of_columns);
 
     UINT16_TO_STREAM(p, p_data->property_id);
     UINT8_TO_STREAM(p, p_data->prop_value_len);
@@ -542,18 +542,8 @@ void mesh_sensor_series_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, w
         ARRAY_TO_STREAM(p, p_data->column_list->raw_valuex, p_data->prop_value_len);
         ARRAY_TO_STREAM(p, p_data->column_list->column_width, p_data->prop_value_len);
         ARRAY_TO_STREAM(p, p_data->column_list->raw_valuey, p_data->prop_value_len);
-
-        WICED_BT_TRACE("\n -----RAW VAL X\n");
-        for (j=0; j <  p_data->prop_value_len; j++)
-            WICED_BT_TRACE(" %x ", p_data->column_list[i].raw_valuex[j]);
-        WICED_BT_TRACE("\n -----COL WIDTH\n");
-        for (j=0; j < p_data->prop_value_len; j++)
-               WICED_BT_TRACE(" %x ", p_data->column_list[i].column_width[j]);
-        WICED_BT_TRACE("\n -----RAW VAL Y\n");
-        for (j=0; j < p_data->prop_value_len; j++)
-               WICED_BT_TRACE(" %x ", p_data->column_list[i].raw_valuey[j]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SERIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SERIES_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -585,7 +575,7 @@ void mesh_sensor_cadence_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
         UINT32_TO_STREAM(p, cadence_status->cadence_data.fast_cadence_low);
         UINT32_TO_STREAM(p, cadence_status->cadence_data.fast_cadence_high);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_CADENCE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_CADENCE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -610,7 +600,7 @@ void mesh_sensor_setting_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
         WICED_BT_TRACE(" %x ",p_data->setting.val[i]);
 
     WICED_BT_TRACE("\n");
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SETTING_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SETTING_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -629,7 +619,7 @@ void mesh_sensor_settings_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event,
         UINT16_TO_STREAM(p, p_data->setting_property_id_list[i]);
         WICED_BT_TRACE(" %x ", p_data->setting_property_id_list[i]);
     }
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SETTINGS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_SENSOR_SETTINGS_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 #endif
@@ -50,6 +50,13 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
+
+// Payload length of the set commands
+#define MESH_TIME_SET_LEN                   11
+#define MESH_TIME_ZONE_SET_LEN              6
+#define MESH_TIME_TAI_UTC_DELTA_SET_LEN     7
+#define MESH_TIME_ROLE_SET_LEN              1
 
 /******************************************************
  *          Function Prototypes
@@ -69,7 +76,6 @@ static void mesh_time_zone_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hc
 static void mesh_time_tai_utc_delta_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_time_tai_utc_delta_status_t *p_time_delta_status);
 static void mesh_time_role_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wiced_bt_mesh_time_role_msg_t *p_role_status);
 
-
 /******************************************************
  *               Function Definitions
  ******************************************************/
@@ -87,28 +93,28 @@ void mesh_time_client_message_handler(uint16_t event, wiced_bt_mesh_event_t *p_e
     {
     case WICED_BT_MESH_TIME_STATUS:
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_time_status_hci_event_send(p_hci_event, (wiced_bt_mesh_time_state_msg_t *)p_data);
 #endif
         break;
 
     case WICED_BT_MESH_TIME_ZONE_STATUS:
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_time_zone_status_hci_event_send(p_hci_event, (wiced_bt_mesh_time_zone_status_t *)p_data);
 #endif
         break;
 
     case WICED_BT_MESH_TAI_UTC_DELTA_STATUS:
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_time_tai_utc_delta_status_hci_event_send(p_hci_event, (wiced_bt_mesh_time_tai_utc_delta_status_t *)p_data);
 #endif
         break;
 
     case WICED_BT_MESH_TIME_ROLE_STATUS:
 #if defined HCI_CONTROL
-        if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+        if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
             mesh_time_role_status_hci_event_send(p_hci_event, (wiced_bt_mesh_time_role_msg_t *)p_data);
 #endif
         break;
@@ -188,6 +194,25 @@ uint32_t mesh_time_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32_t
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_time_client_proc_rx_cmd
+ */
+static const uint16_t mesh_time_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_TIME_GET,
+    HCI_CONTROL_MESH_COMMAND_TIME_SET,
+    HCI_CONTROL_MESH_COMMAND_TIME_ZONE_GET,
+    HCI_CONTROL_MESH_COMMAND_TIME_ZONE_SET,
+    HCI_CONTROL_MESH_COMMAND_TIME_TAI_UTC_DELTA_GET,
+    HCI_CONTROL_MESH_COMMAND_TIME_TAI_UTC_DELTA_SET,
+    HCI_CONTROL_MESH_COMMAND_TIME_ROLE_GET,
+    HCI_CONTROL_MESH_COMMAND_TIME_ROLE_SET,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_time_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(WICED_BT_MESH_CORE_MODEL_ID_TIME_CLNT, mesh_time_client_hci_opcodes, mesh_time_client_proc_rx_cmd);
+#endif
+
 /*
  * Send time get command
  */
@@ -206,6 +231,9 @@ void mesh_time_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_t len
 
     WICED_BT_TRACE("mesh_time_set\n");
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_TIME_SET_LEN))
+        return;
+
     STREAM_TO_UINT40(set_data.tai_seconds, p_data);
     STREAM_TO_UINT8(set_data.subsecond, p_data);
     STREAM_TO_UINT8(set_data.uncertainty, p_data);
@@ -235,6 +263,9 @@ void mesh_time_zone_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_
 
     WICED_BT_TRACE("mesh_time_zone_set\n");
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_TIME_ZONE_SET_LEN))
+        return;
+
     STREAM_TO_UINT8(set_data.time_zone_offset_new, p_data);
     STREAM_TO_UINT40(set_data.tai_of_zone_change, p_data);
 
@@ -260,6 +291,9 @@ void mesh_time_tai_utc_delta_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data
 
     WICED_BT_TRACE("mesh_time_tai_utc_delta_set\n");
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_TIME_TAI_UTC_DELTA_SET_LEN))
+        return;
+
     STREAM_TO_UINT16(set_data.tai_utc_delta_new, p_data);
     STREAM_TO_UINT40(set_data.tai_of_delta_change, p_data);
 
@@ -285,6 +319,9 @@ void mesh_time_role_set(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint32_
 
     WICED_BT_TRACE("mesh_time_role_set\n");
 
+    if (!mesh_app_hci_length_check(p_event, length, MESH_TIME_ROLE_SET_LEN))
+        return;
+
     STREAM_TO_UINT8(set_data.role, p_data);
 
     wiced_bt_mesh_model_time_client_time_role_set_send(p_event, &set_data);
@@ -312,7 +349,7 @@ void mesh_time_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event, wic
     WICED_BT_TRACE("tai_utc_delta_current: %x\n", p_time_status->tai_utc_delta_current);
     WICED_BT_TRACE("time_zone_offset_current: %x\n", p_time_status->time_zone_offset_current);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -333,7 +370,7 @@ void mesh_time_zone_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event
     WICED_BT_TRACE("time_zone_offset_current: %x\n", p_time_status->time_zone_offset_current);
     WICED_BT_TRACE("time_zone_offset_new: %x\n",p_time_status->time_zone_offset_new);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_ZONE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_ZONE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 
@@ -355,7 +392,7 @@ void mesh_time_tai_utc_delta_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_
     WICED_BT_TRACE("tai_utc_delta_current: %x\n", p_time_delta_status->tai_utc_delta_current);
     WICED_BT_TRACE("tai_utc_delta_new: %x\n",p_time_delta_status->tai_utc_delta_new);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_TAI_UTC_DELTA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_TAI_UTC_DELTA_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 
 /*
@@ -369,7 +406,7 @@ void mesh_time_role_status_hci_event_send(wiced_bt_mesh_hci_event_t *p_hci_event
 
     UINT8_TO_STREAM(p, p_role_status->role);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_ROLE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_TIME_ROLE_STATUS, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif
 
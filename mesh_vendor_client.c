@@ -50,6 +50,7 @@
 #include "wiced_transport.h"
 #include "hci_control_api.h"
 #endif
+#include "mesh_provision_client.h"
 
 /******************************************************
  *          Structures
@@ -59,7 +60,7 @@
  *          Function Prototypes
  ******************************************************/
 static void mesh_vendor_client_send_data(wiced_bt_mesh_event_t *p_event, uint8_t opcode, uint8_t *p_data, uint16_t data_len);
-void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len);
+void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
 
 #ifdef HCI_CONTROL
 static void mesh_vendor_hci_event_send_data(wiced_bt_mesh_hci_event_t *p_hci_event, uint16_t opcode, uint8_t *p_data, uint16_t data_len);
@@ -81,9 +82,9 @@ uint64_t data_tx_timestamp = 0;
  * was able to process the message, and FALSE if the message is unknown.  In the latter case the core
  * will call other registered models.
  */
-extern wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len);
+extern wiced_bool_t mesh_vendor_client_message_handler(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len);
 
-void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint8_t *p_data, uint16_t data_len)
+void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, const uint8_t *p_data, uint16_t data_len)
 {
 #if defined HCI_CONTROL
     wiced_bt_mesh_hci_event_t *p_hci_event;
@@ -91,7 +92,7 @@ void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint8_t *p_
     uint8_t *p_buffer = NULL;
     uint8_t *p = NULL;
 #endif
-    WICED_BT_TRACE("vs process data from:%04x opcode: %x len:%d\n", p_event->src, p_event->opcode, data_len);
+    MESH_BIN_TRACE(VENDOR, MESH_BIN_TRACE_LEVEL_INFO, MESH_BIN_TRACE_ID_VENDOR_DATA, p_event->src, p_event->opcode, data_len);
 
     // Because the same app publishes and subscribes the same model, it will receive messages that it
     //sent out.
@@ -99,7 +100,7 @@ void mesh_vendor_client_process_data(wiced_bt_mesh_event_t *p_event, uint8_t *p_
         return;
 
 #if defined HCI_CONTROL
-    if ((p_hci_event = wiced_bt_mesh_create_hci_event(p_event)) != NULL)
+    if ((p_hci_event = mesh_app_create_hci_event(p_event)) != NULL)
     {
         if ((p_buffer = (uint8_t*)wiced_bt_get_buffer(data_len + 4)) != NULL)
         {
@@ -140,13 +141,25 @@ uint32_t mesh_vendor_client_proc_rx_cmd(uint16_t opcode, uint8_t *p_data, uint32
     STREAM_TO_UINT16(p_event->model_id, p_data);
     STREAM_TO_UINT8(cmd_opcode, p_data);
 
-    WICED_BT_TRACE("rx vs cmd company_id:%04x model_id:%04x opcode:%02x handler:%x\n", p_event->company_id, p_event->model_id, cmd_opcode, mesh_vendor_client_message_handler);
+    MESH_BIN_TRACE(VENDOR, MESH_BIN_TRACE_LEVEL_INFO, MESH_BIN_TRACE_ID_VENDOR_CMD, p_event->company_id, p_event->model_id, cmd_opcode);
 
     data_tx_timestamp = wiced_bt_mesh_core_get_tick_count();
     mesh_vendor_client_send_data(p_event, cmd_opcode, p_data, length - 5);
     return WICED_TRUE;
 }
 
+#ifdef HCI_CONTROL
+/*
+ * HCI commands processed by mesh_vendor_client_proc_rx_cmd
+ */
+static const uint16_t mesh_vendor_client_hci_opcodes[] =
+{
+    HCI_CONTROL_MESH_COMMAND_VENDOR_DATA,
+};
+
+const mesh_app_hci_cmd_handler_t mesh_vendor_client_hci_cmd_handler = MESH_APP_HCI_CMD_HANDLER(MESH_APP_HCI_CMD_MODEL_IN_CMD, mesh_vendor_client_hci_opcodes, mesh_vendor_client_proc_rx_cmd);
+#endif
+
 /*
  * Send Vendor Data status message to the Client
  */
@@ -167,6 +180,6 @@ void mesh_vendor_hci_event_send_data(wiced_bt_mesh_hci_event_t *p_hci_event, uin
 
     ARRAY_TO_STREAM(p, p_data, data_len);
 
-    mesh_transport_send_data(HCI_CONTROL_MESH_EVENT_VENDOR_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
+    mesh_app_transport_send_data(HCI_CONTROL_MESH_EVENT_VENDOR_DATA, (uint8_t *)p_hci_event, (uint16_t)(p - (uint8_t *)p_hci_event));
 }
 #endif